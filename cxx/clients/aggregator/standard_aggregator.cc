@@ -13,7 +13,11 @@
 // limitations under the license.
 #include "cxx/clients/aggregator/standard_aggregator.h"
 
+#include <algorithm>
 #include <array>
+#include <deque>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
 
 #include "glog/logging.h"
 #include "src/google/protobuf/repeated_field.h"
@@ -34,32 +38,108 @@ constexpr char kNoError[] = "";
 
 static constexpr std::array<int, 8> kDefaultPercentileMilliRanks = {
     {1000, 2000, 5000, 10000, 90000, 95000, 98000, 99000}};
+
+// Number of FileIO records read from a file before handing them to a worker,
+// when a single file is processed by several threads.
+constexpr int kRecordsPerChunk = 1000;
+// Number of chunks that may wait for a worker, per worker.
+constexpr int kQueuedChunksPerThread = 2;
+
+// FileIO records read from a file, still serialized, to be decoded and
+// processed by a single worker.
+using Chunk = std::vector<std::string>;
+
+// A bounded queue of chunks of records, filled by the thread reading a file and
+// drained by the threads processing it.
+class ChunkQueue {
+ public:
+  explicit ChunkQueue(int max_size) : max_size_(max_size) {}
+
+  // Blocks until there is room for the chunk. Returns false without adding it
+  // if the queue has been cancelled.
+  bool Push(Chunk chunk) {
+    absl::MutexLock l(&mutex_);
+    mutex_.Await(absl::Condition(this, &ChunkQueue::CanPush));
+    if (cancelled_) {
+      return false;
+    }
+    chunks_.push_back(std::move(chunk));
+    return true;
+  }
+
+  // Blocks until a chunk is available. Returns false once the queue has been
+  // closed and drained, or cancelled.
+  bool Pop(Chunk* chunk) {
+    absl::MutexLock l(&mutex_);
+    mutex_.Await(absl::Condition(this, &ChunkQueue::CanPop));
+    if (cancelled_ || chunks_.empty()) {
+      return false;
+    }
+    *chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    return true;
+  }
+
+  // Called once no more chunks will be pushed.
+  void Close() {
+    absl::MutexLock l(&mutex_);
+    closed_ = true;
+  }
+
+  // Called on error, to stop both reading and processing.
+  void Cancel() {
+    absl::MutexLock l(&mutex_);
+    cancelled_ = true;
+  }
+
+ private:
+  bool CanPush() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return cancelled_ || chunks_.size() < max_size_;
+  }
+  bool CanPop() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return cancelled_ || closed_ || !chunks_.empty();
+  }
+
+  const std::size_t max_size_;
+  absl::Mutex mutex_;
+  std::deque<Chunk> chunks_ ABSL_GUARDED_BY(mutex_);
+  bool closed_ ABSL_GUARDED_BY(mutex_) = false;
+  bool cancelled_ ABSL_GUARDED_BY(mutex_) = false;
+};
 }  // namespace
 
 ThreadsafeRunningStats* Aggregator::GetOrCreateRunningStats(
     const std::string& value_key,
     std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
-  absl::MutexLock l(&mutex_);
-  if (stats_map->count(value_key) == 0) {
-    (*stats_map)[value_key] =
-        absl::make_unique<ThreadsafeRunningStats>(max_sample_size_);
+  std::unique_ptr<ThreadsafeRunningStats>& stats = (*stats_map)[value_key];
+  if (!stats) {
+    auto it = histogram_configs_.find(value_key);
+    if (it != histogram_configs_.end()) {
+      stats = absl::make_unique<ThreadsafeRunningStats>(it->second);
+    } else {
+      stats = absl::make_unique<ThreadsafeRunningStats>(stats_config_);
+    }
   }
-  return stats_map->at(value_key).get();
+  return stats.get();
 }
 
-// Return bool if the passed SamplePoint's input_value falls within any of the
-// ignore ranges.
-bool Aggregator::Ignored(const std::list<mako::Range>& sorted_ignore_list,
-                         double input_value) {
-  for (const auto& range : sorted_ignore_list) {
-    // Because ignore list is sorted by start time we can abort search.
-    if (range.start() > input_value) {
-      return false;
-    } else if (range.start() <= input_value && input_value <= range.end()) {
-      return true;
+std::string Aggregator::MergeRunningStats(
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* from,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* to) {
+  std::string err;
+  for (auto& kv : *from) {
+    std::unique_ptr<ThreadsafeRunningStats>& stats = (*to)[kv.first];
+    if (!stats) {
+      stats = std::move(kv.second);
+      continue;
+    }
+    std::string error = stats->Merge(*kv.second);
+    if (!error.empty()) {
+      absl::StrAppend(&err, "\n", error);
     }
   }
-  return false;
+  from->clear();
+  return err;
 }
 
 // Calculate aggregates based on AggregatorInput(). Place results in
@@ -71,8 +151,8 @@ std::string Aggregator::Aggregate(
   if (!fileio_) {
     return "Must pass a FileIO instance with Aggregator.SetFileIO() first.";
   }
-  std::list<mako::Range> sorted_ignore_list;
-  std::string err = Init(aggregator_input, &sorted_ignore_list);
+  mako::internal::IgnoreRangeIndex ignore_ranges;
+  std::string err = Init(aggregator_input, &ignore_ranges);
   if (!err.empty()) {
     LOG(ERROR) << err;
     return err;
@@ -80,7 +160,7 @@ std::string Aggregator::Aggregate(
 
   SampleCounts sample_counts;
   std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>> stats_map;
-  err = ProcessFiles(aggregator_input, sorted_ignore_list, &sample_counts,
+  err = ProcessFiles(aggregator_input, ignore_ranges, &sample_counts,
                      &stats_map);
   if (!err.empty()) {
     LOG(ERROR) << err;
@@ -93,7 +173,7 @@ std::string Aggregator::Aggregate(
 
 std::string Aggregator::ProcessFiles(
     const mako::AggregatorInput& aggregator_input,
-    const std::list<mako::Range>& sorted_ignore_list,
+    const mako::internal::IgnoreRangeIndex& ignore_ranges,
     SampleCounts* sample_counts,
     std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
   std::string err;
@@ -101,6 +181,18 @@ std::string Aggregator::ProcessFiles(
   const StandardAggregatorOptions& options =
       aggregator_input.standard_aggregator_options();
 
+  // Quickstore writes a single sample file, which would otherwise be processed
+  // by a single thread.
+  int max_threads = max_threads_;
+  if (max_threads <= 0) {
+    max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+  }
+  if (aggregator_input.sample_file_list_size() == 1 && max_threads > 1) {
+    return ProcessFileInChunks(ignore_ranges,
+                               aggregator_input.sample_file_list(0).file_path(),
+                               options, max_threads, sample_counts, stats_map);
+  }
+
   int num_threads = aggregator_input.sample_file_list_size();
   if (max_threads_ > 0 && max_threads_ < num_threads) {
     num_threads = max_threads_;
@@ -111,16 +203,20 @@ std::string Aggregator::ProcessFiles(
   absl::Duration total_fileio_read_time;
   for (const mako::SampleFile& sample_file :
        aggregator_input.sample_file_list()) {
-    file_processor.Schedule([&err, &sample_file, &m, &sorted_ignore_list,
+    file_processor.Schedule([&err, &sample_file, &m, &ignore_ranges,
                              sample_counts, stats_map, &total_fileio_read_time,
                              &options, this]() {
       SampleCounts file_sample_counts;
       std::unique_ptr<mako::FileIO> fio = fileio_->MakeInstance();
       absl::Duration fileio_read_time;
+      // Stats private to this file, so that no locks are contended while
+      // processing it. They are merged into stats_map once at the end.
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>
+          file_stats_map;
 
       std::string error = ProcessFile(
-          sorted_ignore_list, sample_file.file_path(), options, fio.get(),
-          &file_sample_counts, stats_map, &fileio_read_time);
+          ignore_ranges, sample_file.file_path(), options, fio.get(),
+          &file_sample_counts, &file_stats_map, &fileio_read_time);
       bool successful_close = fio->Close();
       VLOG(1) << "Spent " << fileio_read_time << " reading points from "
                 << sample_file.file_path();
@@ -135,6 +231,7 @@ std::string Aggregator::ProcessFiles(
       if (!error.empty()) {
         absl::StrAppend(&err, "\n", error);
       }
+      absl::StrAppend(&err, MergeRunningStats(&file_stats_map, stats_map));
     });
   }
   file_processor.Wait();
@@ -144,70 +241,175 @@ std::string Aggregator::ProcessFiles(
 }
 
 std::string Aggregator::ProcessFile(
-    const std::list<mako::Range>& sorted_ignore_list,
+    const mako::internal::IgnoreRangeIndex& ignore_ranges,
     const std::string& file_path, const StandardAggregatorOptions& options,
     mako::FileIO* fio, SampleCounts* sample_counts,
     std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map,
     absl::Duration* fileio_read_time) {
-  std::map<std::string, std::vector<double>> buffers;
+  MetricBuffers buffers(metric_keys_);
+  mako::internal::IgnoreRangeIndex::Cursor ignore_cursor =
+      ignore_ranges.cursor();
   std::string err;
   VLOG(1) << "Processing file: " << file_path;
   if (!fio->Open(file_path, mako::FileIO::AccessMode::kRead)) {
     return absl::StrCat("Could not open file at path: ", file_path,
                         " Error message: ", fio->Error());
   }
-  mako::SampleRecord sample_record;
+  mako::internal::SampleFileReader reader(fio);
   while (true) {
-    sample_record.Clear();
     absl::Time start = absl::Now();
-    if (!fio->Read(&sample_record)) {
-      if (!fio->ReadEOF()) {
+    if (!reader.Next()) {
+      if (!reader.error().empty()) {
         return absl::StrCat("Error attempting to read from file: ", file_path,
-                            ". Error message: ", fio->Error());
+                            ". Error message: ", reader.error());
       }
       break;
     }
     *fileio_read_time += absl::Now() - start;
-    err = ProcessRecord(sorted_ignore_list, sample_record, options, &buffers,
-                        sample_counts, stats_map);
+    if (reader.has_columns()) {
+      err = ProcessColumns(&ignore_cursor, reader.columns(), options, &buffers,
+                           sample_counts, stats_map);
+    } else {
+      err = ProcessRecord(&ignore_cursor, reader.record(), options, &buffers,
+                          sample_counts, stats_map);
+    }
     if (!err.empty()) {
       return err;
     }
   }
   VLOG(1) << "Done processing file: " << file_path;
 
-  for (const auto& pair : buffers) {
-    std::string error = ProcessBuffer(pair.first, pair.second, stats_map);
-    if (!error.empty()) {
-      absl::StrAppend(&err, "\n", error);
+  return FlushBuffers(&buffers, stats_map);
+}
+
+std::string Aggregator::ProcessFileInChunks(
+    const mako::internal::IgnoreRangeIndex& ignore_ranges,
+    const std::string& file_path, const StandardAggregatorOptions& options,
+    int num_threads, SampleCounts* sample_counts,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  std::unique_ptr<mako::FileIO> fio = fileio_->MakeInstance();
+  VLOG(1) << "Processing file: " << file_path << " in chunks of "
+          << kRecordsPerChunk << " records across " << num_threads
+          << " threads.";
+  if (!fio->Open(file_path, mako::FileIO::AccessMode::kRead)) {
+    return absl::StrCat("Could not open file at path: ", file_path,
+                        " Error message: ", fio->Error());
+  }
+
+  LOG(INFO) << "Creating thread pool with " << num_threads << " threads.";
+  ChunkQueue queue(num_threads * kQueuedChunksPerThread);
+  absl::Mutex m;
+  std::string err;
+  mako::internal::Executor chunk_processor(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    chunk_processor.Schedule([&ignore_ranges, &file_path, &options, &queue,
+                              &m, &err, sample_counts, stats_map, this]() {
+      // As when processing whole files, each thread aggregates into its own
+      // stats and merges them into stats_map once it is done.
+      SampleCounts thread_sample_counts;
+      MetricBuffers buffers(metric_keys_);
+      mako::internal::IgnoreRangeIndex::Cursor ignore_cursor =
+          ignore_ranges.cursor();
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>
+          thread_stats_map;
+      std::string error;
+      Chunk chunk;
+      mako::SampleRecord sample_record;
+      mako::internal::SampleColumns columns;
+      while (error.empty() && queue.Pop(&chunk)) {
+        for (const std::string& data : chunk) {
+          bool has_columns;
+          error = mako::internal::DecodeSampleFileRecord(
+              data, &columns, &sample_record, &has_columns);
+          if (!error.empty()) {
+            error = absl::StrCat("Error attempting to read from file: ",
+                                 file_path, ". Error message: ", error);
+          } else if (has_columns) {
+            error = ProcessColumns(&ignore_cursor, columns, options, &buffers,
+                                   &thread_sample_counts, &thread_stats_map);
+          } else {
+            error = ProcessRecord(&ignore_cursor, sample_record, options,
+                                  &buffers, &thread_sample_counts,
+                                  &thread_stats_map);
+          }
+          if (!error.empty()) {
+            queue.Cancel();
+            break;
+          }
+        }
+      }
+      absl::StrAppend(&error, FlushBuffers(&buffers, &thread_stats_map));
+      absl::MutexLock l(&m);
+      sample_counts->ignored += thread_sample_counts.ignored;
+      sample_counts->usable += thread_sample_counts.usable;
+      sample_counts->error += thread_sample_counts.error;
+      if (!error.empty()) {
+        absl::StrAppend(&err, "\n", error);
+      }
+      absl::StrAppend(&err, MergeRunningStats(&thread_stats_map, stats_map));
+    });
+  }
+
+  // Read on this thread, handing off chunks of records to be decoded and
+  // processed.
+  absl::Duration fileio_read_time;
+  std::string read_error;
+  while (true) {
+    absl::Time start = absl::Now();
+    Chunk chunk;
+    if (!fio->ReadBatch(kRecordsPerChunk, &chunk)) {
+      if (!fio->ReadEOF()) {
+        read_error =
+            absl::StrCat("Error attempting to read from file: ", file_path,
+                         ". Error message: ", fio->Error());
+        queue.Cancel();
+      }
+      break;
+    }
+    fileio_read_time += absl::Now() - start;
+    if (!queue.Push(std::move(chunk))) {
+      break;
     }
   }
+  queue.Close();
+  bool successful_close = fio->Close();
+  chunk_processor.Wait();
+  VLOG(1) << "Done processing file: " << file_path;
+  LOG(INFO) << "Spent " << fileio_read_time << " reading points from "
+            << file_path;
+
+  if (!read_error.empty()) {
+    return read_error;
+  }
+  if (!successful_close && !fio->Error().empty()) {
+    absl::StrAppend(&err, "\n", fio->Error());
+  }
   return err;
 }
 
 std::string Aggregator::ProcessRecord(
-    const std::list<mako::Range>& sorted_ignore_list,
+    mako::internal::IgnoreRangeIndex::Cursor* ignore_cursor,
     const mako::SampleRecord& sample_record,
-    const StandardAggregatorOptions& options,
-    std::map<std::string, std::vector<double>>* buffers,
+    const StandardAggregatorOptions& options, MetricBuffers* buffers,
     SampleCounts* sample_counts,
     std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
   std::string err;
   if (sample_record.has_sample_point()) {
-    if (Ignored(sorted_ignore_list,
-                sample_record.sample_point().input_value())) {
+    if (ignore_cursor->Contains(sample_record.sample_point().input_value())) {
       ++sample_counts->ignored;
     } else {
       ++sample_counts->usable;
       const auto& sample_point = sample_record.sample_point();
       for (const auto& k : sample_point.metric_value_list()) {
-        err = AppendToBuffer(k.value_key(), k.value(), buffers, stats_map);
+        err = AppendToBuffer(buffers->keys.Intern(k.value_key()), k.value(),
+                             buffers, stats_map);
         if (!err.empty()) {
           return err;
         }
       }
       if (per_sample_point_cb_) {
-        err = per_sample_point_cb_(sample_point, buffers, stats_map);
+        err = per_sample_point_cb_(sample_point, &buffers->callback_buffers,
+                                   stats_map);
         if (!err.empty()) {
           return err;
         }
@@ -220,7 +422,7 @@ std::string Aggregator::ProcessRecord(
     bool ignore_errors = options.errors_in_ignore_range_behavior() ==
                          StandardAggregatorOptions::IGNORE_ERRORS;
     bool is_ignored =
-        Ignored(sorted_ignore_list, sample_record.sample_error().input_value());
+        ignore_cursor->Contains(sample_record.sample_error().input_value());
     if (!is_ignored || !ignore_errors) {
       ++sample_counts->error;
     }
@@ -228,6 +430,66 @@ std::string Aggregator::ProcessRecord(
   return kNoError;
 }
 
+std::string Aggregator::ProcessColumns(
+    mako::internal::IgnoreRangeIndex::Cursor* ignore_cursor,
+    const mako::internal::SampleColumns& columns,
+    const StandardAggregatorOptions& options, MetricBuffers* buffers,
+    SampleCounts* sample_counts,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  std::string err;
+  if (per_sample_point_cb_) {
+    // The callback is passed each SamplePoint, so the block is processed as
+    // records.
+    std::vector<mako::SampleRecord> records;
+    columns.ToRecords(&records);
+    for (const mako::SampleRecord& sample_record : records) {
+      err = ProcessRecord(ignore_cursor, sample_record, options, buffers,
+                          sample_counts, stats_map);
+      if (!err.empty()) {
+        return err;
+      }
+    }
+    return kNoError;
+  }
+  for (const mako::SampleRecord& sample_record : columns.other_records()) {
+    err = ProcessRecord(ignore_cursor, sample_record, options, buffers,
+                        sample_counts, stats_map);
+    if (!err.empty()) {
+      return err;
+    }
+  }
+  bool any_ignored = false;
+  for (double input_value : columns.input_values()) {
+    if (ignore_cursor->Contains(input_value)) {
+      ++sample_counts->ignored;
+      any_ignored = true;
+    } else {
+      ++sample_counts->usable;
+    }
+  }
+  for (int key_id = 0; key_id < columns.num_keys(); ++key_id) {
+    const int metric_id = buffers->keys.Intern(columns.key(key_id));
+    const absl::Span<const double> values = columns.values(key_id);
+    if (!any_ignored) {
+      err = AppendToBuffer(metric_id, values, buffers, stats_map);
+      if (!err.empty()) {
+        return err;
+      }
+      continue;
+    }
+    const absl::Span<const double> inputs = columns.value_inputs(key_id);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      if (!ignore_cursor->Contains(inputs[i])) {
+        err = AppendToBuffer(metric_id, values[i], buffers, stats_map);
+        if (!err.empty()) {
+          return err;
+        }
+      }
+    }
+  }
+  return kNoError;
+}
+
 std::string Aggregator::AppendToBuffer(
     const std::string& value_key, const double value,
     std::map<std::string, std::vector<double>>* buffers,
@@ -250,8 +512,73 @@ std::string Aggregator::ProcessBuffer(
   return GetOrCreateRunningStats(value_key, stats_map)->AddVector(buffer);
 }
 
+std::string Aggregator::AppendToBuffer(
+    int metric_id, double value, MetricBuffers* buffers,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  if (static_cast<std::size_t>(metric_id) >= buffers->buffers.size()) {
+    buffers->buffers.resize(metric_id + 1);
+    buffers->stats.resize(metric_id + 1, nullptr);
+  }
+  std::vector<double>& buffer = buffers->buffers[metric_id];
+  buffer.push_back(value);
+  if (buffer.size() > static_cast<std::size_t>(buffer_size_)) {
+    return FlushBuffer(metric_id, buffers, stats_map);
+  }
+  return kNoError;
+}
+
+std::string Aggregator::AppendToBuffer(
+    int metric_id, absl::Span<const double> values, MetricBuffers* buffers,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  if (static_cast<std::size_t>(metric_id) >= buffers->buffers.size()) {
+    buffers->buffers.resize(metric_id + 1);
+    buffers->stats.resize(metric_id + 1, nullptr);
+  }
+  std::vector<double>& buffer = buffers->buffers[metric_id];
+  buffer.insert(buffer.end(), values.begin(), values.end());
+  if (buffer.size() > static_cast<std::size_t>(buffer_size_)) {
+    return FlushBuffer(metric_id, buffers, stats_map);
+  }
+  return kNoError;
+}
+
+std::string Aggregator::FlushBuffer(
+    int metric_id, MetricBuffers* buffers,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  std::vector<double>& buffer = buffers->buffers[metric_id];
+  ThreadsafeRunningStats*& stats = buffers->stats[metric_id];
+  if (!stats) {
+    stats = GetOrCreateRunningStats(buffers->keys.key(metric_id), stats_map);
+  }
+  std::string err = stats->AddVector(buffer);
+  buffer.clear();
+  return err;
+}
+
+std::string Aggregator::FlushBuffers(
+    MetricBuffers* buffers,
+    std::map<std::string, std::unique_ptr<ThreadsafeRunningStats>>* stats_map) {
+  std::string err;
+  for (std::size_t id = 0; id < buffers->buffers.size(); ++id) {
+    if (buffers->buffers[id].empty()) {
+      continue;
+    }
+    std::string error = FlushBuffer(id, buffers, stats_map);
+    if (!error.empty()) {
+      absl::StrAppend(&err, "\n", error);
+    }
+  }
+  for (const auto& pair : buffers->callback_buffers) {
+    std::string error = ProcessBuffer(pair.first, pair.second, stats_map);
+    if (!error.empty()) {
+      absl::StrAppend(&err, "\n", error);
+    }
+  }
+  return err;
+}
+
 std::string Aggregator::Init(const mako::AggregatorInput& aggregator_input,
-                             std::list<mako::Range>* sorted_ignore_list) {
+                             mako::internal::IgnoreRangeIndex* ignore_ranges) {
   std::string err =
       mako::internal::ValidateAggregatorInput(aggregator_input);
   if (!err.empty()) {
@@ -259,15 +586,34 @@ std::string Aggregator::Init(const mako::AggregatorInput& aggregator_input,
     return err;
   }
 
-  // Sort ignore ranges.
-  for (const mako::LabeledRange& lr :
-       aggregator_input.run_info().ignore_range_list()) {
-    sorted_ignore_list->push_back(lr.range());
+  metric_keys_ =
+      mako::internal::MetricKeyDictionary(aggregator_input.benchmark_info());
+  histogram_configs_.clear();
+  for (const auto& metric : aggregator_input.standard_aggregator_options()
+                                .histogram_metric_list()) {
+    if (metric.value_key().empty()) {
+      return "StandardAggregatorOptions.histogram_metric_list entries must set "
+             "value_key.";
+    }
+    if (!metric.has_highest_trackable_value()) {
+      return absl::StrCat("Histogram metric ", metric.value_key(),
+                          " must set highest_trackable_value.");
+    }
+    mako::internal::HdrRunningStats::Config config(
+        metric.lowest_discernible_value(), metric.highest_trackable_value(),
+        metric.significant_digits());
+    err = mako::internal::HdrRunningStats::ValidateConfig(config);
+    if (!err.empty()) {
+      return absl::StrCat("Histogram metric ", metric.value_key(), ": ", err);
+    }
+    if (!histogram_configs_.emplace(metric.value_key(), config).second) {
+      return absl::StrCat("Histogram metric ", metric.value_key(),
+                          " is listed more than once.");
+    }
   }
-  sorted_ignore_list->sort(
-      [](const mako::Range& a, const mako::Range& b) {
-        return a.start() <= b.start();
-      });
+
+  *ignore_ranges = mako::internal::IgnoreRangeIndex(
+      aggregator_input.run_info().ignore_range_list());
   return kNoError;
 }
 
@@ -293,37 +639,55 @@ std::string Aggregator::Complete(
   ragg->set_ignore_sample_count(sample_counts.ignored);
   ragg->set_usable_sample_count(sample_counts.usable);
 
-  // Foreach metric key, create a metric aggregate
-  mako::internal::RunningStats::Result result;
+  std::vector<double> pcts;
+  for (double pmr : output->aggregate().percentile_milli_rank_list()) {
+    pcts.push_back(pmr / 100000.0);
+  }
+
+  // Foreach metric key, create a metric aggregate. Errors are only turned into
+  // strings on failure, and one Summary is reused for every key.
+  using mako::internal::RunningStats;
+  RunningStats::Error error;
+  RunningStats::Summary summary;
+  double value;
   absl::MutexLock l(&mutex_);
   for (auto& kv : stats_map) {
     auto magg = output->mutable_aggregate()->add_metric_aggregate_list();
     magg->set_metric_key(kv.first);
-    result = kv.second->Mean();
-    if (!result.error.empty()) return result.error;
-    magg->set_mean(result.value);
-    result = kv.second->Stddev();
-    if (!result.error.empty()) return result.error;
-    magg->set_standard_deviation(result.value);
-    result = kv.second->Mad();
-    if (!result.error.empty()) return result.error;
-    magg->set_median_absolute_deviation(result.value);
-    result = kv.second->Min();
-    if (!result.error.empty()) return result.error;
-    magg->set_min(result.value);
-    result = kv.second->Max();
-    if (!result.error.empty()) return result.error;
-    magg->set_max(result.value);
-    result = kv.second->Median();
-    if (!result.error.empty()) return result.error;
-    magg->set_median(result.value);
-    result = kv.second->Count();
-    if (!result.error.empty()) return result.error;
-    magg->set_count(result.value);
-    for (double pmr : output->aggregate().percentile_milli_rank_list()) {
-      result = kv.second->Percentile(pmr / 100000.0);
-      if (!result.error.empty()) return result.error;
-      magg->add_percentile_list(result.value);
+    error = kv.second->Mean(&value);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_mean(value);
+    error = kv.second->Stddev(&value);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_standard_deviation(value);
+    // Median, MAD, and percentiles together, so the sample is sorted once.
+    error = kv.second->Summarize(pcts, &summary);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_median_absolute_deviation(summary.mad);
+    error = kv.second->Min(&value);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_min(value);
+    error = kv.second->Max(&value);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_max(value);
+    magg->set_median(summary.median);
+    error = kv.second->Count(&value);
+    if (error != RunningStats::Error::kOk) {
+      return RunningStats::ErrorMessage(error);
+    }
+    magg->set_count(value);
+    for (double percentile : summary.percentiles) {
+      magg->add_percentile_list(percentile);
     }
   }
   return kNoError;
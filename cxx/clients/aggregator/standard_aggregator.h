@@ -15,7 +15,6 @@
 #define CXX_CLIENTS_AGGREGATOR_STANDARD_AGGREGATOR_H_
 
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -24,7 +23,13 @@
 
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "cxx/clients/aggregator/threadsafe_running_stats.h"
+#include "cxx/internal/hdr_running_stats.h"
+#include "cxx/internal/ignore_range_index.h"
+#include "cxx/internal/metric_key_dictionary.h"
+#include "cxx/internal/pgmath.h"
+#include "cxx/internal/sample_columns.h"
 #include "cxx/spec/aggregator.h"
 #include "cxx/spec/fileio.h"
 #include "spec/proto/mako.pb.h"
@@ -61,28 +66,40 @@ class Aggregator : public mako::Aggregator {
   //   max_threads: The maximum number of threads to be used for processing
   //     files in parallel. A value that is not positive indicates no max. If
   //     this value is higher than the number of input files, the number of
-  //     files will be used instead.
+  //     files will be used instead, except that a single input file is split
+  //     into chunks of records processed by up to max_threads threads (or one
+  //     per core when there is no max).
   //     TODO(b/136282446): adapt this to use different defaults depending on
   //     if we're in a small or large test.
   //   buffer_size: The number of values each thread will buffer for each
-  //     metric. The buffering is used to reduce contention, since global locks
-  //     are necessary in places during aggregation. Without the buffering (or
-  //     with buffer_size = 1), we must lock on each point, so a large portion
-  //     of the performance gained from parallelizing the FileIO reads is lost.
-  //     The amount of extra memory used will be proportional to
-  //     max_threads*buffer_size*num_metrics, where num_metrics is the number of
-  //     metrics reported on each point (which will vary from test to test).
+  //     metric. Each thread aggregates into stats private to the file it is
+  //     processing, which are merged into the run's stats once the file is
+  //     done, so no locks are contended per point. The buffering batches
+  //     updates to those stats. The amount of extra memory used by the buffers
+  //     will be proportional to max_threads*buffer_size*num_metrics, where
+  //     num_metrics is the number of metrics reported on each point (which
+  //     will vary from test to test).
   //     With the defaults of 8 threads and buffer size of 10, the extra memory
   //     used will be around:
   //       1 metric per point: 640 bytes
   //       10 metrics per point: 6400 bytes
   //       100 metrics per point: 64000 bytes
   //       500 metrics per point: 320000 bytes.
-  Aggregator(int max_sample_size, int max_threads, int buffer_size) :
-    buffer_size_(buffer_size),
-    max_sample_size_(max_sample_size),
-    max_threads_(max_threads) {
-  }
+  Aggregator(int max_sample_size, int max_threads, int buffer_size)
+      : Aggregator(mako::internal::RunningStats::Config{max_sample_size,
+                                                         nullptr},
+                   max_threads, buffer_size) {}
+
+  // Alternate constructor which allows full control over how each metric's
+  // stats are kept. Use mako::internal::RunningStats::Config::Sketch() to
+  // estimate percentiles, median, and MAD in bounded memory with a mergeable
+  // quantile sketch rather than from a sample. Any Random set on the config is
+  // ignored; each metric gets its own when needed.
+  Aggregator(const mako::internal::RunningStats::Config& stats_config,
+             int max_threads, int buffer_size)
+      : buffer_size_(buffer_size),
+        stats_config_(stats_config),
+        max_threads_(max_threads) {}
 
   // Set the FileIO implementation that is used to read samples.
   void SetFileIO(std::unique_ptr<FileIO> fileio) override {
@@ -102,10 +119,13 @@ class Aggregator : public mako::Aggregator {
   // that the aggregator processes, allowing the called code to collect
   // additional data.
   //
-  // The map pointer points to the buffers for the currently running thread.
-  // If you wish for additional metrics to be collected, pass it along with the
-  // key and value to AppendToBuffer in your callback. This should help limit
-  // contention resulting from the necessary synchronization.
+  // The callback runs concurrently on several threads: each processes whole
+  // files, or, when there is a single sample file, chunks of its records. The
+  // map pointers point to buffers and stats private to the calling thread,
+  // which are merged once it is done, so the callback needs no locking to use
+  // them; anything else it touches must be thread-safe. If you wish for
+  // additional metrics to be collected, pass them along with the key and value
+  // to AppendToBuffer in your callback.
   //
   // A getter for the FileIO pointer is provided so the aggregator extensions
   // can make additional passes over the data files if necessary.
@@ -138,11 +158,23 @@ class Aggregator : public mako::Aggregator {
     int error = 0;
   };
 
-  bool Ignored(const std::list<mako::Range>& sorted_ignore_list,
-               double input_value);
+  // The buffers of the metrics a single thread is aggregating, kept by metric
+  // id so that each value costs one hash of its key rather than a map lookup.
+  struct MetricBuffers {
+    explicit MetricBuffers(const mako::internal::MetricKeyDictionary& keys)
+        : keys(keys) {}
+
+    mako::internal::MetricKeyDictionary keys;
+    std::vector<std::vector<double>> buffers;
+    // The stats each buffer is flushed to, owned by the thread's stats_map.
+    // Null until the first flush.
+    std::vector<ThreadsafeRunningStats*> stats;
+    // Buffers filled by the PerSamplePointCallback, by key.
+    std::map<std::string, std::vector<double>> callback_buffers;
+  };
 
   std::string Init(const mako::AggregatorInput& aggregator_input,
-                   std::list<mako::Range>* sorted_ignore_list);
+                   mako::internal::IgnoreRangeIndex* ignore_ranges);
   std::string Complete(
       const mako::AggregatorInput& aggregator_input,
       const SampleCounts& sample_counts,
@@ -152,22 +184,41 @@ class Aggregator : public mako::Aggregator {
 
   std::string ProcessFiles(
       const mako::AggregatorInput& aggregator_input,
-      const std::list<mako::Range>& sorted_ignore_list,
+      const mako::internal::IgnoreRangeIndex& ignore_ranges,
       SampleCounts* sample_counts,
       std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
           stats_map);
   std::string ProcessFile(
-      const std::list<mako::Range>& sorted_ignore_list,
+      const mako::internal::IgnoreRangeIndex& ignore_ranges,
       const std::string& file_path, const StandardAggregatorOptions& options,
       mako::FileIO* fio, SampleCounts* sample_counts,
       std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
           stats_map,
       absl::Duration* fileio_read_time);
+  // Processes a single file by reading chunks of serialized records on the
+  // calling thread, and decoding and processing them on num_threads other
+  // threads.
+  std::string ProcessFileInChunks(
+      const mako::internal::IgnoreRangeIndex& ignore_ranges,
+      const std::string& file_path, const StandardAggregatorOptions& options,
+      int num_threads, SampleCounts* sample_counts,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
+  // Samples are looked up in the ignore ranges through ignore_cursor, which is
+  // cheapest when records come in order of input_value.
   std::string ProcessRecord(
-      const std::list<mako::Range>& sorted_ignore_list,
+      mako::internal::IgnoreRangeIndex::Cursor* ignore_cursor,
       const mako::SampleRecord& sample_record,
-      const StandardAggregatorOptions& options,
-      std::map<std::string, std::vector<double> >* buffers,
+      const StandardAggregatorOptions& options, MetricBuffers* buffers,
+      SampleCounts* sample_counts,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
+  // Processes a block of records read from a sample file, appending the
+  // values of each metric a column at a time.
+  std::string ProcessColumns(
+      mako::internal::IgnoreRangeIndex::Cursor* ignore_cursor,
+      const mako::internal::SampleColumns& columns,
+      const StandardAggregatorOptions& options, MetricBuffers* buffers,
       SampleCounts* sample_counts,
       std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
           stats_map);
@@ -175,21 +226,56 @@ class Aggregator : public mako::Aggregator {
       const std::string& value_key, const std::vector<double>& buffer,
       std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
           stats_map);
+  // Appends to the buffer of the metric with the given id, flushing it once
+  // full.
+  std::string AppendToBuffer(
+      int metric_id, double value, MetricBuffers* buffers,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
+  std::string AppendToBuffer(
+      int metric_id, absl::Span<const double> values, MetricBuffers* buffers,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
+  // Adds the values in the buffer of the metric with the given id to its stats
+  // and clears the buffer.
+  std::string FlushBuffer(
+      int metric_id, MetricBuffers* buffers,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
+  // Flushes all buffers, once a thread is done processing records.
+  std::string FlushBuffers(
+      MetricBuffers* buffers,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
+          stats_map);
 
-  // Used to synchronize access to the underlying map.
+  // Each file is processed into its own stats_map, so access to it needs no
+  // synchronization.
   ThreadsafeRunningStats* GetOrCreateRunningStats(
       const std::string& value_key,
       std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >*
           stats_map);
 
+  // Merges (and clears) the stats in from into to. Any errors will be
+  // returned.
+  std::string MergeRunningStats(
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >* from,
+      std::map<std::string, std::unique_ptr<ThreadsafeRunningStats> >* to);
+
   std::unique_ptr<mako::FileIO> fileio_;
 
   const int buffer_size_;
-  const int max_sample_size_;
+  const mako::internal::RunningStats::Config stats_config_;
+  // Metrics kept in a histogram instead, from the
+  // StandardAggregatorOptions.histogram_metric_list of the current call to
+  // Aggregate. Set by Init and only read while processing files.
+  std::map<std::string, mako::internal::HdrRunningStats::Config>
+      histogram_configs_;
+  // Ids of the metrics in the BenchmarkInfo of the current call to Aggregate,
+  // copied by each thread as the start of its own dictionary. Set by Init.
+  mako::internal::MetricKeyDictionary metric_keys_;
   const int max_threads_;
   PerSamplePointCallback per_sample_point_cb_;
-  // Synchronizes calls to GetOrCreateRunningStats, so exactly one RunningStats
-  // is created for each metric key.
+  // Synchronizes calls to Complete.
   absl::Mutex mutex_;
 };
 
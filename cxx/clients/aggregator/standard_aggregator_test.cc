@@ -19,12 +19,15 @@
 #include <utility>
 #include <vector>
 
+#include "benchmark/benchmark.h"
+#include "glog/logging.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "cxx/clients/fileio/memory_fileio.h"
+#include "cxx/internal/sample_columns.h"
 #include "spec/proto/mako.pb.h"
 
 namespace mako {
@@ -113,6 +116,21 @@ void WriteFile(const std::string& file_path,
   ASSERT_TRUE(fileio.Close());
 }
 
+// Writes the records in blocks stored by column.
+void WriteColumnsFile(const std::string& file_path,
+                      const std::vector<mako::SampleRecord>& data,
+                      int records_per_block) {
+  mako::memory_fileio::FileIO fileio;
+
+  ASSERT_TRUE(fileio.Open(file_path, mako::FileIO::AccessMode::kWrite));
+  mako::internal::SampleColumnsWriter writer(&fileio, records_per_block);
+  for (const auto& d : data) {
+    ASSERT_TRUE(writer.Write(d));
+  }
+  ASSERT_TRUE(writer.Flush());
+  ASSERT_TRUE(fileio.Close());
+}
+
 class StandardAggregatorTest : public ::testing::Test {
  protected:
   StandardAggregatorTest() {}
@@ -315,6 +333,45 @@ TEST_F(StandardAggregatorTest, IgnoreRanges) {
   ASSERT_NEAR(ma.standard_deviation(), 81.6496581, 0.000001);
 }
 
+TEST_F(StandardAggregatorTest, OverlappingIgnoreRanges) {
+  AggregatorOutput out;
+  AggregatorInput in = HelperCreateAggregatorInput({"file1"});
+  // Unsorted, with equal starts, overlapping the existing 30,40 range.
+  for (const auto& range : std::vector<std::pair<double, double>>{
+           {50, 52}, {35, 46}, {50, 50}, {5, 5}}) {
+    mako::LabeledRange* r =
+        in.mutable_run_info()->mutable_ignore_range_list()->Add();
+    r->set_label("overlapping");
+    r->mutable_range()->set_start(range.first);
+    r->mutable_range()->set_end(range.second);
+  }
+
+  WriteFile("file1",
+            {
+                // honored
+                HelperCreateSampleRecord(1, {std::make_pair("y", 0)}),
+                // ignored
+                HelperCreateSampleRecord(5, {std::make_pair("y", 50)}),
+                // ignored
+                HelperCreateSampleRecord(45, {std::make_pair("y", 50)}),
+                // honored
+                HelperCreateSampleRecord(47, {std::make_pair("y", 100)}),
+                // ignored
+                HelperCreateSampleRecord(51, {std::make_pair("y", 50)}),
+                // ignored, out of order
+                HelperCreateSampleRecord(15, {std::make_pair("y", 50)}),
+                // honored
+                HelperCreateSampleRecord(55, {std::make_pair("y", 200)}),
+            });
+
+  ASSERT_EQ(a_.Aggregate(in, &out), "");
+
+  ASSERT_EQ(out.aggregate().run_aggregate().usable_sample_count(), 3);
+  ASSERT_EQ(out.aggregate().run_aggregate().ignore_sample_count(), 4);
+  ASSERT_EQ(out.aggregate().metric_aggregate_list_size(), 1);
+  ASSERT_EQ(out.aggregate().metric_aggregate_list(0).mean(), 100);
+}
+
 TEST_F(StandardAggregatorTest, CountErrorsInIgnoreRangesByDefault) {
   AggregatorOutput out;
 
@@ -489,6 +546,268 @@ TEST_F(StandardAggregatorTest, MaxSampleSize) {
   EXPECT_EQ(percentiles.size(), 1);
 }
 
+TEST_F(StandardAggregatorTest, QuantileSketch) {
+  // With fewer values than the sketch's k, sketch estimates are exact, so the
+  // sketch-backed aggregator must agree with the default one.
+  std::vector<std::string> files;
+  for (int i = 0; i < 10; ++i) {
+    files.push_back(absl::StrCat("file", i));
+    std::vector<mako::SampleRecord> records;
+    for (int j = 0; j < 10; ++j) {
+      records.push_back(HelperCreateSampleRecord(
+          j, {std::make_pair("y", (i * 37 + j * 11) % 100)}));
+    }
+    WriteFile(files.back(), records);
+  }
+
+  AggregatorOutput want;
+  ASSERT_EQ(a_.Aggregate(HelperCreateAggregatorInput(files), &want), "");
+
+  Aggregator a(mako::internal::RunningStats::Config::Sketch(),
+               kDefaultMaxThreads, kDefaultBufferSize);
+  a.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+  AggregatorOutput got;
+  ASSERT_EQ(a.Aggregate(HelperCreateAggregatorInput(files), &got), "");
+
+  ASSERT_EQ(got.aggregate().metric_aggregate_list_size(), 1);
+  const mako::MetricAggregate& want_ma =
+      want.aggregate().metric_aggregate_list(0);
+  const mako::MetricAggregate& got_ma =
+      got.aggregate().metric_aggregate_list(0);
+  EXPECT_EQ(100, got_ma.count());
+  EXPECT_NEAR(want_ma.mean(), got_ma.mean(), 0.000001);
+  EXPECT_NEAR(want_ma.median(), got_ma.median(), 0.000001);
+  EXPECT_NEAR(want_ma.median_absolute_deviation(),
+              got_ma.median_absolute_deviation(), 0.000001);
+  ASSERT_EQ(want_ma.percentile_list_size(), got_ma.percentile_list_size());
+  for (int i = 0; i < got_ma.percentile_list_size(); ++i) {
+    EXPECT_NEAR(want_ma.percentile_list(i), got_ma.percentile_list(i),
+                0.000001);
+  }
+}
+
+TEST_F(StandardAggregatorTest, HistogramMetric) {
+  // Integer values below the histogram's bucket precision are counted exactly,
+  // so the histogram-backed metric must agree with the sample-backed one.
+  std::vector<std::string> files;
+  for (int i = 0; i < 10; ++i) {
+    files.push_back(absl::StrCat("file", i));
+    std::vector<mako::SampleRecord> records;
+    for (int j = 0; j < 10; ++j) {
+      double value = (i * 37 + j * 11) % 100;
+      records.push_back(HelperCreateSampleRecord(
+          j, {std::make_pair("y", value), std::make_pair("z", value)}));
+    }
+    WriteFile(files.back(), records);
+  }
+
+  mako::AggregatorInput ai = HelperCreateAggregatorInput(files);
+  auto* metric = ai.mutable_standard_aggregator_options()
+                     ->add_histogram_metric_list();
+  metric->set_value_key("z");
+  metric->set_highest_trackable_value(1000);
+  AggregatorOutput out;
+  ASSERT_EQ(a_.Aggregate(ai, &out), "");
+
+  ASSERT_EQ(out.aggregate().metric_aggregate_list_size(), 2);
+  const mako::MetricAggregate& want_ma =
+      out.aggregate().metric_aggregate_list(0);
+  const mako::MetricAggregate& got_ma =
+      out.aggregate().metric_aggregate_list(1);
+  ASSERT_EQ("y", want_ma.metric_key());
+  ASSERT_EQ("z", got_ma.metric_key());
+  EXPECT_EQ(100, got_ma.count());
+  EXPECT_EQ(want_ma.min(), got_ma.min());
+  EXPECT_EQ(want_ma.max(), got_ma.max());
+  EXPECT_NEAR(want_ma.mean(), got_ma.mean(), 0.000001);
+  EXPECT_NEAR(want_ma.standard_deviation(), got_ma.standard_deviation(),
+              0.000001);
+  EXPECT_EQ(want_ma.median(), got_ma.median());
+  EXPECT_EQ(want_ma.median_absolute_deviation(),
+            got_ma.median_absolute_deviation());
+  ASSERT_EQ(want_ma.percentile_list_size(), got_ma.percentile_list_size());
+  for (int i = 0; i < got_ma.percentile_list_size(); ++i) {
+    EXPECT_EQ(want_ma.percentile_list(i), got_ma.percentile_list(i));
+  }
+}
+
+TEST_F(StandardAggregatorTest, BadHistogramMetric) {
+  WriteFile("file1", {HelperCreateSampleRecord(1, {std::make_pair("y", 1)})});
+  AggregatorOutput out;
+
+  mako::AggregatorInput ai = HelperCreateAggregatorInput({"file1"});
+  auto* metric = ai.mutable_standard_aggregator_options()
+                     ->add_histogram_metric_list();
+  metric->set_value_key("y");
+  ASSERT_NE(a_.Aggregate(ai, &out), "");
+  metric->set_highest_trackable_value(1000);
+  metric->set_significant_digits(9);
+  ASSERT_NE(a_.Aggregate(ai, &out), "");
+  metric->set_significant_digits(2);
+  ASSERT_EQ(a_.Aggregate(ai, &out), "");
+  *ai.mutable_standard_aggregator_options()->add_histogram_metric_list() =
+      *metric;
+  ASSERT_NE(a_.Aggregate(ai, &out), "");
+}
+
+TEST_F(StandardAggregatorTest, ParallelMatchesSerial) {
+  // Each file is aggregated separately and merged, so results must not depend
+  // on how many threads process the files. Metric "y" is in every file, while
+  // "odd" is only in some, and "even" only in the others.
+  std::vector<std::string> files;
+  for (int i = 0; i < 20; ++i) {
+    files.push_back(absl::StrCat("file", i));
+    std::vector<mako::SampleRecord> records;
+    for (int j = 0; j < 50; ++j) {
+      records.push_back(HelperCreateSampleRecord(
+          j, {std::make_pair("y", (i * 37 + j * 11) % 101 - 50),
+              std::make_pair(i % 2 ? "odd" : "even", i * 50 + j)}));
+    }
+    WriteFile(files.back(), records);
+  }
+
+  Aggregator serial(-1, 1, kDefaultBufferSize);
+  serial.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+  AggregatorOutput want;
+  ASSERT_EQ(serial.Aggregate(HelperCreateAggregatorInput(files), &want), "");
+
+  Aggregator parallel(-1, 8, kDefaultBufferSize);
+  parallel.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+  AggregatorOutput got;
+  ASSERT_EQ(parallel.Aggregate(HelperCreateAggregatorInput(files), &got), "");
+
+  ASSERT_EQ(3, got.aggregate().metric_aggregate_list_size());
+  ASSERT_EQ(want.aggregate().metric_aggregate_list_size(),
+            got.aggregate().metric_aggregate_list_size());
+  for (int i = 0; i < got.aggregate().metric_aggregate_list_size(); ++i) {
+    const mako::MetricAggregate& want_ma =
+        want.aggregate().metric_aggregate_list(i);
+    const mako::MetricAggregate& got_ma =
+        got.aggregate().metric_aggregate_list(i);
+    SCOPED_TRACE(got_ma.metric_key());
+    EXPECT_EQ(want_ma.metric_key(), got_ma.metric_key());
+    EXPECT_EQ(want_ma.count(), got_ma.count());
+    EXPECT_EQ(want_ma.min(), got_ma.min());
+    EXPECT_EQ(want_ma.max(), got_ma.max());
+    EXPECT_NEAR(want_ma.mean(), got_ma.mean(), 1e-9);
+    EXPECT_NEAR(want_ma.standard_deviation(), got_ma.standard_deviation(),
+                1e-9);
+    EXPECT_EQ(want_ma.median(), got_ma.median());
+    EXPECT_EQ(want_ma.median_absolute_deviation(),
+              got_ma.median_absolute_deviation());
+    EXPECT_THAT(got_ma.percentile_list(),
+                ::testing::ElementsAreArray(want_ma.percentile_list()));
+  }
+  EXPECT_EQ(want.aggregate().run_aggregate().usable_sample_count(),
+            got.aggregate().run_aggregate().usable_sample_count());
+}
+
+TEST_F(StandardAggregatorTest, SingleLargeFile) {
+  // A single file is split into chunks processed by several threads, which
+  // must give the same results as processing it on one thread.
+  std::vector<mako::SampleRecord> records;
+  for (int i = 0; i < 25000; ++i) {
+    records.push_back(HelperCreateSampleRecord(
+        i % 50, {std::make_pair("y", (i * 37) % 1001 - 500),
+                 std::make_pair(i % 3 ? "a" : "b", i)}));
+    if (i % 100 == 0) {
+      records.push_back(HelperCreateSampleError(i % 50, "error"));
+    }
+  }
+  WriteFile("large_file", records);
+  AggregatorInput input = HelperCreateAggregatorInput({"large_file"});
+
+  Aggregator serial(-1, 1, kDefaultBufferSize);
+  serial.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+  AggregatorOutput want;
+  ASSERT_EQ(serial.Aggregate(input, &want), "");
+
+  for (int max_threads : {2, 4, 0}) {
+    SCOPED_TRACE(max_threads);
+    Aggregator parallel(-1, max_threads, kDefaultBufferSize);
+    parallel.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+    AggregatorOutput got;
+    ASSERT_EQ(parallel.Aggregate(input, &got), "");
+
+    const auto& want_run = want.aggregate().run_aggregate();
+    const auto& got_run = got.aggregate().run_aggregate();
+    EXPECT_EQ(want_run.usable_sample_count(), got_run.usable_sample_count());
+    EXPECT_EQ(want_run.ignore_sample_count(), got_run.ignore_sample_count());
+    EXPECT_EQ(want_run.error_sample_count(), got_run.error_sample_count());
+    ASSERT_EQ(3, got.aggregate().metric_aggregate_list_size());
+    for (int i = 0; i < got.aggregate().metric_aggregate_list_size(); ++i) {
+      const mako::MetricAggregate& want_ma =
+          want.aggregate().metric_aggregate_list(i);
+      const mako::MetricAggregate& got_ma =
+          got.aggregate().metric_aggregate_list(i);
+      EXPECT_EQ(want_ma.metric_key(), got_ma.metric_key());
+      EXPECT_EQ(want_ma.count(), got_ma.count());
+      EXPECT_NEAR(want_ma.mean(), got_ma.mean(), 1e-6);
+      EXPECT_NEAR(want_ma.standard_deviation(), got_ma.standard_deviation(),
+                  1e-6);
+      EXPECT_EQ(want_ma.median(), got_ma.median());
+      EXPECT_THAT(got_ma.percentile_list(),
+                  ::testing::ElementsAreArray(want_ma.percentile_list()));
+    }
+  }
+}
+
+TEST_F(StandardAggregatorTest, ColumnsFileMatchesRecordsFile) {
+  // Blocks of records stored by column are aggregated a column at a time,
+  // which must give the same results as aggregating the records.
+  std::vector<mako::SampleRecord> records;
+  for (int i = 0; i < 5000; ++i) {
+    records.push_back(HelperCreateSampleRecord(
+        i % 60, {std::make_pair("y", (i * 37) % 1001 - 500),
+                 std::make_pair(i % 3 ? "a" : "b", i)}));
+    if (i % 100 == 0) {
+      records.push_back(HelperCreateSampleError(i % 60, "error"));
+    }
+  }
+  WriteFile("records_file", records);
+  WriteColumnsFile("columns_file", records, /*records_per_block=*/700);
+
+  for (int max_threads : {1, 4}) {
+    SCOPED_TRACE(max_threads);
+    Aggregator from_records(-1, max_threads, kDefaultBufferSize);
+    from_records.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+    AggregatorOutput want;
+    ASSERT_EQ(from_records.Aggregate(
+                  HelperCreateAggregatorInput({"records_file"}), &want),
+              "");
+    Aggregator from_columns(-1, max_threads, kDefaultBufferSize);
+    from_columns.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+    AggregatorOutput got;
+    ASSERT_EQ(from_columns.Aggregate(
+                  HelperCreateAggregatorInput({"columns_file"}), &got),
+              "");
+
+    const auto& want_run = want.aggregate().run_aggregate();
+    const auto& got_run = got.aggregate().run_aggregate();
+    EXPECT_GT(got_run.ignore_sample_count(), 0);
+    EXPECT_EQ(want_run.usable_sample_count(), got_run.usable_sample_count());
+    EXPECT_EQ(want_run.ignore_sample_count(), got_run.ignore_sample_count());
+    EXPECT_EQ(want_run.error_sample_count(), got_run.error_sample_count());
+    ASSERT_EQ(3, got.aggregate().metric_aggregate_list_size());
+    for (int i = 0; i < got.aggregate().metric_aggregate_list_size(); ++i) {
+      const mako::MetricAggregate& want_ma =
+          want.aggregate().metric_aggregate_list(i);
+      const mako::MetricAggregate& got_ma =
+          got.aggregate().metric_aggregate_list(i);
+      EXPECT_EQ(want_ma.metric_key(), got_ma.metric_key());
+      EXPECT_EQ(want_ma.count(), got_ma.count());
+      EXPECT_EQ(want_ma.min(), got_ma.min());
+      EXPECT_EQ(want_ma.max(), got_ma.max());
+      EXPECT_NEAR(want_ma.mean(), got_ma.mean(), 1e-6);
+      EXPECT_NEAR(want_ma.standard_deviation(), got_ma.standard_deviation(),
+                  1e-6);
+      EXPECT_EQ(want_ma.median(), got_ma.median());
+      EXPECT_THAT(got_ma.percentile_list(),
+                  ::testing::ElementsAreArray(want_ma.percentile_list()));
+    }
+  }
+}
+
 TEST_F(StandardAggregatorTest, AggregateMultipleTimes) {
   AggregatorOutput out;
 
@@ -514,6 +833,19 @@ TEST_F(StandardAggregatorTest, AggregateMultipleTimes) {
   ASSERT_EQ(out.aggregate().metric_aggregate_list(0).mean(), 100);
 }
 
+TEST_F(StandardAggregatorTest, FileIOReadErrorIsReturned) {
+  std::string read_error = "read error";
+  auto memory_fileio = absl::make_unique<mako::memory_fileio::FileIO>();
+  memory_fileio->set_read_error(read_error);
+  a_.SetFileIO(std::move(memory_fileio));
+
+  AggregatorOutput out;
+  WriteFile("file1", {HelperCreateSampleRecord(1, {std::make_pair("y", 100)})});
+
+  EXPECT_THAT(a_.Aggregate(HelperCreateAggregatorInput({"file1"}), &out),
+              ContainsRegex(absl::StrFormat(".*%s.*", read_error)));
+}
+
 TEST_F(StandardAggregatorTest, FileIOCloseErrorIsReturned) {
   std::string close_error = "close error";
   auto memory_fileio = absl::make_unique<mako::memory_fileio::FileIO>();
@@ -528,6 +860,26 @@ TEST_F(StandardAggregatorTest, FileIOCloseErrorIsReturned) {
               ContainsRegex(absl::StrFormat(".*%s.*", close_error)));
 }
 
+// Aggregates a single file of 100000 records on state.range(0) threads.
+static void BM_AggregateSingleFile(benchmark::State& state) {
+  constexpr int kNumRecords = 100000;
+  std::vector<mako::SampleRecord> records;
+  for (int i = 0; i < kNumRecords; ++i) {
+    records.push_back(HelperCreateSampleRecord(
+        i, {std::make_pair("y", (i * 37) % 1001), std::make_pair("z", i)}));
+  }
+  WriteFile("bm_file", records);
+  const AggregatorInput input = HelperCreateAggregatorInput({"bm_file"});
+  for (auto _ : state) {
+    Aggregator aggregator(-1, state.range(0), kDefaultBufferSize);
+    aggregator.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+    AggregatorOutput output;
+    CHECK_EQ("", aggregator.Aggregate(input, &output));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRecords);
+}
+BENCHMARK(BM_AggregateSingleFile)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
 }  // namespace
 }  // namespace aggregator
 }  // namespace mako
@@ -18,67 +18,161 @@
 #include <string>
 #include <vector>
 
+#include "absl/memory/memory.h"
 #include "absl/synchronization/mutex.h"
+#include "cxx/internal/hdr_running_stats.h"
 #include "cxx/internal/pgmath.h"
 
 namespace mako {
 namespace aggregator {
 
+// Keeps the stats of a metric in either a RunningStats or, for metrics with a
+// known range, an HdrRunningStats.
 class ThreadsafeRunningStats {
  public:
-  explicit ThreadsafeRunningStats(const int max_sample_size):
-    // We only need a Random instance when max_sample_size > 0. They're somewhat
-    // heavyweight, so if max_sample_size <= 0, don't bother creating it.
-    random_(max_sample_size > 0 ? new mako::internal::Random : nullptr),
-    rs_(mako::internal::RunningStats::Config{
-      max_sample_size, random_.get()}) {}
+  using Error = mako::internal::RunningStats::Error;
+  using Result = mako::internal::RunningStats::Result;
+
+  explicit ThreadsafeRunningStats(const int max_sample_size)
+      : ThreadsafeRunningStats(mako::internal::RunningStats::Config{
+            max_sample_size, nullptr}) {}
+
+  // Any Random in config is ignored; this instance creates its own if needed.
+  explicit ThreadsafeRunningStats(
+      const mako::internal::RunningStats::Config& config)
+      // We only need a Random instance when keeping a bounded sample. They're
+      // somewhat heavyweight, so otherwise don't bother creating it.
+      : random_(config.max_sample_size > 0 && config.sketch_k <= 0
+                    ? new mako::internal::Random
+                    : nullptr),
+        rs_(WithRandom(config, random_.get())) {}
+
+  // Keeps the stats in a histogram. The config must be valid.
+  explicit ThreadsafeRunningStats(
+      const mako::internal::HdrRunningStats::Config& config)
+      : rs_(mako::internal::RunningStats::Config{0, nullptr}),
+        hdr_(absl::make_unique<mako::internal::HdrRunningStats>(config)) {}
 
   std::string AddVector(const std::vector<double>& values) {
     absl::MutexLock l(&mutex_);
+    if (hdr_) {
+      hdr_->AddVector(values);
+      return "";
+    }
     return rs_.AddVector(values);
   }
 
-  mako::internal::RunningStats::Result Count() const {
-    return rs_.Count();
+  Result Count() const {
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Count)
+                : rs_.Count();
   }
 
-  mako::internal::RunningStats::Result Min() const {
-    return rs_.Min();
+  Result Min() const {
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Min) : rs_.Min();
   }
 
-  mako::internal::RunningStats::Result Max() const {
-    return rs_.Max();
+  Result Max() const {
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Max) : rs_.Max();
   }
 
-  mako::internal::RunningStats::Result Mean() const {
-    return rs_.Mean();
+  Result Mean() const {
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Mean)
+                : rs_.Mean();
   }
 
-  mako::internal::RunningStats::Result Median() {
+  Result Median() {
     absl::MutexLock l(&mutex_);
-    return rs_.Median();
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Median)
+                : rs_.Median();
   }
 
-  mako::internal::RunningStats::Result Stddev() const {
-    return rs_.Stddev();
+  Result Stddev() const {
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Stddev)
+                : rs_.Stddev();
   }
 
-  mako::internal::RunningStats::Result Mad() {
+  Result Mad() {
     absl::MutexLock l(&mutex_);
-    return rs_.Mad();
+    return hdr_ ? ToResult(&mako::internal::HdrRunningStats::Mad) : rs_.Mad();
   }
 
-  mako::internal::RunningStats::Result Percentile(double pct) {
+  Result Percentile(double pct) {
     absl::MutexLock l(&mutex_);
+    if (hdr_) {
+      Result r;
+      r.error = mako::internal::RunningStats::ErrorMessage(
+          hdr_->Percentile(pct, &r.value));
+      return r;
+    }
     return rs_.Percentile(pct);
   }
 
+  // Merges all values added to other into this. other must not be modified
+  // concurrently, and must keep its stats the same way.
+  std::string Merge(const ThreadsafeRunningStats& other) {
+    absl::MutexLock l(&mutex_);
+    if (!hdr_ != !other.hdr_) {
+      return mako::internal::RunningStats::ErrorMessage(
+          Error::kMergeDifferentConfigs);
+    }
+    if (hdr_) {
+      return mako::internal::RunningStats::ErrorMessage(
+          hdr_->Merge(*other.hdr_));
+    }
+    return rs_.Merge(other.rs_);
+  }
+
+  // Allocation-free forms of the above; see RunningStats.
+  Error Count(double* value) const {
+    return hdr_ ? hdr_->Count(value) : rs_.Count(value);
+  }
+
+  Error Min(double* value) const {
+    return hdr_ ? hdr_->Min(value) : rs_.Min(value);
+  }
+
+  Error Max(double* value) const {
+    return hdr_ ? hdr_->Max(value) : rs_.Max(value);
+  }
+
+  Error Mean(double* value) const {
+    return hdr_ ? hdr_->Mean(value) : rs_.Mean(value);
+  }
+
+  Error Stddev(double* value) const {
+    return hdr_ ? hdr_->Stddev(value) : rs_.Stddev(value);
+  }
+
+  Error Summarize(const std::vector<double>& pcts,
+                  mako::internal::RunningStats::Summary* summary) {
+    absl::MutexLock l(&mutex_);
+    return hdr_ ? hdr_->Summarize(pcts, summary)
+                : rs_.Summarize(pcts, summary);
+  }
+
  private:
-  // Used to synchronize calls that modify rs_. The const methods are safe to
-  // call concurrently, so no synchronization is needed there.
+  static mako::internal::RunningStats::Config WithRandom(
+      mako::internal::RunningStats::Config config,
+      mako::internal::Random* random) {
+    config.random = random;
+    return config;
+  }
+
+  Result ToResult(Error (mako::internal::HdrRunningStats::*getter)(double*)
+                      const) const {
+    Result r;
+    r.error =
+        mako::internal::RunningStats::ErrorMessage(((*hdr_).*getter)(&r.value));
+    return r;
+  }
+
+  // Used to synchronize calls that modify rs_ or hdr_. The const methods are
+  // safe to call concurrently, so no synchronization is needed there.
   absl::Mutex mutex_;
   std::unique_ptr<mako::internal::Random> random_;
   mako::internal::RunningStats rs_;
+  // Set when the stats are kept in a histogram, in which case rs_ is unused.
+  std::unique_ptr<mako::internal::HdrRunningStats> hdr_;
 };
 }  // namespace aggregator
 }  // namespace mako
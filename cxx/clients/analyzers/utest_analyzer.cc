@@ -357,10 +357,10 @@ StatsCalculator::Statistics StatsCalculator::GetStats(
   mako::internal::RunningStats a_stats;
   mako::internal::RunningStats b_stats;
   for (auto a : sample_a) {
-    a_stats.Add(a + shift_value);
+    a_stats.TryAdd(a + shift_value);
   }
   for (auto b : sample_b) {
-    b_stats.Add(b);
+    b_stats.TryAdd(b);
   }
 
   // Return relevant data
@@ -371,15 +371,9 @@ StatsCalculator::Statistics StatsCalculator::GetStats(
   stats.rank_b = rank_b;
   stats.tie_counts = tie_counts;
 
-  mako::internal::RunningStats::Result result;
-  result = a_stats.Median();
-  if (result.error.empty()) {
-    stats.median_a = result.value;
-  }
-  result = b_stats.Median();
-  if (result.error.empty()) {
-    stats.median_b = result.value;
-  }
+  // Each median is left unchanged if it cannot be computed.
+  a_stats.Median(&stats.median_a);
+  b_stats.Median(&stats.median_b);
 
   return stats;
 }
@@ -135,54 +135,56 @@ std::string ComputeStats(const std::vector<internal::RunData>& data,
   mako::internal::RunningStats historic_stats;
   mako::internal::RunningStats recent_stats;
   for (const auto& d : historic_data) {
-    historic_stats.Add(d.value);
+    historic_stats.TryAdd(d.value);
   }
   for (const auto& d : recent_data) {
-    recent_stats.Add(d.value);
+    recent_stats.TryAdd(d.value);
   }
-  mako::internal::RunningStats::Result result;
+  using mako::internal::RunningStats;
+  RunningStats::Error error;
+  double value;
 
   // historic_mean
-  result = historic_stats.Mean();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing historic mean: ", result.error);
+  error = historic_stats.Mean(&value);
+  if (error != RunningStats::Error::kOk) {
+    return absl::StrCat("Failure computing historic mean: ",
+                        RunningStats::ErrorMessage(error));
   }
-  output->set_historic_mean(result.value);
-
-  // historic_median
-  result = historic_stats.Median();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing historic median: ", result.error);
+  output->set_historic_mean(value);
+
+  // historic_median and historic_mad
+  RunningStats::Summary summary;
+  error = historic_stats.Summarize({}, &summary);
+  if (error != RunningStats::Error::kOk) {
+    return absl::StrCat("Failure computing historic median and MAD: ",
+                        RunningStats::ErrorMessage(error));
   }
-  output->set_historic_median(result.value);
+  output->set_historic_median(summary.median);
+  output->set_historic_mad(summary.mad);
 
   // historic_stddev
-  result = historic_stats.Stddev();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing historic stddev: ", result.error);
-  }
-  output->set_historic_stddev(result.value);
-
-  // historic_mad
-  result = historic_stats.Mad();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing historic MAD: ", result.error);
+  error = historic_stats.Stddev(&value);
+  if (error != RunningStats::Error::kOk) {
+    return absl::StrCat("Failure computing historic stddev: ",
+                        RunningStats::ErrorMessage(error));
   }
-  output->set_historic_mad(result.value);
+  output->set_historic_stddev(value);
 
   // recent_mean
-  result = recent_stats.Mean();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing recent mean: ", result.error);
+  error = recent_stats.Mean(&value);
+  if (error != RunningStats::Error::kOk) {
+    return absl::StrCat("Failure computing recent mean: ",
+                        RunningStats::ErrorMessage(error));
   }
-  output->set_recent_mean(result.value);
+  output->set_recent_mean(value);
 
   // recent_median
-  result = recent_stats.Median();
-  if (!result.error.empty()) {
-    return absl::StrCat("Failure computing recent median: ", result.error);
+  error = recent_stats.Median(&value);
+  if (error != RunningStats::Error::kOk) {
+    return absl::StrCat("Failure computing recent median: ",
+                        RunningStats::ErrorMessage(error));
   }
-  output->set_recent_median(result.value);
+  output->set_recent_median(value);
 
   // deltas
   output->set_delta_mean(output->recent_mean() - output->historic_mean());
@@ -0,0 +1,115 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/clients/downsampler/largest_triangles.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "glog/logging.h"
+
+namespace mako {
+namespace downsampler {
+
+std::vector<size_t> LargestTriangleThreeBuckets(const std::vector<double>& x,
+                                                const std::vector<double>& y,
+                                                size_t series_count,
+                                                size_t count) {
+  const size_t n = x.size();
+  CHECK_EQ(y.size(), n * series_count);
+  std::vector<size_t> kept;
+  if (count >= n) {
+    kept.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      kept.push_back(i);
+    }
+    return kept;
+  }
+  if (count == 0) {
+    return kept;
+  }
+  kept.reserve(count);
+  kept.push_back(0);
+  if (count == 1) {
+    return kept;
+  }
+
+  // Scale each series to a unit range, so its triangles are comparable.
+  std::vector<double> scale(series_count, 0);
+  for (size_t s = 0; s < series_count; ++s) {
+    double min = y[s];
+    double max = y[s];
+    for (size_t i = 1; i < n; ++i) {
+      min = std::min(min, y[i * series_count + s]);
+      max = std::max(max, y[i * series_count + s]);
+    }
+    if (max > min) {
+      scale[s] = 1 / (max - min);
+    }
+  }
+
+  // Bucket b, for b in [0, count - 2), holds the points in
+  // [bucket_begin(b), bucket_begin(b + 1)).
+  const size_t bucket_count = count - 2;
+  auto bucket_begin = [n, bucket_count](size_t b) {
+    return 1 + b * (n - 2) / bucket_count;
+  };
+  std::vector<double> next_average(series_count);
+  size_t previous = 0;
+  for (size_t b = 0; b < bucket_count; ++b) {
+    const size_t begin = bucket_begin(b);
+    const size_t end = bucket_begin(b + 1);
+    // The third corner of the triangles is the average of the next bucket, or
+    // the last point after the last bucket.
+    const size_t next_begin = end;
+    const size_t next_end = b + 1 < bucket_count ? bucket_begin(b + 2) : n;
+    double next_x = 0;
+    std::fill(next_average.begin(), next_average.end(), 0);
+    for (size_t i = next_begin; i < next_end; ++i) {
+      next_x += x[i];
+      for (size_t s = 0; s < series_count; ++s) {
+        next_average[s] += y[i * series_count + s];
+      }
+    }
+    const double next_size = next_end - next_begin;
+    next_x /= next_size;
+    for (double& average : next_average) {
+      average /= next_size;
+    }
+
+    size_t chosen = begin;
+    double chosen_area = -1;
+    for (size_t i = begin; i < end; ++i) {
+      // Twice the area of the triangle, which orders them the same.
+      double area = 0;
+      for (size_t s = 0; s < series_count; ++s) {
+        const double previous_y = y[previous * series_count + s];
+        area += scale[s] *
+                std::abs((x[previous] - next_x) *
+                             (y[i * series_count + s] - previous_y) -
+                         (x[previous] - x[i]) * (next_average[s] - previous_y));
+      }
+      if (area > chosen_area) {
+        chosen_area = area;
+        chosen = i;
+      }
+    }
+    kept.push_back(chosen);
+    previous = chosen;
+  }
+  kept.push_back(n - 1);
+  return kept;
+}
+
+}  // namespace downsampler
+}  // namespace mako
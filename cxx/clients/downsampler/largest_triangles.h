@@ -0,0 +1,50 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+
+// Largest-Triangle-Three-Buckets (LTTB) selection of the points of a series
+// that best preserve its shape when charted.
+#ifndef CXX_CLIENTS_DOWNSAMPLER_LARGEST_TRIANGLES_H_
+#define CXX_CLIENTS_DOWNSAMPLER_LARGEST_TRIANGLES_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace mako {
+namespace downsampler {
+
+// Returns the indices, in ascending order, of count points chosen by
+// Largest-Triangle-Three-Buckets (Steinarsson, 2013). The first and last
+// points are always kept. The points between them are split into count - 2
+// buckets of consecutive points, and from each bucket the point forming the
+// largest triangle with the point kept from the previous bucket and the average
+// of the next bucket is kept. Unlike a random sample, this keeps spikes and
+// covers the x axis evenly. O(n) in the number of points.
+//
+// x holds the x value of each point, in ascending order. A point may have
+// several y values (e.g. one per metric of a SamplePoint): y holds
+// series_count values for each point, point by point. The triangles of the
+// series are summed, each scaled by the range of its series so that no series
+// dominates by its units.
+//
+// If count is at least the number of points, all of them are returned.
+std::vector<size_t> LargestTriangleThreeBuckets(const std::vector<double>& x,
+                                                const std::vector<double>& y,
+                                                size_t series_count,
+                                                size_t count);
+
+}  // namespace downsampler
+}  // namespace mako
+
+#endif  // CXX_CLIENTS_DOWNSAMPLER_LARGEST_TRIANGLES_H_
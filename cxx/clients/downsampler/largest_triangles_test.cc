@@ -0,0 +1,93 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/clients/downsampler/largest_triangles.h"
+
+#include <algorithm>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace mako {
+namespace downsampler {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+std::vector<double> Range(int n) {
+  std::vector<double> x;
+  for (int i = 0; i < n; ++i) {
+    x.push_back(i);
+  }
+  return x;
+}
+
+TEST(LargestTriangleThreeBucketsTest, KeepsAllWhenCountIsLarge) {
+  std::vector<double> x = Range(4);
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, x, 1, 4), ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, x, 1, 10),
+              ElementsAre(0, 1, 2, 3));
+}
+
+TEST(LargestTriangleThreeBucketsTest, SmallCounts) {
+  std::vector<double> x = Range(10);
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, x, 1, 0), IsEmpty());
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, x, 1, 1), ElementsAre(0));
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, x, 1, 2), ElementsAre(0, 9));
+}
+
+TEST(LargestTriangleThreeBucketsTest, Empty) {
+  EXPECT_THAT(LargestTriangleThreeBuckets({}, {}, 1, 5), IsEmpty());
+}
+
+TEST(LargestTriangleThreeBucketsTest, KeepsSpikes) {
+  std::vector<double> x = Range(100);
+  std::vector<double> y(100, 1);
+  y[37] = 50;
+  y[71] = -20;
+  std::vector<size_t> kept = LargestTriangleThreeBuckets(x, y, 1, 10);
+  ASSERT_EQ(10, kept.size());
+  EXPECT_EQ(0, kept.front());
+  EXPECT_EQ(99, kept.back());
+  EXPECT_NE(kept.end(), std::find(kept.begin(), kept.end(), 37));
+  EXPECT_NE(kept.end(), std::find(kept.begin(), kept.end(), 71));
+  EXPECT_TRUE(std::is_sorted(kept.begin(), kept.end()));
+}
+
+TEST(LargestTriangleThreeBucketsTest, CoversXAxisEvenly) {
+  // A straight line has no preferred points, so one is kept from each bucket.
+  std::vector<double> x = Range(1000);
+  std::vector<size_t> kept = LargestTriangleThreeBuckets(x, x, 1, 12);
+  ASSERT_EQ(12, kept.size());
+  for (size_t b = 0; b < 10; ++b) {
+    EXPECT_GE(kept[b + 1], 1 + b * 998 / 10);
+    EXPECT_LT(kept[b + 1], 1 + (b + 1) * 998 / 10);
+  }
+}
+
+TEST(LargestTriangleThreeBucketsTest, SeriesAreScaled) {
+  // The second series' spike at x = 2 is far larger than the first series'
+  // spike at x = 3, but smaller relative to the range of its series.
+  std::vector<double> x = Range(5);
+  std::vector<double> y = {0, 1000,  //
+                           0, 900,   //
+                           0, 1100,  //
+                           1, 1000,  //
+                           0, 1000};
+  EXPECT_THAT(LargestTriangleThreeBuckets(x, y, 2, 3), ElementsAre(0, 3, 4));
+}
+
+}  // namespace
+}  // namespace downsampler
+}  // namespace mako
@@ -15,47 +15,162 @@
 #define CXX_CLIENTS_DOWNSAMPLER_METRIC_SET_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
-#include <forward_list>
+#include <algorithm>
 #include <string>
+#include <vector>
 
+#include "absl/container/inlined_vector.h"
+#include "absl/hash/hash.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
 #include "spec/proto/mako.pb.h"
 
 namespace mako {
 namespace downsampler {
 
+namespace metric_set_internal {
+
+// Spreads the bits of a hash, so that sums of hashes are well distributed
+// (the splitmix64 finalizer).
+inline uint64_t Mix(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+inline uint64_t KeyHash(absl::string_view key) {
+  return Mix(absl::Hash<absl::string_view>()(key));
+}
+
+}  // namespace metric_set_internal
+
+// Returns a signature of the metric keys of a sample point, which doesn't
+// depend on their order: a point with metrics m1 & m2 has the same signature as
+// a point with metrics m2 & m1. Computing it doesn't allocate.
+//
+// Signatures are only meaningful within a process. Different sets of keys may
+// have the same signature, so use MetricSet::Matches to tell them apart.
+inline uint64_t MetricSetSignature(const mako::SamplePoint& point) {
+  // A sum, rather than xor, so that repeated keys don't cancel out.
+  uint64_t sum = 0;
+  for (const auto& kv : point.metric_value_list()) {
+    sum += metric_set_internal::KeyHash(kv.value_key());
+  }
+  return metric_set_internal::Mix(sum + point.metric_value_list_size());
+}
+
+// Returns a signature of the sampler of a sample error.
+inline uint64_t MetricSetSignature(const mako::SampleError& error) {
+  return metric_set_internal::Mix(
+      metric_set_internal::KeyHash(error.sampler_name()) + 1);
+}
+
+// Returns the number of slots taken by a record. See standard_downsampler.h.
+inline int SlotCount(const mako::SamplePoint& point) {
+  return point.metric_value_list_size();
+}
+
+inline int SlotCount(const mako::SampleError& error) { return 1; }
+
 // Metric keys for a sample point sorted  by name so that a point with metrics
 // m1 & m2 is the same as a point with metrics m2 & m1.
-inline std::string GetKey(mako::SamplePoint* point) {
-  // Microbenchmarks showed std::forward_list to be most performant here.
-  // If we increase maximum number of metrics allowed we will want to revisit
-  // this.
-  std::forward_list<std::string> keys;
-  for (const auto& kv : point->metric_value_list()) {
-    keys.push_front(kv.value_key());
+inline std::vector<std::string> GetSortedKeys(const mako::SamplePoint& point) {
+  std::vector<std::string> keys;
+  keys.reserve(point.metric_value_list_size());
+  for (const auto& kv : point.metric_value_list()) {
+    keys.push_back(kv.value_key());
   }
-  keys.sort();
-  return absl::StrJoin(keys, ",");
+  std::sort(keys.begin(), keys.end());
+  return keys;
 }
 
+// The set of metric keys (or the sampler) of a group of records.
+//
+// Building one allocates, so it is meant to be built once per distinct set and
+// then found by signature.
 struct MetricSet {
+  // The number of metrics up to which Matches doesn't allocate.
+  static constexpr int kInlineKeys = 64;
+
   explicit MetricSet(mako::SamplePoint* point)
-      : slot_count(point->metric_value_list_size()), key(GetKey(point)) {}
+      : slot_count(SlotCount(*point)),
+        sorted_keys(GetSortedKeys(*point)),
+        has_duplicate_keys(std::adjacent_find(sorted_keys.begin(),
+                                              sorted_keys.end()) !=
+                           sorted_keys.end()),
+        key(absl::StrJoin(sorted_keys, ",")),
+        signature(MetricSetSignature(*point)) {}
   explicit MetricSet(mako::SampleError* error)
-      : slot_count(1), key(error->sampler_name()) {}
+      : slot_count(SlotCount(*error)),
+        sorted_keys({error->sampler_name()}),
+        has_duplicate_keys(false),
+        key(error->sampler_name()),
+        signature(MetricSetSignature(*error)) {}
+
+  // Returns whether a record, whose signature is point_signature, belongs to
+  // this set. The signatures are compared first, so this is cheap for records
+  // that don't. It only allocates for sets of more than kInlineKeys metrics.
+  bool Matches(const mako::SamplePoint& point,
+               uint64_t point_signature) const {
+    if (signature != point_signature || slot_count != SlotCount(point)) {
+      return false;
+    }
+    const auto& values = point.metric_value_list();
+    if (has_duplicate_keys) {
+      // Compare the keys as multisets.
+      absl::InlinedVector<absl::string_view, kInlineKeys> point_keys;
+      point_keys.reserve(values.size());
+      for (const auto& kv : values) {
+        point_keys.push_back(kv.value_key());
+      }
+      std::sort(point_keys.begin(), point_keys.end());
+      return std::equal(point_keys.begin(), point_keys.end(),
+                        sorted_keys.begin());
+    }
+    // Each key of point must be a distinct key of sorted_keys; as the sizes
+    // are equal, the sets then are too.
+    absl::InlinedVector<bool, kInlineKeys> seen(sorted_keys.size());
+    for (const auto& kv : values) {
+      auto it = std::lower_bound(sorted_keys.begin(), sorted_keys.end(),
+                                 kv.value_key());
+      if (it == sorted_keys.end() || *it != kv.value_key()) {
+        return false;
+      }
+      auto index = it - sorted_keys.begin();
+      if (seen[index]) {
+        return false;
+      }
+      seen[index] = true;
+    }
+    return true;
+  }
+  bool Matches(const mako::SampleError& error,
+               uint64_t error_signature) const {
+    return signature == error_signature && key == error.sampler_name();
+  }
 
   std::string ToString() const {
     return absl::StrCat("MetricSet{key=", key, ",slot_count=", slot_count, "}");
   }
 
   const int slot_count;
+  const std::vector<std::string> sorted_keys;
+  // Whether sorted_keys holds some key more than once.
+  const bool has_duplicate_keys;
+  // sorted_keys joined by ",", for display.
   const std::string key;
+  const uint64_t signature;
 };
 
 inline bool operator==(const MetricSet& lhs, const MetricSet& rhs) {
-  return lhs.slot_count == rhs.slot_count && lhs.key == rhs.key;
+  return lhs.signature == rhs.signature && lhs.slot_count == rhs.slot_count &&
+         lhs.sorted_keys == rhs.sorted_keys;
 }
 
 inline bool operator!=(const MetricSet& lhs, const MetricSet& rhs) {
@@ -64,7 +179,7 @@ inline bool operator!=(const MetricSet& lhs, const MetricSet& rhs) {
 
 struct HashMetricSet {
   size_t operator()(const MetricSet& metric_set) const {
-    return std::hash<std::string>()(metric_set.key);
+    return metric_set.signature;
   }
 };
 
@@ -13,7 +13,9 @@
 // limitations under the license.
 #include "cxx/clients/downsampler/metric_set.h"
 
+#include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
 
 namespace mako {
 namespace downsampler {
@@ -72,11 +74,128 @@ TEST(MetricSetTest, MetricSetNotEquals) {
   EXPECT_NE(MetricSet(&p1), MetricSet(&p2));
 }
 
+TEST(MetricSetTest, MetricSetNotEqualsJoinedKey) {
+  // Both would have key "m1,m2".
+  mako::SamplePoint p1;
+  p1.add_metric_value_list()->set_value_key("m1,m2");
+  p1.add_metric_value_list()->set_value_key("m3");
+
+  mako::SamplePoint p2;
+  p2.add_metric_value_list()->set_value_key("m1");
+  p2.add_metric_value_list()->set_value_key("m2,m3");
+  EXPECT_NE(MetricSet(&p1), MetricSet(&p2));
+  EXPECT_FALSE(MetricSet(&p1).Matches(p2, MetricSetSignature(p2)));
+}
+
 TEST(MetricSetTest, HashMetricSet) {
   mako::SamplePoint p;
   mako::KeyedValue* kv = p.add_metric_value_list();
   kv->set_value_key("m3");
-  EXPECT_EQ(std::hash<std::string>()("m3"), HashMetricSet()(MetricSet(&p)));
+  EXPECT_EQ(MetricSetSignature(p), HashMetricSet()(MetricSet(&p)));
+}
+
+TEST(MetricSetTest, SignatureIgnoresOrder) {
+  mako::SamplePoint p1;
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m2");
+  p1.add_metric_value_list()->set_value_key("m3");
+
+  mako::SamplePoint p2;
+  p2.add_metric_value_list()->set_value_key("m3");
+  p2.add_metric_value_list()->set_value_key("m1");
+  p2.add_metric_value_list()->set_value_key("m2");
+  EXPECT_EQ(MetricSetSignature(p1), MetricSetSignature(p2));
+  EXPECT_EQ(MetricSet(&p1), MetricSet(&p2));
+  EXPECT_TRUE(MetricSet(&p1).Matches(p2, MetricSetSignature(p2)));
+}
+
+TEST(MetricSetTest, MatchesCountsDuplicates) {
+  mako::SamplePoint p1;
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m2");
+
+  mako::SamplePoint p2;
+  p2.add_metric_value_list()->set_value_key("m1");
+  p2.add_metric_value_list()->set_value_key("m2");
+  p2.add_metric_value_list()->set_value_key("m2");
+
+  mako::SamplePoint p3;
+  p3.add_metric_value_list()->set_value_key("m2");
+  p3.add_metric_value_list()->set_value_key("m1");
+  p3.add_metric_value_list()->set_value_key("m1");
+  EXPECT_NE(MetricSetSignature(p1), MetricSetSignature(p2));
+  EXPECT_FALSE(MetricSet(&p1).Matches(p2, MetricSetSignature(p2)));
+  EXPECT_TRUE(MetricSet(&p1).Matches(p3, MetricSetSignature(p3)));
+}
+
+TEST(MetricSetTest, MatchesRejectsDuplicatesOfDistinctKeys) {
+  mako::SamplePoint p1;
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m2");
+
+  mako::SamplePoint p2;
+  p2.add_metric_value_list()->set_value_key("m1");
+  p2.add_metric_value_list()->set_value_key("m1");
+  MetricSet ms(&p1);
+  EXPECT_FALSE(ms.has_duplicate_keys);
+  // Pass the set's own signature, as if the signatures collided.
+  EXPECT_FALSE(ms.Matches(p2, ms.signature));
+}
+
+TEST(MetricSetTest, MatchesComparesDuplicateKeysAsMultisets) {
+  mako::SamplePoint p1;
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m1");
+  p1.add_metric_value_list()->set_value_key("m2");
+
+  mako::SamplePoint p2;
+  p2.add_metric_value_list()->set_value_key("m1");
+  p2.add_metric_value_list()->set_value_key("m2");
+  p2.add_metric_value_list()->set_value_key("m2");
+  MetricSet ms(&p1);
+  EXPECT_TRUE(ms.has_duplicate_keys);
+  EXPECT_FALSE(ms.Matches(p2, ms.signature));
+}
+
+TEST(MetricSetTest, MatchesSampleError) {
+  mako::SampleError e1;
+  e1.set_sampler_name("Sampler1");
+  mako::SampleError e2;
+  e2.set_sampler_name("Sampler2");
+  MetricSet ms(&e1);
+  EXPECT_TRUE(ms.Matches(e1, MetricSetSignature(e1)));
+  EXPECT_FALSE(ms.Matches(e2, MetricSetSignature(e2)));
 }
+
+mako::SamplePoint PointWithMetrics(int metric_count) {
+  mako::SamplePoint p;
+  for (int i = metric_count; i > 0; --i) {
+    mako::KeyedValue* kv = p.add_metric_value_list();
+    kv->set_value_key(absl::StrCat("metric_", i));
+    kv->set_value(i);
+  }
+  return p;
+}
+
+// What the downsampler did per record before signatures.
+static void BM_MetricSetKey(benchmark::State& state) {
+  mako::SamplePoint p = PointWithMetrics(state.range(0));
+  for (auto _ : state) {
+    MetricSet ms(&p);
+    benchmark::DoNotOptimize(std::hash<std::string>()(ms.key));
+  }
+}
+BENCHMARK(BM_MetricSetKey)->Range(1, 64);
+
+static void BM_MetricSetSignatureAndMatch(benchmark::State& state) {
+  mako::SamplePoint p = PointWithMetrics(state.range(0));
+  MetricSet ms(&p);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ms.Matches(p, MetricSetSignature(p)));
+  }
+}
+BENCHMARK(BM_MetricSetSignatureAndMatch)->Range(1, 64);
+
 }  // namespace downsampler
 }  // namespace mako
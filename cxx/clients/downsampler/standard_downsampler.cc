@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <random>
 #include <unordered_map>
 #include <vector>
@@ -32,9 +33,11 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/synchronization/mutex.h"
+#include "cxx/clients/downsampler/largest_triangles.h"
 #include "cxx/clients/downsampler/metric_set.h"
 #include "cxx/internal/load/common/executor.h"
 #include "cxx/internal/proto_validation.h"
+#include "cxx/internal/sample_columns.h"
 #include "proto/internal/mako_internal.pb.h"
 #include "spec/proto/mako.pb.h"
 
@@ -47,6 +50,9 @@ const int kMaxAnnotationsSize = 800000;  // 800kb
 
 namespace {
 static const char kNoError[] = "";
+// How many times its share of slots a metric set may buffer before it is
+// reduced, under RecordManager::Sampling::kLargestTriangles.
+const int64_t kLargestTrianglesBufferFactor = 2;
 
 int64_t CalculateSampleAnnotationRepeatedFieldSize(
     const google::protobuf::RepeatedPtrField<mako::SampleAnnotation>& annotations,
@@ -134,6 +140,30 @@ std::string DebugStringWithoutLongFields(const DownsamplerInput& input) {
       "\nbatch_size_max: ", input.batch_size_max());
 }
 
+// Appends the metric values of point to y, ordered by value_key so that every
+// point lists them in the same order. metrics is scratch space.
+void AppendSeriesValues(const mako::SamplePoint& point,
+                        std::vector<const mako::KeyedValue*>* metrics,
+                        std::vector<double>* y) {
+  metrics->assign(point.metric_value_list().pointer_begin(),
+                  point.metric_value_list().pointer_end());
+  std::sort(metrics->begin(), metrics->end(),
+            [](const mako::KeyedValue* a, const mako::KeyedValue* b) {
+              return a->value_key() < b->value_key();
+            });
+  for (const mako::KeyedValue* metric : *metrics) {
+    y->push_back(metric->value());
+  }
+}
+
+// SampleErrors have no values; they are never chosen by
+// LargestTriangleThreeBuckets.
+void AppendSeriesValues(const mako::SampleError& error,
+                        std::vector<const mako::KeyedValue*>* metrics,
+                        std::vector<double>* y) {
+  y->push_back(0);
+}
+
 }  // namespace
 
 // RecordSaver is responsible for holding metadata about a metric set.
@@ -142,118 +172,259 @@ std::string DebugStringWithoutLongFields(const DownsamplerInput& input) {
 //
 // The term 'slots' is used below. When holding SampleErrors slots == 1.
 // When holding SamplePoints slots = # of metrics inside the sample.
+//
+// Each saved record has a sampling key, and when records must be dropped the
+// ones with the highest keys go first. With uniformly random keys, the records
+// kept are a uniform sample of those seen (a weighted reservoir in the style of
+// Efraimidis and Spirakis, with every record weighted equally). Because keys
+// are kept with the records, reservoirs filled on different threads can be
+// merged by keeping the lowest keys of their union.
+//
+// Thread-compatible; each RecordSaver is used by a single thread at a time.
 template <typename T>
 class RecordSaver {
  public:
-  RecordSaver(const MetricSet& metric_set, int prng_seed)
-      : parsed_slots_(0), metric_set_(metric_set) {
-    prng_.seed(prng_seed);
-  }
+  // order is the position of this Saver among those of its RecordManager,
+  // which breaks ties when choosing a Saver to evict from.
+  RecordSaver(const MetricSet& metric_set, int order)
+      : parsed_slots_(0), order_(order), metric_set_(metric_set) {}
+
   // Total number of slots we have saved for this metric key
-  int slots() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return metric_set_.slot_count * saved_.size();
-  }
+  int slots() const { return metric_set_.slot_count * saved_.size(); }
+
+  // The highest sampling key of the saved records. There must be at least one.
+  double max_key() const { return saved_.front().key; }
 
-  std::string RemoveRandomSavedRecord() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
+  // Removes the saved record with the highest sampling key, and moves it to
+  // removed_record.
+  std::string RemoveMaxKeySavedRecord(std::unique_ptr<T>* removed_record) {
     if (saved_.empty()) {
       std::string err = absl::StrCat("No records saved for metric set: ",
                                      metric_set_.ToString());
       LOG(ERROR) << err;
       return err;
     }
-
-    // Choose random index to remove
-    int index_to_delete =
-        std::uniform_int_distribution<size_t>{0, saved_.size() - 1}(prng_);
-    saved_[index_to_delete] = std::move(saved_.back());
+    std::pop_heap(saved_.begin(), saved_.end());
+    *removed_record = std::move(saved_.back().record);
     saved_.pop_back();
-    VLOG(1) << "Cleared " << metric_set_.slot_count << " slots from metric set "
+    VLOG(2) << "Cleared " << metric_set_.slot_count << " slots from metric set "
             << metric_set_.ToString();
     return kNoError;
   }
 
-  std::string AddSavedRecord(std::unique_ptr<T> item,
-                             const MetricSet& metric_set)
-      ABSL_LOCKS_EXCLUDED(mutex_) {
-    if (metric_set != metric_set_) {
-      std::string err = absl::StrCat("Got: ", metric_set.ToString(),
-                                     "; expected: ", metric_set_.ToString());
-      LOG(ERROR) << err;
-      return err;
-    }
-    absl::MutexLock l(&mutex_);
-    saved_.push_back(std::move(item));
-    return kNoError;
+  // The record must match metric_set().
+  void AddSavedRecord(double key, std::unique_ptr<T> item) {
+    saved_.push_back({key, std::move(item)});
+    std::push_heap(saved_.begin(), saved_.end());
   }
 
-  int parsed_slots() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return parsed_slots_;
-  }
+  int64_t parsed_slots() const { return parsed_slots_; }
 
-  int add_parsed_slots() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
+  int64_t add_parsed_slots() {
     parsed_slots_ += metric_set_.slot_count;
     return parsed_slots_;
   }
 
-  int NumberOfRecords() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return saved_.size();
+  int NumberOfRecords() const { return saved_.size(); }
+
+  // Keeps count of the saved records, chosen by LargestTriangleThreeBuckets
+  // over their metric values by input_value. For SamplePoints only.
+  void SelectLargestTriangles(int count) {
+    std::sort(saved_.begin(), saved_.end(),
+              [](const SavedRecord& a, const SavedRecord& b) {
+                return a.record->input_value() < b.record->input_value();
+              });
+    const int series_count = metric_set_.slot_count;
+    std::vector<double> x;
+    std::vector<double> y;
+    x.reserve(saved_.size());
+    y.reserve(saved_.size() * series_count);
+    std::vector<const mako::KeyedValue*> metrics;
+    for (const SavedRecord& saved : saved_) {
+      x.push_back(saved.record->input_value());
+      AppendSeriesValues(*saved.record, &metrics, &y);
+    }
+    std::vector<SavedRecord> kept;
+    kept.reserve(count);
+    for (size_t index :
+         LargestTriangleThreeBuckets(x, y, series_count, count)) {
+      kept.push_back(std::move(saved_[index]));
+    }
+    saved_ = std::move(kept);
+    std::make_heap(saved_.begin(), saved_.end());
   }
+
+  // Moves all saved records and parsed slots of other, which must have the same
+  // metric set, into this Saver.
+  void Merge(RecordSaver* other) {
+    parsed_slots_ += other->parsed_slots_;
+    for (SavedRecord& saved : other->saved_) {
+      saved_.push_back(std::move(saved));
+      std::push_heap(saved_.begin(), saved_.end());
+    }
+    other->saved_.clear();
+    other->parsed_slots_ = 0;
+  }
+
   // Moves all saved records to the given vector, and resets the state of this
   // Saver
-  void MoveSavedRecords(std::vector<std::unique_ptr<T>>* all_records)
-      ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    std::move(saved_.begin(), saved_.end(), std::back_inserter(*all_records));
+  void MoveSavedRecords(std::vector<std::unique_ptr<T>>* all_records) {
+    for (SavedRecord& saved : saved_) {
+      all_records->push_back(std::move(saved.record));
+    }
     saved_.clear();
     parsed_slots_ = 0;
   }
-  int slots_per_record() { return metric_set_.slot_count; }
+  int slots_per_record() const { return metric_set_.slot_count; }
+  const MetricSet& metric_set() const { return metric_set_; }
+
+  int order() const { return order_; }
+  // Position of this Saver in its RecordManager's SaverHeap.
+  int heap_index() const { return heap_index_; }
+  void set_heap_index(int heap_index) { heap_index_ = heap_index; }
 
  private:
-  // Used to synchronize access, since there might potentially be many
-  // threads wanting to add or remove records from it at the same time.
-  absl::Mutex mutex_;
+  struct SavedRecord {
+    double key;
+    std::unique_ptr<T> record;
+
+    bool operator<(const SavedRecord& other) const { return key < other.key; }
+  };
+
   // Total number of slots that we have seen so far for this key.
-  int parsed_slots_ ABSL_GUARDED_BY(mutex_);
-  // Pseudo-RNG for determining which record to evict
-  std::default_random_engine prng_ ABSL_GUARDED_BY(mutex_);
-  // All the saved points (either SamplePoints or SampleErrors).
-  std::vector<std::unique_ptr<T>> saved_ ABSL_GUARDED_BY(mutex_);
+  int64_t parsed_slots_;
+  const int order_;
+  int heap_index_ = -1;
+  // All the saved points (either SamplePoints or SampleErrors), as a max-heap
+  // by sampling key.
+  std::vector<SavedRecord> saved_;
   // The metric set for this groups of records.
   const MetricSet metric_set_;
 };
 
+// SaverHeap orders RecordSavers by slot count, so that the Saver to evict a
+// record from is found in O(1) and kept up to date in O(log K) for K metric
+// sets. Ties go to the Saver created first.
+//
+// The heap doesn't own the Savers. Update() must be called whenever a Saver's
+// slot count changes.
+template <typename T>
+class SaverHeap {
+ public:
+  bool empty() const { return heap_.empty(); }
+
+  void Clear() { heap_.clear(); }
+
+  // The Saver holding the most slots. The heap must not be empty.
+  RecordSaver<T>* top() const { return heap_.front(); }
+
+  void Push(RecordSaver<T>* saver) {
+    saver->set_heap_index(heap_.size());
+    heap_.push_back(saver);
+    SiftUp(saver->heap_index());
+  }
+
+  void Update(RecordSaver<T>* saver) {
+    SiftUp(saver->heap_index());
+    SiftDown(saver->heap_index());
+  }
+
+ private:
+  static bool Before(const RecordSaver<T>* a, const RecordSaver<T>* b) {
+    return a->slots() > b->slots() ||
+           (a->slots() == b->slots() && a->order() < b->order());
+  }
+
+  void Set(int index, RecordSaver<T>* saver) {
+    heap_[index] = saver;
+    saver->set_heap_index(index);
+  }
+
+  void SiftUp(int index) {
+    RecordSaver<T>* saver = heap_[index];
+    while (index > 0) {
+      int parent = (index - 1) / 2;
+      if (!Before(saver, heap_[parent])) {
+        break;
+      }
+      Set(index, heap_[parent]);
+      index = parent;
+    }
+    Set(index, saver);
+  }
+
+  void SiftDown(int index) {
+    RecordSaver<T>* saver = heap_[index];
+    const int size = heap_.size();
+    while (true) {
+      int child = 2 * index + 1;
+      if (child >= size) {
+        break;
+      }
+      if (child + 1 < size && Before(heap_[child + 1], heap_[child])) {
+        ++child;
+      }
+      if (!Before(heap_[child], saver)) {
+        break;
+      }
+      Set(index, heap_[child]);
+      index = child;
+    }
+    Set(index, saver);
+  }
+
+  std::vector<RecordSaver<T>*> heap_;
+};
+
 // RecordManager provides mapping from keys->Record (via RecordSavers) and
 // metadata about Records.
+//
+// Thread-compatible. When processing files in parallel each worker thread
+// fills its own RecordManager, made by NewWorkerManager(), without taking any
+// locks; they are merged once all files are read.
 template <typename T>
 class RecordManager {
  public:
-  RecordManager(const std::string& name, int64_t max_slots, bool replace,
+  // How records are chosen when there are more than fit in max_slots.
+  enum class Sampling {
+    // The first records seen are kept.
+    kFirst,
+    // Records are sampled uniformly at random.
+    kUniform,
+    // Records are chosen by LargestTriangleThreeBuckets when
+    // SelectLargestTriangles() is called. Until then a metric set keeps up to
+    // kLargestTrianglesBufferFactor times max_slots of its records, and is
+    // reduced to max_slots by LargestTriangleThreeBuckets whenever it reaches
+    // that, so memory doesn't grow with the input.
+    kLargestTriangles,
+  };
+
+  RecordManager(const std::string& name, int64_t max_slots, Sampling sampling,
                 int prng_seed)
-      : name_(name), max_slot_count_(max_slots), replace_(replace) {
+      : name_(name), max_slot_count_(max_slots), sampling_(sampling) {
     prng_.seed(prng_seed);
   }
 
-  // Sum of all slots used by RecordSavers
-  int slot_count() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return slot_count_;
+  // Returns an empty RecordManager with the same limits, seeded from this one.
+  std::unique_ptr<RecordManager> NewWorkerManager() {
+    auto worker = absl::make_unique<RecordManager>(name_, max_slot_count_,
+                                                   sampling_, /*prng_seed=*/0);
+    // Seeding a linear congruential engine with the output of another gives a
+    // shifted copy of its sequence, so the workers' sampling keys would be
+    // correlated. Scramble the seed instead.
+    std::seed_seq seed{prng_(), prng_()};
+    worker->prng_.seed(seed);
+    return worker;
   }
 
+  // Sum of all slots used by RecordSavers
+  int64_t slot_count() const { return slot_count_; }
+
   // How many slots we have parsed for type <T>
-  int parsed_slots() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return parsed_slots_;
-  }
+  int64_t parsed_slots() const { return parsed_slots_; }
 
   // Verify that we have met the slot count restrictions.
-  std::string VerifyLimits() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
+  std::string VerifyLimits() const {
     if (slot_count_ > max_slot_count_) {
       std::string err = absl::StrCat(
           name_,
@@ -266,10 +437,10 @@ class RecordManager {
             << " max slots: " << max_slot_count_
             << " total slots consumed: " << slot_count_
             << " total slots parsed: " << parsed_slots_ << " --- ";
-    for (const auto& pair : key_to_record_saver_) {
-      VLOG(1) << pair.first.ToString()
-              << " slots parsed: " << pair.second->parsed_slots()
-              << " records saved: " << pair.second->NumberOfRecords();
+    for (const auto& saver : record_savers_) {
+      VLOG(1) << saver->metric_set().ToString()
+              << " slots parsed: " << saver->parsed_slots()
+              << " records saved: " << saver->NumberOfRecords();
     }
     VLOG(1) << " --- ";
     return kNoError;
@@ -278,86 +449,202 @@ class RecordManager {
   // Return a vector of all Records saved.
   // Note the unique_ptr's returned. This function should be called only once
   // as it transfers ownership of all Records to the caller.
-  std::vector<std::unique_ptr<T>> AllRecords() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
+  std::vector<std::unique_ptr<T>> AllRecords() {
     std::vector<std::unique_ptr<T>> all_records;
     all_records.reserve(record_count_);
-    for (const auto& pair : key_to_record_saver_) {
-      pair.second->MoveSavedRecords(&all_records);
+    for (const auto& saver : record_savers_) {
+      saver->MoveSavedRecords(&all_records);
     }
     return all_records;
   }
 
-  std::string HandleRecord(std::unique_ptr<T> new_record)
-      ABSL_LOCKS_EXCLUDED(mutex_) {
+  // Returns a cleared record that was discarded or evicted, or nullptr if there
+  // is none. Parsing into it reuses its allocations.
+  std::unique_ptr<T> TakeSpareRecord() {
+    if (spare_records_.empty()) {
+      return nullptr;
+    }
+    std::unique_ptr<T> record = std::move(spare_records_.back());
+    spare_records_.pop_back();
+    return record;
+  }
+
+  std::string HandleRecord(std::unique_ptr<T> new_record) {
     // If we don't want to save any samples
     if (max_slot_count_ == 0) {
+      Recycle(std::move(new_record));
       return kNoError;
     }
 
-    MetricSet metric_set(new_record.get());
-    VLOG(2) << "== " << name_ << " (" << metric_set.key << ")";
-    if (metric_set.slot_count > max_slot_count_) {
+    const int slot_count = SlotCount(*new_record);
+    if (slot_count > max_slot_count_) {
       std::string err = absl::StrCat(
-          "Attempting to add a metric to set of size: ", metric_set.slot_count,
+          "Attempting to add a metric to set of size: ", slot_count,
           " but max size is: ", max_slot_count_);
       LOG(ERROR) << err;
       return err;
     }
 
-    RecordSaver<T>* saver = GetOrCreate(metric_set);
+    RecordSaver<T>* saver = GetOrCreate(new_record.get());
+    const MetricSet& metric_set = saver->metric_set();
+    VLOG(2) << "== " << name_ << " (" << metric_set.key << ")";
 
-    int count = CountOfSlotConsumers();
-    CHECK(count > 0) << "Should have created RecordSaver for metric "
-                     << "set: " << metric_set.ToString();
-    int fair_share_slots = max_slot_count_ / count;
+    int fair_share_slots = max_slot_count_ / record_savers_.size();
 
-    absl::MutexLock l(&mutex_);
     parsed_slots_ += metric_set.slot_count;
-    int saver_parsed_slots = saver->add_parsed_slots();
-    if (slot_count_ + metric_set.slot_count > max_slot_count_ &&
-
+    saver->add_parsed_slots();
+    // Without replacement, keys follow arrival so that the first records seen
+    // are the ones kept.
+    double key = sampling_ == Sampling::kUniform
+                     ? std::uniform_real_distribution<double>{0, 1}(prng_)
+                     : next_sequence_key_++;
+    if (sampling_ != Sampling::kLargestTriangles &&
+        slot_count_ + metric_set.slot_count > max_slot_count_ &&
         saver->slots() + metric_set.slot_count > fair_share_slots) {
-      if (!replace_) {
+      if (sampling_ == Sampling::kFirst) {
+        Recycle(std::move(new_record));
         return kNoError;
       }
       VLOG(2) << "Over quota (slots used by this key: " << saver->slots()
               << ")";
-      CHECK(saver_parsed_slots > 0) << "Should have positive number of "
-                                    << "parsed slots.";
-      if (!GetRandomChoice(static_cast<double>(saver->slots()) /
-                           saver_parsed_slots)) {
+      // The record takes the place of this metric set's highest key, if it is
+      // lower.
+      if (saver->NumberOfRecords() == 0 || key >= saver->max_key()) {
         VLOG(2) << "Record discarded";
+        Recycle(std::move(new_record));
         return kNoError;
       }
+      std::unique_ptr<T> removed_record;
+      std::string err = saver->RemoveMaxKeySavedRecord(&removed_record);
+      if (!err.empty()) {
+        LOG(ERROR) << err;
+        return err;
+      }
+      Recycle(std::move(removed_record));
+      saver_heap_.Update(saver);
+      slot_count_ -= metric_set.slot_count;
+      --record_count_;
     }
 
-    while (slot_count_ + metric_set.slot_count > max_slot_count_) {
+    while (sampling_ != Sampling::kLargestTriangles &&
+           slot_count_ + metric_set.slot_count > max_slot_count_) {
       VLOG(2) << "Clearing more records";
-      std::string err = RemoveRandomSavedRecord(metric_set);
+      std::string err = RemoveSavedRecord(saver);
       if (!err.empty()) {
         LOG(ERROR) << err;
         return err;
       }
     }
-    std::string err = saver->AddSavedRecord(std::move(new_record), metric_set);
-    if (!err.empty()) {
-      LOG(ERROR) << err;
-      return err;
-    }
+    saver->AddSavedRecord(key, std::move(new_record));
+    saver_heap_.Update(saver);
     VLOG(2) << metric_set.key << ": " << saver->NumberOfRecords()
             << " records saved, " << saver->slots() << " slots consumed, "
             << saver->parsed_slots() << " slots parsed";
     slot_count_ += metric_set.slot_count;
     ++record_count_;
+    if (sampling_ == Sampling::kLargestTriangles) {
+      ReduceLargestTrianglesBuffer(saver);
+    }
     return kNoError;
   }
 
+  // Moves all records of other, a manager made by NewWorkerManager(), into
+  // this one. Records are then dropped from the metric sets with the most slots
+  // until the limit is met, which shares the slots between metric sets as if
+  // all records had been handled by one manager.
+  std::string Merge(RecordManager* other) {
+    parsed_slots_ += other->parsed_slots_;
+    slot_count_ += other->slot_count_;
+    record_count_ += other->record_count_;
+    other->parsed_slots_ = other->slot_count_ = other->record_count_ = 0;
+    for (const auto& other_saver : other->record_savers_) {
+      RecordSaver<T>* saver = GetOrCreate(other_saver->metric_set());
+      saver->Merge(other_saver.get());
+      saver_heap_.Update(saver);
+      if (sampling_ == Sampling::kLargestTriangles) {
+        ReduceLargestTrianglesBuffer(saver);
+      }
+    }
+    other->saver_heap_.Clear();
+    other->signature_to_record_savers_.clear();
+    other->record_savers_.clear();
+
+    while (sampling_ != Sampling::kLargestTriangles &&
+           slot_count_ > max_slot_count_) {
+      std::string err = RemoveSavedRecord(nullptr);
+      if (!err.empty()) {
+        LOG(ERROR) << err;
+        return err;
+      }
+    }
+    // Merging happens once all records are parsed, so spares won't be reused.
+    spare_records_.clear();
+    return kNoError;
+  }
+
+  // Keeps, of the records of each metric set, those chosen by
+  // LargestTriangleThreeBuckets. As in HandleRecord, every metric set gets an
+  // equal share of the slots, and slots a metric set doesn't need are shared
+  // among the others. For SamplePoints handled with kLargestTriangles only.
+  void SelectLargestTriangles() {
+    std::vector<RecordSaver<T>*> savers;
+    savers.reserve(record_savers_.size());
+    for (const auto& saver : record_savers_) {
+      savers.push_back(saver.get());
+    }
+    // Smallest metric sets first, so that what they leave of their share is
+    // known when sharing out the slots to the others.
+    std::stable_sort(savers.begin(), savers.end(),
+                     [](const RecordSaver<T>* a, const RecordSaver<T>* b) {
+                       return a->slots() < b->slots();
+                     });
+    int64_t slots_left = max_slot_count_;
+    for (size_t i = 0; i < savers.size(); ++i) {
+      RecordSaver<T>* saver = savers[i];
+      const int64_t fair_share_slots = slots_left / (savers.size() - i);
+      const int count = std::min<int64_t>(
+          saver->NumberOfRecords(),
+          fair_share_slots / saver->slots_per_record());
+      slot_count_ -= saver->slots();
+      record_count_ -= saver->NumberOfRecords();
+      saver->SelectLargestTriangles(count);
+      saver_heap_.Update(saver);
+      slot_count_ += saver->slots();
+      record_count_ += saver->NumberOfRecords();
+      slots_left -= saver->slots();
+    }
+  }
+
  private:
+  // Keeps a record that is no longer needed for TakeSpareRecord(). Every record
+  // handled either is saved or ends up here, so there are never more spares
+  // than records saved.
+  void Recycle(std::unique_ptr<T> record) {
+    record->Clear();
+    spare_records_.push_back(std::move(record));
+  }
+
+  // Under kLargestTriangles, reduces the records of saver to max_slot_count_
+  // slots by LargestTriangleThreeBuckets once they reach
+  // kLargestTrianglesBufferFactor times that. The final selection is then made
+  // from points already chosen for their shape, rather than from all points.
+  void ReduceLargestTrianglesBuffer(RecordSaver<T>* saver) {
+    if (saver->slots() < kLargestTrianglesBufferFactor * max_slot_count_) {
+      return;
+    }
+    slot_count_ -= saver->slots();
+    record_count_ -= saver->NumberOfRecords();
+    saver->SelectLargestTriangles(static_cast<int>(
+        std::min<int64_t>(saver->NumberOfRecords(),
+                          max_slot_count_ / saver->slots_per_record())));
+    saver_heap_.Update(saver);
+    slot_count_ += saver->slots();
+    record_count_ += saver->NumberOfRecords();
+  }
+
   // pick a RecordSaver to remove slots from.
-  std::string RemoveRandomSavedRecord(const MetricSet& set_being_added)
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
-    if (key_to_record_saver_.empty()) {
+  std::string RemoveSavedRecord(RecordSaver<T>* saver_being_added) {
+    if (record_savers_.empty()) {
       std::string err =
           absl::StrCat("RecordManager(", name_,
                        ") asked to choose largest RecordSaver but do "
@@ -369,71 +656,77 @@ class RecordManager {
     // first pick the RecordSaver to remove a record from. we pick the one with
     // the most slots, with tie breaking in favor of the RecordSaver
     // corresponding to the metric set currently being added
-    RecordSaver<T>* biggest_saver = nullptr;
-
-    float biggest_slot_count = 0;
-    for (const auto& pair : key_to_record_saver_) {
-      const MetricSet& metric_set = pair.first;
-      RecordSaver<T>* saver = pair.second.get();
-
-      float this_slot_count = saver->slots();
-
-      // ties go to the metric set being added
-      if (metric_set == set_being_added) this_slot_count += 0.5;
-
-      if (this_slot_count > biggest_slot_count) {
-        biggest_slot_count = this_slot_count;
-        biggest_saver = saver;
-      }
+    RecordSaver<T>* biggest_saver = saver_heap_.top();
+    if (saver_being_added != nullptr &&
+        saver_being_added->slots() == biggest_saver->slots()) {
+      biggest_saver = saver_being_added;
     }
 
-    CHECK(biggest_saver != nullptr)
-        << "Error: No RecordSavers have a >0 slot count?";
-
-    std::string err = biggest_saver->RemoveRandomSavedRecord();
+    std::unique_ptr<T> removed_record;
+    std::string err = biggest_saver->RemoveMaxKeySavedRecord(&removed_record);
     if (!err.empty()) {
       LOG(ERROR) << err;
       return err;
     }
+    Recycle(std::move(removed_record));
+    saver_heap_.Update(biggest_saver);
     slot_count_ -= biggest_saver->slots_per_record();
     --record_count_;
     return kNoError;
   }
 
-  // How many unique RecordSavers we have seen so far
-  int CountOfSlotConsumers() ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    return key_to_record_saver_.size();
+  // Returns the RecordSaver for the metric set of record. Only the first record
+  // of each metric set allocates; the rest are found by signature.
+  RecordSaver<T>* GetOrCreate(T* record) {
+    uint64_t signature = MetricSetSignature(*record);
+    std::vector<RecordSaver<T>*>& savers = signature_to_record_savers_[signature];
+    for (RecordSaver<T>* saver : savers) {
+      if (saver->metric_set().Matches(*record, signature)) {
+        return saver;
+      }
+    }
+    return Create(MetricSet(record), &savers);
   }
 
-  bool GetRandomChoice(double probability)
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
-    CHECK(probability >= 0.0 || probability <= 1.0)
-        << "Probability needs to be between 0 and 1: " << probability;
-    return std::uniform_real_distribution<double>{0, 1}(prng_) < probability;
+  RecordSaver<T>* GetOrCreate(const MetricSet& metric_set) {
+    std::vector<RecordSaver<T>*>& savers =
+        signature_to_record_savers_[metric_set.signature];
+    for (RecordSaver<T>* saver : savers) {
+      if (saver->metric_set() == metric_set) {
+        return saver;
+      }
+    }
+    return Create(metric_set, &savers);
   }
 
-  RecordSaver<T>* GetOrCreate(const MetricSet& metric_set)
-      ABSL_LOCKS_EXCLUDED(mutex_) {
-    absl::MutexLock l(&mutex_);
-    if (key_to_record_saver_.count(metric_set) == 0) {
-      key_to_record_saver_[metric_set] =
-          absl::make_unique<RecordSaver<T>>(metric_set, prng_());
-    }
-    return key_to_record_saver_[metric_set].get();
+  RecordSaver<T>* Create(const MetricSet& metric_set,
+                         std::vector<RecordSaver<T>*>* savers) {
+    record_savers_.push_back(absl::make_unique<RecordSaver<T>>(
+        metric_set, record_savers_.size()));
+    savers->push_back(record_savers_.back().get());
+    saver_heap_.Push(savers->back());
+    return savers->back();
   }
 
-  absl::Mutex mutex_;
-  std::unordered_map<MetricSet, std::unique_ptr<RecordSaver<T>>, HashMetricSet>
-      key_to_record_saver_ ABSL_GUARDED_BY(mutex_);
-  std::default_random_engine prng_ ABSL_GUARDED_BY(mutex_);
-  int slot_count_ ABSL_GUARDED_BY(mutex_) = 0;
-  int parsed_slots_ ABSL_GUARDED_BY(mutex_) = 0;
-  int record_count_ ABSL_GUARDED_BY(mutex_) = 0;
+  // All RecordSavers, in order of creation.
+  std::vector<std::unique_ptr<RecordSaver<T>>> record_savers_;
+  // The RecordSavers of each metric set signature. Almost always just one.
+  std::unordered_map<uint64_t, std::vector<RecordSaver<T>*>>
+      signature_to_record_savers_;
+  // All RecordSavers, by slot count.
+  SaverHeap<T> saver_heap_;
+  // Records that were discarded or evicted, see TakeSpareRecord().
+  std::vector<std::unique_ptr<T>> spare_records_;
+  std::default_random_engine prng_;
+  // The sampling key of the next record when not replacing.
+  double next_sequence_key_ = 0;
+  int64_t slot_count_ = 0;
+  int64_t parsed_slots_ = 0;
+  int record_count_ = 0;
 
   const std::string name_;
   const int64_t max_slot_count_;
-  const bool replace_;
+  const Sampling sampling_;
 };
 
 std::string ProcessFile(std::unique_ptr<mako::FileIO> fio,
@@ -445,8 +738,10 @@ std::string ProcessFile(std::unique_ptr<mako::FileIO> fio,
     LOG(ERROR) << fio->Error();
     return fio->Error();
   }
+  // Blocks of records stored by column are read a record at a time.
+  mako::internal::SampleFileReader reader(fio.get());
   mako::SampleRecord sample_record;
-  while (fio->Read(&sample_record)) {
+  while (reader.Read(&sample_record)) {
     if (!sample_record.has_sample_point() &&
         !sample_record.has_sample_error()) {
       std::string err =
@@ -461,6 +756,10 @@ std::string ProcessFile(std::unique_ptr<mako::FileIO> fio,
         LOG(ERROR) << err;
         return err;
       }
+      // Clear() keeps the sample point allocated, so the next one is parsed
+      // into a spare record rather than a new one.
+      sample_record.set_allocated_sample_point(
+          sample_manager->TakeSpareRecord().release());
     }
     if (sample_record.has_sample_error()) {
       std::string err = error_manager->HandleRecord(
@@ -469,14 +768,15 @@ std::string ProcessFile(std::unique_ptr<mako::FileIO> fio,
         LOG(ERROR) << err;
         return err;
       }
+      sample_record.set_allocated_sample_error(
+          error_manager->TakeSpareRecord().release());
     }
     sample_record.Clear();
   }
 
-  if (!fio->ReadEOF()) {
-    std::string err = fio->Error();
-    LOG(ERROR) << err;
-    return err;
+  if (!reader.error().empty()) {
+    LOG(ERROR) << reader.error();
+    return reader.error();
   }
   return kNoError;
 }
@@ -490,21 +790,43 @@ std::string ProcessFiles(const mako::DownsamplerInput& downsampler_input,
     num_threads = max_threads;
   }
   LOG(INFO) << "Creating thread pool with " << num_threads << " threads.";
+
+  // The RecordManagers of one worker. Each file is processed with a Worker
+  // that no other thread is using, so handling a record takes no locks.
+  struct Worker {
+    std::unique_ptr<RecordManager<mako::SamplePoint>> sample_manager;
+    std::unique_ptr<RecordManager<mako::SampleError>> error_manager;
+  };
   mako::internal::Executor file_processor(num_threads);
   absl::Mutex m;
   std::vector<std::string> errors;
+  // All Workers made so far, at most one per thread. Only idle ones are here
+  // while files are being processed.
+  std::vector<Worker> idle_workers;
   for (const mako::SampleFile& sample_file :
        downsampler_input.sample_file_list()) {
-    file_processor.Schedule(
-        [&sample_file, &m, &errors, sample_manager, error_manager, fileio]() {
-          std::string error =
-              ProcessFile(fileio->MakeInstance(), sample_file.file_path(),
-                          sample_manager, error_manager);
-          if (!error.empty()) {
-            absl::MutexLock l(&m);
-            errors.push_back(error);
-          }
-        });
+    file_processor.Schedule([&sample_file, &m, &errors, &idle_workers,
+                             sample_manager, error_manager, fileio]() {
+      Worker worker;
+      {
+        absl::MutexLock l(&m);
+        if (idle_workers.empty()) {
+          worker.sample_manager = sample_manager->NewWorkerManager();
+          worker.error_manager = error_manager->NewWorkerManager();
+        } else {
+          worker = std::move(idle_workers.back());
+          idle_workers.pop_back();
+        }
+      }
+      std::string error =
+          ProcessFile(fileio->MakeInstance(), sample_file.file_path(),
+                      worker.sample_manager.get(), worker.error_manager.get());
+      absl::MutexLock l(&m);
+      idle_workers.push_back(std::move(worker));
+      if (!error.empty()) {
+        errors.push_back(error);
+      }
+    });
   }
   file_processor.Wait();
   if (!errors.empty()) {
@@ -512,17 +834,25 @@ std::string ProcessFiles(const mako::DownsamplerInput& downsampler_input,
     LOG(ERROR) << error;
     return error;
   }
+
+  for (Worker& worker : idle_workers) {
+    std::string err = sample_manager->Merge(worker.sample_manager.get());
+    if (err.empty()) {
+      err = error_manager->Merge(worker.error_manager.get());
+    }
+    if (!err.empty()) {
+      LOG(ERROR) << err;
+      return err;
+    }
+  }
   return kNoError;
 }
 
 void Downsampler::Reseed(int prng_seed) { prng_.seed(prng_seed); }
 
+// Takes all records of manager, processed and sorted by ascending input_value.
 template <typename T>
-std::string AddBatches(const std::string& benchmark_key,
-                       const std::string& run_key, const int batch_size_max,
-                       const int field_number, RecordManager<T>* manager,
-                       mako::SampleBatch** batch, int64_t* batch_size_bytes,
-                       mako::DownsamplerOutput* downsampler_output) {
+std::vector<std::unique_ptr<T>> SortedRecords(RecordManager<T>* manager) {
   std::vector<std::unique_ptr<T>> all_records = manager->AllRecords();
   // Apply processing to all records
   ProcessAllRecords(&all_records);
@@ -531,6 +861,16 @@ std::string AddBatches(const std::string& benchmark_key,
             [](const std::unique_ptr<T>& a, const std::unique_ptr<T>& b) {
               return a->input_value() < b->input_value();
             });
+  return all_records;
+}
+
+template <typename T>
+std::string AddBatches(const std::string& benchmark_key,
+                       const std::string& run_key, const int batch_size_max,
+                       const int field_number, RecordManager<T>* manager,
+                       mako::SampleBatch** batch, int64_t* batch_size_bytes,
+                       mako::DownsamplerOutput* downsampler_output) {
+  std::vector<std::unique_ptr<T>> all_records = SortedRecords(manager);
   for (auto& record : all_records) {
     std::string err =
         AddBatch(benchmark_key, run_key, batch_size_max, field_number,
@@ -543,6 +883,89 @@ std::string AddBatches(const std::string& benchmark_key,
   return kNoError;
 }
 
+// A record to be packed by PackBatches, and its serialized size in a
+// SampleBatch. Exactly one of point and error is set.
+struct SizedRecord {
+  int64_t size;
+  mako::SamplePoint* point;
+  mako::SampleError* error;
+};
+
+SizedRecord MakeSizedRecord(int64_t size, mako::SamplePoint* point) {
+  return {size, point, nullptr};
+}
+
+SizedRecord MakeSizedRecord(int64_t size, mako::SampleError* error) {
+  return {size, nullptr, error};
+}
+
+// Appends records to sized_records. The records must outlive sized_records.
+template <typename T>
+std::string SizeRecords(const int batch_size_max, const int field_number,
+                        const std::vector<std::unique_ptr<T>>& records,
+                        std::vector<SizedRecord>* sized_records) {
+  for (const auto& record : records) {
+    int64_t size;
+    std::string err =
+        SizeInBatch(batch_size_max, field_number, record.get(), &size);
+    if (!err.empty()) {
+      return err;
+    }
+    sized_records->push_back(MakeSizedRecord(size, record.get()));
+  }
+  return kNoError;
+}
+
+template <typename T>
+void SortByInputValue(google::protobuf::RepeatedPtrField<T>* records) {
+  std::stable_sort(records->pointer_begin(), records->pointer_end(),
+                   [](const T* a, const T* b) {
+                     return a->input_value() < b->input_value();
+                   });
+}
+
+// Moves records into new SampleBatches by best-fit decreasing: each record,
+// largest first, goes into the batch with the least room left that it fits in.
+// This uses at most 11/9 of the fewest possible batches, plus one.
+void PackBatches(const std::string& benchmark_key, const std::string& run_key,
+                 const int batch_size_max, std::vector<SizedRecord>* records,
+                 mako::DownsamplerOutput* downsampler_output) {
+  std::stable_sort(records->begin(), records->end(),
+                   [](const SizedRecord& a, const SizedRecord& b) {
+                     return a.size > b.size;
+                   });
+  const int first_batch = downsampler_output->sample_batch_list_size();
+  // Batches by the number of bytes left in them.
+  std::multimap<int64_t, mako::SampleBatch*> batches_by_room;
+  for (const SizedRecord& record : *records) {
+    mako::SampleBatch* batch;
+    int64_t room;
+    auto it = batches_by_room.lower_bound(record.size);
+    if (it == batches_by_room.end()) {
+      int64_t batch_size_bytes;
+      batch = GetNewBatch(benchmark_key, run_key, downsampler_output,
+                          &batch_size_bytes);
+      room = batch_size_max - batch_size_bytes;
+    } else {
+      batch = it->second;
+      room = it->first;
+      batches_by_room.erase(it);
+    }
+    if (record.point != nullptr) {
+      batch->add_sample_point_list()->Swap(record.point);
+    } else {
+      batch->add_sample_error_list()->Swap(record.error);
+    }
+    batches_by_room.emplace(room - record.size, batch);
+  }
+  for (int i = first_batch; i < downsampler_output->sample_batch_list_size();
+       ++i) {
+    mako::SampleBatch* batch = downsampler_output->mutable_sample_batch_list(i);
+    SortByInputValue(batch->mutable_sample_point_list());
+    SortByInputValue(batch->mutable_sample_error_list());
+  }
+}
+
 std::string Complete(const mako::DownsamplerInput& downsampler_input,
                      mako::DownsamplerOutput* downsampler_output,
                      RecordManager<mako::SamplePoint>* sample_manager,
@@ -572,25 +995,56 @@ std::string Complete(const mako::DownsamplerInput& downsampler_input,
   LOG(INFO) << "Creating SampleBatches";
   std::string benchmark_key = downsampler_input.run_info().benchmark_key();
   std::string run_key = downsampler_input.run_info().run_key();
-  if (sample_manager->slot_count() + error_manager->slot_count() > 0) {
+  const int point_field_number =
+      mako::SampleBatch::descriptor()
+          ->FindFieldByName("sample_point_list")
+          ->number();
+  const int error_field_number =
+      mako::SampleBatch::descriptor()
+          ->FindFieldByName("sample_error_list")
+          ->number();
+  if (sample_manager->slot_count() + error_manager->slot_count() > 0 &&
+      downsampler_input.standard_downsampler_options().batch_packing() ==
+          mako::StandardDownsamplerOptions::FEWEST_BATCHES) {
+    std::vector<std::unique_ptr<mako::SamplePoint>> points =
+        SortedRecords(sample_manager);
+    std::vector<std::unique_ptr<mako::SampleError>> errors =
+        SortedRecords(error_manager);
+    std::vector<SizedRecord> sized_records;
+    sized_records.reserve(points.size() + errors.size());
+    std::string err =
+        SizeRecords(downsampler_input.batch_size_max(), point_field_number,
+                    points, &sized_records);
+    if (!err.empty()) {
+      LOG(ERROR) << err;
+      return err;
+    }
+    err = SizeRecords(downsampler_input.batch_size_max(), error_field_number,
+                      errors, &sized_records);
+    if (!err.empty()) {
+      LOG(ERROR) << err;
+      return err;
+    }
+    PackBatches(benchmark_key, run_key, downsampler_input.batch_size_max(),
+                &sized_records, downsampler_output);
+  } else if (sample_manager->slot_count() + error_manager->slot_count() > 0) {
+    // Records are added in order of ascending input_value.
     int64_t batch_size_bytes;
     mako::SampleBatch* sample_batch = GetNewBatch(
         benchmark_key, run_key, downsampler_output, &batch_size_bytes);
-    auto descriptor = sample_batch->GetDescriptor();
 
     std::string err = AddBatches(
         benchmark_key, run_key, downsampler_input.batch_size_max(),
-        descriptor->FindFieldByName("sample_point_list")->number(),
-        sample_manager, &sample_batch, &batch_size_bytes, downsampler_output);
+        point_field_number, sample_manager, &sample_batch, &batch_size_bytes,
+        downsampler_output);
     if (!err.empty()) {
       LOG(ERROR) << err;
       return err;
     }
 
     err = AddBatches(benchmark_key, run_key, downsampler_input.batch_size_max(),
-                     descriptor->FindFieldByName("sample_error_list")->number(),
-                     error_manager, &sample_batch, &batch_size_bytes,
-                     downsampler_output);
+                     error_field_number, error_manager, &sample_batch,
+                     &batch_size_bytes, downsampler_output);
     if (!err.empty()) {
       LOG(ERROR) << err;
       return err;
@@ -599,12 +1053,19 @@ std::string Complete(const mako::DownsamplerInput& downsampler_input,
 
   LOG(INFO) << downsampler_output->sample_batch_list_size()
             << " SampleBatches created.";
-  if (VLOG_IS_ON(1)) {
-    VLOG(1) << "SampleBatch sizes: ";
+  if (downsampler_output->sample_batch_list_size() > 0) {
+    int64_t total_batch_size_bytes = 0;
     for (const mako::SampleBatch& sample_batch :
          downsampler_output->sample_batch_list()) {
-      VLOG(1) << sample_batch.ByteSize();
+      VLOG(1) << "SampleBatch size: " << sample_batch.ByteSizeLong();
+      total_batch_size_bytes += sample_batch.ByteSizeLong();
     }
+    downsampler_output->set_batch_utilization(
+        static_cast<double>(total_batch_size_bytes) /
+        (static_cast<double>(downsampler_input.batch_size_max()) *
+         downsampler_output->sample_batch_list_size()));
+    LOG(INFO) << "SampleBatch utilization: "
+              << downsampler_output->batch_utilization();
   }
   return err;
 }
@@ -633,12 +1094,21 @@ std::string Downsampler::Downsample(
   LOG(INFO) << "Downsampling start, file count: "
             << downsampler_input.sample_file_list_size();
 
+  const bool largest_triangles =
+      downsampler_input.standard_downsampler_options().sampling() ==
+      mako::StandardDownsamplerOptions::LARGEST_TRIANGLE_THREE_BUCKETS;
   RecordManager<mako::SamplePoint> sample_manager(
-      "SamplePointManager", downsampler_input.metric_value_count_max(), true,
+      "SamplePointManager", downsampler_input.metric_value_count_max(),
+      largest_triangles
+          ? RecordManager<mako::SamplePoint>::Sampling::kLargestTriangles
+          : RecordManager<mako::SamplePoint>::Sampling::kUniform,
       prng_());
   RecordManager<mako::SampleError> error_manager(
       "SampleErrorManager", downsampler_input.sample_error_count_max(),
-      sample_errors_randomly, prng_());
+      sample_errors_randomly
+          ? RecordManager<mako::SampleError>::Sampling::kUniform
+          : RecordManager<mako::SampleError>::Sampling::kFirst,
+      prng_());
 
   err = ProcessFiles(downsampler_input, fileio_.get(), max_threads_,
                      &sample_manager, &error_manager);
@@ -646,6 +1116,9 @@ std::string Downsampler::Downsample(
     LOG(ERROR) << err;
     return err;
   }
+  if (largest_triangles) {
+    sample_manager.SelectLargestTriangles();
+  }
 
   err = Complete(downsampler_input, downsampler_output, &sample_manager,
                  &error_manager);
@@ -164,30 +164,47 @@ mako::SampleBatch* GetNewBatch(
     const std::string& benchmark_key, const std::string& run_key,
     mako::DownsamplerOutput* downsampler_output, int64_t* batch_size_bytes);
 
+// Strips record of the data that isn't stored, and sets size to its serialized
+// size as an element of the field_number field of a SampleBatch. Returns an
+// error if that is more than batch_size_max.
 template <typename T>
-static std::string AddBatch(const std::string& benchmark_key,
-                            const std::string& run_key,
-                            const int batch_size_max, const int field_number,
-                            T* record, mako::SampleBatch** batch,
-                            int64_t* batch_size_bytes,
-                            mako::DownsamplerOutput* downsampler_output) {
+static std::string SizeInBatch(const int batch_size_max, const int field_number,
+                               T* record, int64_t* size) {
   mako::internal::StripAuxData(record);
   int64_t record_size_bytes = record->ByteSizeLong();
   // See https://developers.google.com/protocol-buffers/docs/encoding#embedded
   // for documentation on how embedded messages are encoded.
-  int64_t record_serialized_size_in_sample_batch =
+  *size =
       record_size_bytes +
       google::protobuf::io::CodedOutputStream::VarintSize64(record_size_bytes) +
       google::protobuf::io::CodedOutputStream::VarintSize64((field_number << 3) | 2);
-  if (record_serialized_size_in_sample_batch > batch_size_max) {
+  if (*size > batch_size_max) {
     std::string err =
         absl::StrCat("Got single record (", MetricSet(record).ToString(),
-                     ", size: ", record_serialized_size_in_sample_batch,
+                     ", size: ", *size,
                      ") that is too large to fit in a SampleBatch.",
                      "batch_size_max: ", batch_size_max);
     LOG(ERROR) << err;
     return err;
   }
+  return "";
+}
+
+// Moves record into the current batch, or a new one if it doesn't fit. record
+// is left empty.
+template <typename T>
+static std::string AddBatch(const std::string& benchmark_key,
+                            const std::string& run_key,
+                            const int batch_size_max, const int field_number,
+                            T* record, mako::SampleBatch** batch,
+                            int64_t* batch_size_bytes,
+                            mako::DownsamplerOutput* downsampler_output) {
+  int64_t record_serialized_size_in_sample_batch;
+  std::string err = SizeInBatch(batch_size_max, field_number, record,
+                                &record_serialized_size_in_sample_batch);
+  if (!err.empty()) {
+    return err;
+  }
 
   if (*batch_size_bytes + record_serialized_size_in_sample_batch >
       batch_size_max) {
@@ -196,7 +213,7 @@ static std::string AddBatch(const std::string& benchmark_key,
   }
   T* new_record;
   GetNewRecord(*batch, &new_record);
-  *new_record = *record;
+  new_record->Swap(record);
   *batch_size_bytes += record_serialized_size_in_sample_batch;
   return "";
 }
@@ -15,20 +15,28 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "benchmark/benchmark.h"
 #include "glog/logging.h"
 #include "src/google/protobuf/descriptor.h"
 #include "src/google/protobuf/repeated_field.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/memory/memory.h"
 #include "absl/strings/str_cat.h"
 #include "cxx/clients/fileio/memory_fileio.h"
 #include "cxx/internal/filter_utils.h"
 #include "cxx/internal/pgmath.h"
+#include "cxx/internal/sample_columns.h"
 #include "spec/proto/mako.pb.h"
 
 namespace mako {
@@ -488,6 +496,45 @@ TEST_F(StandardMetricDownsamplerTest, SingleMetricDownsample) {
   }
 }
 
+TEST_F(StandardMetricDownsamplerTest, ColumnsFileMatchesRecordsFile) {
+  std::vector<mako::SampleRecord> data;
+  for (int i = 0; i < 100; i++) {
+    data.push_back(CreateSampleRecord(i, {{"y", i % 7}, {"z", i}}));
+    if (i % 10 == 0) {
+      SampleRecord sr = CreateSampleRecord(i, {});
+      sr.clear_sample_point();
+      sr.mutable_sample_error()->set_error_message(absl::StrCat("Error # ", i));
+      sr.mutable_sample_error()->set_input_value(i);
+      sr.mutable_sample_error()->set_sampler_name("badsampler");
+      data.push_back(sr);
+    }
+  }
+  WriteFile("records_file", data);
+  mako::memory_fileio::FileIO fileio;
+  ASSERT_TRUE(fileio.Open("columns_file", mako::FileIO::AccessMode::kWrite));
+  mako::internal::SampleColumnsWriter writer(&fileio, 32);
+  for (const auto& d : data) {
+    ASSERT_TRUE(writer.Write(d));
+  }
+  ASSERT_TRUE(writer.Flush());
+  ASSERT_TRUE(fileio.Close());
+
+  mako::DownsamplerOutput records_out;
+  ASSERT_EQ("", d_.Downsample(CreateDownsamplerInput({"records_file"}),
+                              &records_out));
+  mako::DownsamplerOutput columns_out;
+  ASSERT_EQ("", d_.Downsample(CreateDownsamplerInput({"columns_file"}),
+                              &columns_out));
+  EXPECT_EQ(100, CountPointsForMetricKey("y", columns_out.sample_batch_list()));
+  EXPECT_EQ(10, CountErrors(columns_out.sample_batch_list()));
+  ASSERT_EQ(records_out.sample_batch_list_size(),
+            columns_out.sample_batch_list_size());
+  for (int i = 0; i < records_out.sample_batch_list_size(); i++) {
+    EXPECT_EQ(records_out.sample_batch_list(i).DebugString(),
+              columns_out.sample_batch_list(i).DebugString());
+  }
+}
+
 struct SamplerInstructions {
   SamplerInstructions(const std::string& sampler_name, int file_count,
                       int metric_count, int expected_metric_count,
@@ -905,8 +952,10 @@ TEST_F(StandardMetricDownsamplerTest, SampleBatchSizeTest) {
   int expected_batch_size = expected_point_size + 2;
   int num_points = 1000 / expected_batch_size;
   for (int i = 0; i < num_points; ++i) {
-    std::string err = AddBatch("benchmark", "run", 1000, field->index(), &p,
-                               &batch, &calculated_batch_size, &out);
+    // AddBatch moves the point into the batch, so pass it a copy.
+    mako::SamplePoint point = p;
+    std::string err = AddBatch("benchmark", "run", 1000, field->index(),
+                               &point, &batch, &calculated_batch_size, &out);
     ASSERT_EQ("", err);
     ASSERT_EQ(expected_batch, batch) << "New batch created unexpectedly.";
     ASSERT_EQ(expected_batch_size * (i + 1), calculated_batch_size);
@@ -1314,6 +1363,88 @@ TEST_F(StandardMetricDownsamplerTest, FirstNErrorsSaved) {
   EXPECT_THAT(input_values, testing::UnorderedElementsAre(0));
 }
 
+TEST_F(StandardMetricDownsamplerTest, ParallelWorkersMergeFairly) {
+  // More files than threads, so that workers are reused across files.
+  constexpr int kNumFiles = 12;
+  constexpr int kRecordsPerFile = 2000;
+  constexpr int kMetricValueCountMax = 1200;
+  constexpr int kErrorCountMax = 100;
+  const std::vector<std::string> samplers = {"s1", "s2"};
+  std::vector<std::string> file_names;
+  for (int file = 0; file < kNumFiles; ++file) {
+    file_names.push_back(absl::StrCat("file", file));
+    std::vector<mako::SampleRecord> data;
+    for (int i = 0; i < kRecordsPerFile; ++i) {
+      // The input value tells the file and the position in it.
+      const double input_value = file * kRecordsPerFile + i;
+      data.push_back(CreateSampleRecord(input_value, {{"a", i}}));
+      data.push_back(CreateSampleRecord(input_value, {{"b1", i}, {"b2", i}}));
+      mako::SampleRecord error;
+      error.mutable_sample_error()->set_input_value(input_value);
+      error.mutable_sample_error()->set_sampler_name(samplers[i % 2]);
+      error.mutable_sample_error()->set_error_message("error");
+      data.push_back(error);
+    }
+    WriteFile(file_names.back(), data);
+  }
+  mako::DownsamplerInput in = CreateDownsamplerInput(
+      file_names, kErrorCountMax, kMetricValueCountMax);
+  ReseedDownsampler();
+  mako::DownsamplerOutput out;
+  ASSERT_EQ("", d_.Downsample(in, &out));
+
+  // Both metric sets have more points than fit, so each gets half the slots.
+  std::vector<double> a = GetInputsWithMetric("a", out.sample_batch_list());
+  EXPECT_EQ(kMetricValueCountMax / 2, a.size());
+  EXPECT_EQ(kMetricValueCountMax / 4,
+            CountPointsForMetricKey("b1", out.sample_batch_list()));
+  EXPECT_EQ(kMetricValueCountMax / 4,
+            CountPointsForMetricKey("b2", out.sample_batch_list()));
+
+  // Points are sampled uniformly whichever worker read them, so each file
+  // keeps about the same number.
+  std::vector<int> points_per_file(kNumFiles);
+  for (double input_value : a) {
+    ++points_per_file[static_cast<int>(input_value) / kRecordsPerFile];
+  }
+  const double expected_per_file =
+      static_cast<double>(kMetricValueCountMax / 2) / kNumFiles;
+  for (int file = 0; file < kNumFiles; ++file) {
+    EXPECT_NEAR(expected_per_file, points_per_file[file],
+                expected_per_file / 2)
+        << "file " << file;
+  }
+
+  // Each sampler gets half the errors, and the errors kept of each file are
+  // the first ones of that file.
+  std::map<std::string, std::vector<std::set<int>>> positions;
+  for (const std::string& sampler : samplers) {
+    positions[sampler].resize(kNumFiles);
+  }
+  for (const auto& batch : out.sample_batch_list()) {
+    for (const auto& sample_error : batch.sample_error_list()) {
+      const int input_value = static_cast<int>(sample_error.input_value());
+      positions[sample_error.sampler_name()][input_value / kRecordsPerFile]
+          .insert(input_value % kRecordsPerFile);
+    }
+  }
+  EXPECT_EQ(kErrorCountMax, CountErrors(out.sample_batch_list()));
+  for (const std::string& sampler : samplers) {
+    EXPECT_EQ(kErrorCountMax / samplers.size(),
+              CountErrorsForSampler(sampler, out.sample_batch_list()));
+    for (int file = 0; file < kNumFiles; ++file) {
+      // Errors of sampler s1 are at the even positions, those of s2 at the
+      // odd ones.
+      int expected_position = sampler == "s1" ? 0 : 1;
+      for (int position : positions[sampler][file]) {
+        EXPECT_EQ(expected_position, position)
+            << sampler << " file " << file;
+        expected_position += 2;
+      }
+    }
+  }
+}
+
 TEST_F(StandardMetricDownsamplerTest, ErrorsSampledRandomly) {
   constexpr int kMaxErrors = 10000;
 
@@ -1359,5 +1490,154 @@ TEST_F(StandardMetricDownsamplerTest, ErrorsSampledRandomly) {
   EXPECT_THAT(input_values, testing::UnorderedElementsAre(0));
 }
 
+TEST_F(StandardMetricDownsamplerTest, FewestBatchesPacking) {
+  constexpr int kPointsPerSize = 10;
+  // Small points take 376 bytes in a batch and large ones 576, so a batch
+  // holds two small points, or one of each.
+  std::vector<mako::SampleRecord> data;
+  for (int i = 0; i < kPointsPerSize; i++) {
+    data.push_back(CreateSampleRecord(i, {{std::string(350, 's'), i}}));
+  }
+  for (int i = kPointsPerSize; i < 2 * kPointsPerSize; i++) {
+    data.push_back(CreateSampleRecord(i, {{std::string(550, 'l'), i}}));
+  }
+  WriteFile("file1", data);
+  mako::DownsamplerInput in = CreateDownsamplerInput({"file1"});
+  in.set_batch_size_max(1000);
+
+  // In input_value order the small points are paired up, leaving the large
+  // points a batch each.
+  mako::DownsamplerOutput out;
+  ASSERT_EQ("", d_.Downsample(in, &out));
+  EXPECT_EQ(kPointsPerSize * 3 / 2, out.sample_batch_list_size());
+
+  in.mutable_standard_downsampler_options()->set_batch_packing(
+      mako::StandardDownsamplerOptions::FEWEST_BATCHES);
+  out.Clear();
+  ASSERT_EQ("", d_.Downsample(in, &out));
+  EXPECT_EQ(kPointsPerSize, out.sample_batch_list_size());
+  EXPECT_GT(out.batch_utilization(), 0.9);
+  EXPECT_LE(out.batch_utilization(), 1);
+  int point_count = 0;
+  for (const auto& batch : out.sample_batch_list()) {
+    EXPECT_EQ("benchmark_key", batch.benchmark_key());
+    EXPECT_EQ("run_key", batch.run_key());
+    EXPECT_LE(batch.ByteSizeLong(), in.batch_size_max());
+    ASSERT_EQ(2, batch.sample_point_list_size());
+    EXPECT_LT(batch.sample_point_list(0).input_value(),
+              batch.sample_point_list(1).input_value());
+    point_count += batch.sample_point_list_size();
+  }
+  EXPECT_EQ(2 * kPointsPerSize, point_count);
+}
+
+TEST_F(StandardMetricDownsamplerTest, LargestTriangleThreeBucketsSampling) {
+  constexpr int kNumPoints = 10000;
+  constexpr int kSpikeIndex = 6789;
+  std::vector<std::string> file_names = {"file1", "file2"};
+  for (const std::string& file_name : file_names) {
+    std::vector<mako::SampleRecord> data;
+    // Points of m1 are spread over the files, which are read in parallel.
+    for (int i = file_name == "file1" ? 0 : 1; i < kNumPoints; i += 2) {
+      data.push_back(
+          CreateSampleRecord(i, {{"m1", i == kSpikeIndex ? 1000 : i % 7}}));
+      data.push_back(CreateSampleRecord(i, {{"m2", i}, {"m3", -i}}));
+    }
+    WriteFile(file_name, data);
+  }
+  mako::DownsamplerInput in = CreateDownsamplerInput(file_names);
+  in.mutable_standard_downsampler_options()->set_sampling(
+      mako::StandardDownsamplerOptions::LARGEST_TRIANGLE_THREE_BUCKETS);
+  mako::DownsamplerOutput out;
+  ASSERT_EQ("", d_.Downsample(in, &out));
+
+  // Each metric set gets an equal share of the metric values.
+  std::vector<double> m1 = GetInputsWithMetric("m1", out.sample_batch_list());
+  EXPECT_EQ(kMetricValueMax / 2, m1.size());
+  EXPECT_EQ(kMetricValueMax / 4,
+            CountPointsForMetricKey("m2", out.sample_batch_list()));
+  EXPECT_EQ(kMetricValueMax / 4,
+            CountPointsForMetricKey("m3", out.sample_batch_list()));
+  // The spike, and both ends of the input values, are kept.
+  EXPECT_THAT(m1, testing::Contains(kSpikeIndex));
+  EXPECT_THAT(m1, testing::Contains(0));
+  EXPECT_THAT(m1, testing::Contains(kNumPoints - 1));
+}
+
+TEST_F(StandardMetricDownsamplerTest,
+       LargestTriangleThreeBucketsKeepsSpikesOfUnorderedInput) {
+  // Many times more points than are kept, in no order, so that the points are
+  // reduced several times before the final selection.
+  constexpr int kNumPoints = 50 * kMetricValueMax;
+  constexpr int kSpikeIndices[] = {123, 7654};
+  std::vector<int> inputs(kNumPoints);
+  std::iota(inputs.begin(), inputs.end(), 0);
+  std::shuffle(inputs.begin(), inputs.end(), std::default_random_engine(7));
+  std::vector<mako::SampleRecord> data;
+  for (int i : inputs) {
+    bool spike = std::count(std::begin(kSpikeIndices), std::end(kSpikeIndices),
+                            i) > 0;
+    data.push_back(CreateSampleRecord(i, {{"m1", spike ? 1000 : i % 7}}));
+  }
+  WriteFile("file1", data);
+  mako::DownsamplerInput in = CreateDownsamplerInput({"file1"});
+  in.mutable_standard_downsampler_options()->set_sampling(
+      mako::StandardDownsamplerOptions::LARGEST_TRIANGLE_THREE_BUCKETS);
+  mako::DownsamplerOutput out;
+  ASSERT_EQ("", d_.Downsample(in, &out));
+
+  std::vector<double> m1 = GetInputsWithMetric("m1", out.sample_batch_list());
+  EXPECT_EQ(kMetricValueMax, m1.size());
+  for (int spike_index : kSpikeIndices) {
+    EXPECT_THAT(m1, testing::Contains(spike_index));
+  }
+  EXPECT_THAT(m1, testing::Contains(0));
+  EXPECT_THAT(m1, testing::Contains(kNumPoints - 1));
+}
+
+TEST_F(StandardMetricDownsamplerTest, ManyMetricSetsShareSlotsFairly) {
+  constexpr int kNumMetricSets = 500;
+  constexpr int kSlotsPerMetricSet = 4;
+  std::vector<mako::SampleRecord> data;
+  for (int i = 0; i < 10 * kNumMetricSets; i++) {
+    data.push_back(CreateSampleRecord(
+        i, {{absl::StrCat("m", i % kNumMetricSets), i}}));
+  }
+  WriteFile("file1", data);
+  mako::DownsamplerInput in = CreateDownsamplerInput({"file1"});
+  in.set_metric_value_count_max(kNumMetricSets * kSlotsPerMetricSet);
+  mako::DownsamplerOutput out;
+  ASSERT_EQ("", d_.Downsample(in, &out));
+
+  for (int i = 0; i < kNumMetricSets; i++) {
+    EXPECT_EQ(kSlotsPerMetricSet,
+              CountPointsForMetricKey(absl::StrCat("m", i),
+                                      out.sample_batch_list()));
+  }
+}
+
+// Downsamples records spread over state.range(0) metric sets, with room for a
+// few records of each so that most records evict another.
+static void BM_DownsampleManyMetricSets(benchmark::State& state) {
+  const int num_metric_sets = state.range(0);
+  constexpr int kRecordsPerMetricSet = 20;
+  std::vector<mako::SampleRecord> data;
+  for (int i = 0; i < num_metric_sets * kRecordsPerMetricSet; i++) {
+    data.push_back(CreateSampleRecord(
+        i, {{absl::StrCat("m", i % num_metric_sets), i}}));
+  }
+  WriteFile("bm_file", data);
+  mako::DownsamplerInput in = CreateDownsamplerInput({"bm_file"});
+  in.set_metric_value_count_max(num_metric_sets * 5);
+  Downsampler d;
+  d.SetFileIO(absl::make_unique<mako::memory_fileio::FileIO>());
+  for (auto _ : state) {
+    mako::DownsamplerOutput out;
+    benchmark::DoNotOptimize(d.Downsample(in, &out));
+  }
+  state.SetItemsProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_DownsampleManyMetricSets)->Range(10, 10000);
+
 }  // namespace downsampler
 }  // namespace mako
@@ -0,0 +1,598 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/clients/fileio/disk_fileio.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "src/google/protobuf/message.h"
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "zlib.h"
+
+namespace mako {
+namespace disk_fileio {
+namespace {
+
+constexpr size_t kLengthSize = sizeof(uint64_t);
+constexpr size_t kCrcSize = sizeof(uint32_t);
+// Starts compressed files. The last byte is not zero, so an uncompressed file
+// cannot start with it, as that would be the length of a record of 2^56 bytes
+// or more.
+constexpr absl::string_view kMagic("MAKOZLIB", 8);
+
+uint32_t DecodeFixed32(const char* in) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    value |= static_cast<uint32_t>(static_cast<unsigned char>(in[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+// Returns the tables for computing CRC-32C (Castagnoli) eight bytes at a time.
+// tables[0] is the usual table for one byte; tables[k] gives the CRC of a byte
+// followed by k zero bytes.
+const uint32_t (*Crc32cTables())[256] {
+  static const uint32_t (*const tables)[256] = [] {
+    auto* tables = new uint32_t[8][256];
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 1) ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+      }
+      tables[0][i] = crc;
+    }
+    for (int k = 1; k < 8; ++k) {
+      for (uint32_t i = 0; i < 256; ++i) {
+        const uint32_t prev = tables[k - 1][i];
+        tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xff];
+      }
+    }
+    return tables;
+  }();
+  return tables;
+}
+
+// Returns the CRC-32C of data, masked as in TFRecord files since computing
+// the CRC of a string that contains embedded CRCs is problematic. Records are
+// checked as they are read, so this processes eight bytes per step.
+uint32_t MaskedCrc(absl::string_view data) {
+  const uint32_t(*tables)[256] = Crc32cTables();
+  const char* p = data.data();
+  size_t size = data.size();
+  uint32_t crc = 0xffffffff;
+  for (; size >= 8; p += 8, size -= 8) {
+    const uint32_t low = crc ^ DecodeFixed32(p);
+    const uint32_t high = DecodeFixed32(p + 4);
+    crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^
+          tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+          tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^
+          tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+  }
+  for (; size > 0; ++p, --size) {
+    crc = tables[0][(crc ^ static_cast<unsigned char>(*p)) & 0xff] ^ (crc >> 8);
+  }
+  crc = ~crc;
+  return ((crc >> 15) | (crc << 17)) + 0xa282ead8;
+}
+
+void EncodeFixed32(uint32_t value, char* out) {
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    out[i] = static_cast<char>(value >> (8 * i));
+  }
+}
+
+void EncodeFixed64(uint64_t value, char* out) {
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    out[i] = static_cast<char>(value >> (8 * i));
+  }
+}
+
+uint64_t DecodeFixed64(const char* in) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(in[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+// Writes the length and the checksum of the length that go before a record of
+// the given length.
+void EncodeHeader(uint64_t length, char* header) {
+  EncodeFixed64(length, header);
+  EncodeFixed32(MaskedCrc(absl::string_view(header, kLengthSize)),
+                header + kLengthSize);
+}
+
+// Appends data to out, framed as it is in uncompressed files.
+void AppendRecord(absl::string_view data, std::string* out) {
+  char header[kLengthSize + kCrcSize];
+  EncodeHeader(data.size(), header);
+  char footer[kCrcSize];
+  EncodeFixed32(MaskedCrc(data), footer);
+  out->append(header, sizeof(header));
+  out->append(data.data(), data.size());
+  out->append(footer, sizeof(footer));
+}
+
+// Returns whether the file at path has any contents, setting *compressed to
+// whether it starts with kMagic.
+bool InspectFile(const std::string& path, bool* compressed) {
+  *compressed = false;
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  char magic[kMagic.size()];
+  const size_t size = fread(magic, 1, sizeof(magic), file);
+  fclose(file);
+  *compressed = absl::string_view(magic, size) == kMagic;
+  return size > 0;
+}
+
+// Creates the directories in path that do not exist, excluding its last
+// component. Returns false, leaving errno set, on failure.
+bool CreateParentDirectories(absl::string_view path) {
+  for (size_t slash = path.find('/', 1); slash != absl::string_view::npos;
+       slash = path.find('/', slash + 1)) {
+    const std::string dir(path.substr(0, slash));
+    if (mkdir(dir.c_str(), 0777) != 0 && errno != EEXIST) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+constexpr size_t FileIO::kDefaultBufferSize;
+constexpr size_t FileIO::kCompressionBlockSize;
+
+FileIO::FileIO(size_t buffer_size, bool mmap_reads)
+    : buffer_size_(buffer_size), mmap_reads_(mmap_reads) {}
+
+void FileIO::SetError(absl::string_view err_msg) {
+  if (err_msg.empty()) {
+    error_ = std::string(err_msg);
+  } else {
+    error_ = absl::StrCat("disk_fileio::FileIO ", err_msg);
+  }
+}
+
+void FileIO::SetErrnoError(absl::string_view action) {
+  SetError(absl::StrCat("Could not ", action, " ", path_, ": ",
+                        strerror(errno)));
+}
+
+bool FileIO::Open(absl::string_view path, mako::FileIO::AccessMode mode) {
+  if (file_ != nullptr || mapped_) {
+    SetError("File is still open for reading or writing. Call Close() first.");
+    return false;
+  }
+  path_ = std::string(path);
+  writing_ = mode != mako::FileIO::AccessMode::kRead;
+  read_eof_ = false;
+  compressed_ = false;
+  block_.clear();
+  block_offset_ = 0;
+  if (writing_ && !CreateParentDirectories(path)) {
+    SetErrnoError("create the directories of");
+    return false;
+  }
+  if (!writing_ && mmap_reads_ && Map()) {
+    if (map_size_ >= kMagic.size() &&
+        absl::string_view(map_, kMagic.size()) == kMagic) {
+      compressed_ = true;
+      map_offset_ = kMagic.size();
+    }
+    return true;
+  }
+  // Whether the file starts out empty, so that it is given a header if it is
+  // to be compressed.
+  bool empty = mode == mako::FileIO::AccessMode::kWrite;
+  const char* fopen_mode = "rb";
+  if (mode == mako::FileIO::AccessMode::kWrite) {
+    fopen_mode = "wb";
+  } else if (mode == mako::FileIO::AccessMode::kAppend) {
+    fopen_mode = "ab";
+    // Records appended to a file are stored the way the file already stores
+    // them.
+    empty = !InspectFile(path_, &compressed_);
+  }
+  if (empty) {
+    compressed_ = compression_ != Compression::kNone;
+  }
+  file_ = fopen(path_.c_str(), fopen_mode);
+  if (file_ == nullptr) {
+    SetErrnoError("open");
+    return false;
+  }
+  if (buffer_ == nullptr && buffer_size_ > 0) {
+    buffer_ = absl::make_unique<char[]>(buffer_size_);
+  }
+  setvbuf(file_, buffer_.get(), buffer_size_ > 0 ? _IOFBF : _IONBF,
+          buffer_size_);
+  if (writing_) {
+    if (compressed_ && empty &&
+        fwrite(kMagic.data(), kMagic.size(), 1, file_) != 1) {
+      SetErrnoError("write to");
+      fclose(file_);
+      file_ = nullptr;
+      return false;
+    }
+    return true;
+  }
+#ifdef POSIX_FADV_SEQUENTIAL
+  // Files are read from start to end; have the OS read further ahead.
+  posix_fadvise(fileno(file_), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif  // POSIX_FADV_SEQUENTIAL
+  char magic[kMagic.size()];
+  if (fread(magic, sizeof(magic), 1, file_) == 1 &&
+      absl::string_view(magic, sizeof(magic)) == kMagic) {
+    compressed_ = true;
+  } else {
+    rewind(file_);
+  }
+  return true;
+}
+
+bool FileIO::Map() {
+  const int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+    close(fd);
+    return false;
+  }
+  map_size_ = file_stat.st_size;
+  map_offset_ = 0;
+  if (map_size_ > 0) {
+    void* map = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      close(fd);
+      return false;
+    }
+    map_ = static_cast<const char*>(map);
+    // Records are read from start to end; have the OS read further ahead and
+    // drop pages behind.
+    madvise(map, map_size_, MADV_SEQUENTIAL);
+  }
+  // The mapping stays valid once the file is closed.
+  close(fd);
+  mapped_ = true;
+  return true;
+}
+
+bool FileIO::Write(absl::string_view serialized_record) {
+  if (file_ == nullptr || !writing_) {
+    SetError("File has not been opened for writing.");
+    return false;
+  }
+  if (!compressed_) {
+    return WriteRecord(serialized_record);
+  }
+  AppendRecord(serialized_record, &block_);
+  return block_.size() < kCompressionBlockSize || WriteBlock();
+}
+
+bool FileIO::WriteBatch(const std::vector<std::string>& serialized_records) {
+  if (file_ == nullptr || !writing_) {
+    SetError("File has not been opened for writing.");
+    return false;
+  }
+  if (compressed_) {
+    for (const std::string& serialized_record : serialized_records) {
+      AppendRecord(serialized_record, &block_);
+      if (block_.size() >= kCompressionBlockSize && !WriteBlock()) {
+        return false;
+      }
+    }
+    return true;
+  }
+  // Framed into one buffer, so that the file is written once per batch rather
+  // than three times per record.
+  record_buffer_.clear();
+  for (const std::string& serialized_record : serialized_records) {
+    AppendRecord(serialized_record, &record_buffer_);
+  }
+  if (!record_buffer_.empty() &&
+      fwrite(record_buffer_.data(), record_buffer_.size(), 1, file_) != 1) {
+    SetErrnoError("write to");
+    return false;
+  }
+  return true;
+}
+
+bool FileIO::Write(const google::protobuf::Message& record) {
+  if (record.SerializeToString(&record_buffer_)) {
+    return Write(record_buffer_);
+  }
+  SetError("Failed to serialize record to string");
+  return false;
+}
+
+bool FileIO::WriteRecord(absl::string_view data) {
+  char header[kLengthSize + kCrcSize];
+  EncodeHeader(data.size(), header);
+  char footer[kCrcSize];
+  EncodeFixed32(MaskedCrc(data), footer);
+  if (fwrite(header, sizeof(header), 1, file_) != 1 ||
+      (!data.empty() && fwrite(data.data(), data.size(), 1, file_) != 1) ||
+      fwrite(footer, sizeof(footer), 1, file_) != 1) {
+    SetErrnoError("write to");
+    return false;
+  }
+  return true;
+}
+
+bool FileIO::WriteBlock() {
+  uLongf size = compressBound(block_.size());
+  compressed_block_.resize(kLengthSize + size);
+  EncodeFixed64(block_.size(), &compressed_block_[0]);
+  if (compress2(reinterpret_cast<Bytef*>(&compressed_block_[kLengthSize]),
+                &size, reinterpret_cast<const Bytef*>(block_.data()),
+                block_.size(), Z_BEST_SPEED) != Z_OK) {
+    SetError(absl::StrCat("Could not compress a block of ", path_));
+    return false;
+  }
+  compressed_block_.resize(kLengthSize + size);
+  block_.clear();
+  return WriteRecord(compressed_block_);
+}
+
+bool FileIO::ReadExactly(char* data, size_t size) {
+  if (size == 0 || fread(data, size, 1, file_) == 1) {
+    return true;
+  }
+  if (ferror(file_)) {
+    SetErrnoError("read from");
+  } else {
+    SetError(absl::StrCat("Truncated record in ", path_));
+  }
+  return false;
+}
+
+bool FileIO::ParseRecord(absl::string_view data, size_t* offset,
+                         absl::string_view* record) {
+  const size_t remaining = data.size() - *offset;
+  if (remaining == 0) {
+    SetError("EOF");
+    read_eof_ = true;
+    return false;
+  }
+  const char* header = data.data() + *offset;
+  if (remaining < kLengthSize + kCrcSize) {
+    SetError(absl::StrCat("Truncated record in ", path_));
+    return false;
+  }
+  if (DecodeFixed32(header + kLengthSize) !=
+      MaskedCrc(absl::string_view(header, kLengthSize))) {
+    SetError(absl::StrCat("Corrupted record length in ", path_));
+    return false;
+  }
+  const uint64_t length = DecodeFixed64(header);
+  if (remaining < kLengthSize + 2 * kCrcSize ||
+      length > remaining - kLengthSize - 2 * kCrcSize) {
+    SetError(absl::StrCat("Truncated record in ", path_));
+    return false;
+  }
+  const absl::string_view record_data(header + kLengthSize + kCrcSize, length);
+  if (DecodeFixed32(record_data.data() + length) != MaskedCrc(record_data)) {
+    SetError(absl::StrCat("Corrupted record data in ", path_));
+    return false;
+  }
+  *offset += kLengthSize + 2 * kCrcSize + length;
+  *record = record_data;
+  return true;
+}
+
+bool FileIO::ReadFileRecord(std::string* data) {
+  if (file_ == nullptr || writing_) {
+    SetError("File is not open for read.");
+    return false;
+  }
+  char header[kLengthSize + kCrcSize];
+  // Distinguish the end of the file, between records, from a cut-off header.
+  const int first = getc(file_);
+  if (first == EOF) {
+    if (ferror(file_)) {
+      SetErrnoError("read from");
+      return false;
+    }
+    SetError("EOF");
+    read_eof_ = true;
+    return false;
+  }
+  header[0] = static_cast<char>(first);
+  if (!ReadExactly(header + 1, sizeof(header) - 1)) {
+    return false;
+  }
+  if (DecodeFixed32(header + kLengthSize) !=
+      MaskedCrc(absl::string_view(header, kLengthSize))) {
+    SetError(absl::StrCat("Corrupted record length in ", path_));
+    return false;
+  }
+  const uint64_t length = DecodeFixed64(header);
+  data->resize(length);
+  char footer[kCrcSize];
+  if (!ReadExactly(&(*data)[0], length) ||
+      !ReadExactly(footer, sizeof(footer))) {
+    return false;
+  }
+  if (DecodeFixed32(footer) != MaskedCrc(*data)) {
+    SetError(absl::StrCat("Corrupted record data in ", path_));
+    return false;
+  }
+  return true;
+}
+
+bool FileIO::ReadStoredRecord(absl::string_view* data) {
+  if (mapped_) {
+    return ParseRecord(absl::string_view(map_, map_size_), &map_offset_, data);
+  }
+  if (!ReadFileRecord(&record_buffer_)) {
+    return false;
+  }
+  *data = record_buffer_;
+  return true;
+}
+
+bool FileIO::Decompress(absl::string_view block) {
+  if (block.size() < kLengthSize) {
+    SetError(absl::StrCat("Corrupted compressed block in ", path_));
+    return false;
+  }
+  uLongf size = DecodeFixed64(block.data());
+  block_.resize(size);
+  if (uncompress(reinterpret_cast<Bytef*>(&block_[0]), &size,
+                 reinterpret_cast<const Bytef*>(block.data() + kLengthSize),
+                 block.size() - kLengthSize) != Z_OK ||
+      size != block_.size()) {
+    SetError(absl::StrCat("Corrupted compressed block in ", path_));
+    return false;
+  }
+  block_offset_ = 0;
+  return true;
+}
+
+bool FileIO::ReadView(absl::string_view* serialized_record) {
+  if (!compressed_) {
+    return ReadStoredRecord(serialized_record);
+  }
+  while (block_offset_ == block_.size()) {
+    absl::string_view block;
+    if (!ReadStoredRecord(&block) || !Decompress(block)) {
+      return false;
+    }
+  }
+  return ParseRecord(block_, &block_offset_, serialized_record);
+}
+
+bool FileIO::Read(std::string* serialized_record) {
+  if (!mapped_ && !compressed_) {
+    // Read straight into the caller's string.
+    return ReadFileRecord(serialized_record);
+  }
+  absl::string_view view;
+  if (!ReadView(&view)) {
+    return false;
+  }
+  serialized_record->assign(view.data(), view.size());
+  return true;
+}
+
+bool FileIO::ReadBatch(int max_records,
+                       std::vector<std::string>* serialized_records) {
+  serialized_records->resize(max_records);
+  int count = 0;
+  // Qualified, so that each record is read without a virtual call.
+  while (count < max_records && FileIO::Read(&(*serialized_records)[count])) {
+    ++count;
+  }
+  if (count < max_records && !read_eof_) {
+    count = 0;
+  }
+  serialized_records->resize(count);
+  return count > 0;
+}
+
+bool FileIO::Read(google::protobuf::Message* record) {
+  absl::string_view view;
+  if (!ReadView(&view)) {
+    return false;
+  }
+  // When the file is mapped, this parses straight from the page cache.
+  if (record->ParseFromArray(view.data(), view.size())) {
+    return true;
+  }
+  SetError("Failed to parse record from std::string.");
+  return false;
+}
+
+bool FileIO::Close() {
+  // Clear out error.
+  SetError("");
+  if (mapped_) {
+    if (map_ != nullptr) {
+      munmap(const_cast<char*>(map_), map_size_);
+    }
+    map_ = nullptr;
+    map_size_ = 0;
+    mapped_ = false;
+    compressed_ = false;
+    path_ = "";
+    return true;
+  }
+  if (file_ == nullptr) {
+    return true;
+  }
+  bool success = true;
+  if (writing_ && compressed_ && !block_.empty() && !WriteBlock()) {
+    success = false;
+  }
+  if (writing_ && fflush(file_) != 0 && success) {
+    SetErrnoError("flush");
+    success = false;
+  }
+  if (fclose(file_) != 0 && success) {
+    SetErrnoError("close");
+    success = false;
+  }
+  file_ = nullptr;
+  path_ = "";
+  writing_ = false;
+  compressed_ = false;
+  block_.clear();
+  return success;
+}
+
+bool FileIO::Delete(absl::string_view path) {
+  if (file_ != nullptr || mapped_) {
+    SetError("File is still open for reading or writing. Call Close() first.");
+    return false;
+  }
+  const std::string delete_path(path);
+  if (remove(delete_path.c_str()) != 0) {
+    SetError(absl::StrCat("Could not delete ", delete_path, ": ",
+                          strerror(errno)));
+    return false;
+  }
+  return true;
+}
+
+std::unique_ptr<mako::FileIO> FileIO::MakeInstance() {
+  auto instance = absl::make_unique<FileIO>(buffer_size_, mmap_reads_);
+  instance->set_compression(compression_);
+  return instance;
+}
+
+FileIO::~FileIO() { Close(); }
+
+}  // namespace disk_fileio
+}  // namespace mako
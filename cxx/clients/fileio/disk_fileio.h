@@ -0,0 +1,200 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#ifndef CXX_CLIENTS_FILEIO_DISK_FILEIO_H_
+#define CXX_CLIENTS_FILEIO_DISK_FILEIO_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/google/protobuf/message.h"
+#include "absl/strings/string_view.h"
+#include "cxx/spec/fileio.h"
+
+namespace mako {
+namespace disk_fileio {
+
+// An implementation of the Mako FileIO interface that stores files on local
+// disk, so that files may be larger than the available memory.
+//
+// Each record is written as:
+//   uint64 length of data, little-endian
+//   uint32 masked CRC-32C of length
+//   byte   data[length]
+//   uint32 masked CRC-32C of data
+// which is the framing of TFRecord files. Read() returns an error for a record
+// whose checksums do not match, or which is cut off.
+//
+// Files are written through a buffer of buffer_size bytes, so that the disk is
+// accessed in large blocks rather than once per record. Files are read by
+// mapping them into memory, so that records are checked and parsed straight
+// from the page cache, unless mmap_reads is false or the file cannot be
+// mapped, in which case they are read with readahead into the buffer.
+//
+// Files written after set_compression(Compression::kZlib) start with the
+// 8 bytes "MAKOZLIB" and hold records in blocks, each framed as a record
+// above, and made of:
+//   uint64 size of the uncompressed block, little-endian
+//   byte   zlib compressed records, framed as above
+// Blocks are compressed separately once they reach kCompressionBlockSize
+// bytes, so a reader can start at any block, and a file can be split at
+// block boundaries among parallel readers. Read() detects how a file was
+// written, and records appended to a file are stored the way it stores them.
+//
+// THIS CLASS IS NOT THREAD SAFE
+// (But using different instances from threads IS safe)
+class FileIO : public mako::FileIO {
+ public:
+  // The buffer size used by default, and by instances made by
+  // MakeInstance() unless another buffer size was given.
+  static constexpr size_t kDefaultBufferSize = 1 << 20;
+
+  // How files opened for writing store their records.
+  enum class Compression {
+    // Records are stored one after the other.
+    kNone,
+    // Records are stored in blocks compressed with zlib.
+    kZlib,
+  };
+
+  // The uncompressed size at which a block is compressed and written.
+  static constexpr size_t kCompressionBlockSize = 256 << 10;
+
+  FileIO() : FileIO(kDefaultBufferSize) {}
+
+  explicit FileIO(size_t buffer_size, bool mmap_reads = true);
+
+  // Sets how files opened for writing from now on store their records.
+  // Defaults to Compression::kNone.
+  void set_compression(Compression compression) { compression_ = compression; }
+
+  // Open opens the given file path, creating the directories in it as needed
+  // when writing.
+  // See interface docs for more information.
+  bool Open(absl::string_view path,
+            mako::FileIO::AccessMode mode) override;
+
+  // Write appends the given record to the opened file.
+  // See interface docs for more information.
+  bool Write(const google::protobuf::Message& record) override;
+  bool Write(absl::string_view serialized_record) override;
+  bool WriteBatch(const std::vector<std::string>& serialized_records) override;
+
+  // Read reads the next record in the opened file
+  // See interface docs for more information.
+  bool Read(google::protobuf::Message* record) override;
+  bool Read(std::string* serialized_record) override;
+  bool ReadBatch(int max_records,
+                 std::vector<std::string>* serialized_records) override;
+
+  // Like Read(std::string*), but without copying the record when the file is
+  // mapped. The view is valid until the next call on this instance.
+  bool ReadView(absl::string_view* serialized_record);
+
+  // Returns true if last call to Read() or ReadBatch() returned false and
+  // reached EOF.
+  // See interface docs for more information.
+  bool ReadEOF() override { return read_eof_; }
+
+  // Returns the error message for the most recent failed call.
+  // See interface docs for more information.
+  std::string Error() override { return error_; }
+
+  // Close closes the opened file, flushing it if it is writable.
+  // See interface docs for more information.
+  bool Close() override;
+
+  // Delete deletes the given file.
+  // See interface docs for more information.
+  bool Delete(absl::string_view path) override;
+
+  // Returns an instance with the same buffer size, read mode and compression.
+  // See interface docs for more information.
+  std::unique_ptr<mako::FileIO> MakeInstance() override;
+
+  ~FileIO() override;
+
+ private:
+  // set value to be returned by Error() to msg
+  void SetError(absl::string_view err_msg);
+  // Sets the error for a failed call on path_, from errno.
+  void SetErrnoError(absl::string_view action);
+  // Maps the file at path_ for reading. Returns false if it cannot be mapped.
+  bool Map();
+  // Reads exactly size bytes into data. Returns false, setting the error, if
+  // the file ends or cannot be read first.
+  bool ReadExactly(char* data, size_t size);
+  // Writes data to file_, framed as a record.
+  bool WriteRecord(absl::string_view data);
+  // Compresses block_ and writes it to file_, clearing block_.
+  bool WriteBlock();
+  // Parses the framed record at *offset in data into record, which points into
+  // data, and advances *offset past it.
+  bool ParseRecord(absl::string_view data, size_t* offset,
+                   absl::string_view* record);
+  // Reads the next framed record from file_ into data.
+  bool ReadFileRecord(std::string* data);
+  // Reads the next framed record stored in the opened file, which is a block
+  // if the file is compressed.
+  bool ReadStoredRecord(absl::string_view* data);
+  // Decompresses block into block_.
+  bool Decompress(absl::string_view block);
+
+  const size_t buffer_size_;
+  const bool mmap_reads_;
+  Compression compression_ = Compression::kNone;
+  // Buffer used by file_; allocated on first Open().
+  std::unique_ptr<char[]> buffer_;
+  // The opened file, or null if the file is mapped or not open.
+  FILE* file_ = nullptr;
+  // Whether the opened file is mapped, in which case its contents are map_,
+  // which is null if the file is empty, and map_offset_ is the position of the
+  // next record.
+  bool mapped_ = false;
+  const char* map_ = nullptr;
+  size_t map_size_ = 0;
+  size_t map_offset_ = 0;
+  // Path that has been opened.
+  std::string path_;
+  // true if file has been opened for writing, false otherwise
+  bool writing_ = false;
+  // if true, at EOF
+  bool read_eof_ = false;
+  // the latest error
+  std::string error_;
+  // Reused to serialize and parse records.
+  std::string record_buffer_;
+  // Whether the opened file stores its records in compressed blocks.
+  bool compressed_ = false;
+  // The records of the block being written, or the block being read, in which
+  // block_offset_ is the position of the next record.
+  std::string block_;
+  size_t block_offset_ = 0;
+  // Reused to compress blocks.
+  std::string compressed_block_;
+
+#ifndef SWIG
+  // Not copyable.
+  FileIO(const FileIO&) = delete;
+  FileIO& operator=(const FileIO&) = delete;
+#endif  // SWIG
+};
+
+}  // namespace disk_fileio
+}  // namespace mako
+
+#endif  // CXX_CLIENTS_FILEIO_DISK_FILEIO_H_
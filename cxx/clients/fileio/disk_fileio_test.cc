@@ -0,0 +1,608 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/clients/fileio/disk_fileio.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "glog/logging.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace disk_fileio {
+namespace {
+
+int64_t FileSize(const std::string& path) {
+  struct stat file_stat;
+  CHECK_EQ(stat(path.c_str(), &file_stat), 0);
+  return file_stat.st_size;
+}
+
+class DiskFileioTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Files appended to must not be left over from an earlier run.
+    remove(TestPath("file").c_str());
+    remove(TestPath("file2").c_str());
+    remove(TestPath("a/b/d/file").c_str());
+  }
+
+  // Returns a path under the test's temporary directory that is unique to the
+  // test.
+  std::string TestPath(absl::string_view name) {
+    const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    return absl::StrCat(::testing::TempDir(), "/disk_fileio_test/",
+                        info->name(), "/", name);
+  }
+
+  // Writes a KeyedValue record for each of begin to end - 1.
+  void WriteRecords(mako::FileIO* f, const std::string& path,
+                    mako::FileIO::AccessMode mode, int begin, int end) {
+    ASSERT_TRUE(f->Open(path, mode)) << f->Error();
+    for (int i = begin; i < end; i++) {
+      KeyedValue k;
+      k.set_value_key(std::to_string(i));
+      k.set_value(i);
+      ASSERT_TRUE(f->Write(k)) << f->Error();
+    }
+    ASSERT_TRUE(f->Close()) << f->Error();
+  }
+
+  // Reads the file, expecting records begin to end - 1 as written by
+  // WriteRecords().
+  void ExpectRecords(mako::FileIO* f, const std::string& path, int begin,
+                     int end) {
+    ASSERT_TRUE(f->Open(path, mako::FileIO::AccessMode::kRead)) << f->Error();
+    KeyedValue k;
+    for (int i = begin; i < end; i++) {
+      ASSERT_TRUE(f->Read(&k)) << f->Error();
+      EXPECT_EQ(k.value(), i);
+      EXPECT_EQ(k.value_key(), std::to_string(i));
+    }
+    EXPECT_FALSE(f->Read(&k));
+    EXPECT_TRUE(f->ReadEOF());
+    EXPECT_TRUE(f->Close());
+  }
+
+  // Overwrites the byte at offset in the file.
+  void CorruptByte(const std::string& path, long offset) {
+    FILE* file = fopen(path.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fseek(file, offset, SEEK_SET), 0);
+    const int c = getc(file);
+    ASSERT_EQ(fseek(file, offset, SEEK_SET), 0);
+    putc(c ^ 0xff, file);
+    fclose(file);
+  }
+
+  // Returns the first 8 bytes of the file.
+  std::string FileStart(const std::string& path) {
+    std::string start(8, '\0');
+    FILE* file = fopen(path.c_str(), "rb");
+    EXPECT_NE(file, nullptr);
+    if (file != nullptr) {
+      start.resize(fread(&start[0], 1, start.size(), file));
+      fclose(file);
+    }
+    return start;
+  }
+};
+
+TEST_F(DiskFileioTest, WriteRecordsReadThemBack) {
+  FileIO f;
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0, 3);
+  ExpectRecords(&f, TestPath("file"), 0, 3);
+  EXPECT_TRUE(f.Error().empty());
+}
+
+TEST_F(DiskFileioTest, ManyRecordsThroughSmallBuffer) {
+  FileIO f(/*buffer_size=*/64, /*mmap_reads=*/false);
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+               10000);
+  ExpectRecords(&f, TestPath("file"), 0, 10000);
+}
+
+TEST_F(DiskFileioTest, RecordLargerThanBuffer) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(/*buffer_size=*/16, mmap_reads);
+    const std::string record(1000, 'x');
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+    ASSERT_TRUE(f.Write(record));
+    ASSERT_TRUE(f.Write(""));
+    ASSERT_TRUE(f.Close());
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    std::string read;
+    ASSERT_TRUE(f.Read(&read)) << f.Error();
+    EXPECT_EQ(read, record);
+    ASSERT_TRUE(f.Read(&read)) << f.Error();
+    EXPECT_EQ(read, "");
+    EXPECT_FALSE(f.Read(&read));
+    EXPECT_TRUE(f.ReadEOF());
+    ASSERT_TRUE(f.Close());
+  }
+}
+
+TEST_F(DiskFileioTest, ReadView) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+    ASSERT_TRUE(f.Write("first"));
+    ASSERT_TRUE(f.Write("second"));
+    ASSERT_TRUE(f.Close());
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    absl::string_view view;
+    ASSERT_TRUE(f.ReadView(&view)) << f.Error();
+    EXPECT_EQ(view, "first");
+    ASSERT_TRUE(f.ReadView(&view)) << f.Error();
+    EXPECT_EQ(view, "second");
+    EXPECT_FALSE(f.ReadView(&view));
+    EXPECT_TRUE(f.ReadEOF());
+    ASSERT_TRUE(f.Close());
+  }
+}
+
+TEST_F(DiskFileioTest, EmptyFile) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 0);
+    ExpectRecords(&f, TestPath("file"), 0, 0);
+  }
+}
+
+TEST_F(DiskFileioTest, WriteOverwrites) {
+  FileIO f;
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0, 3);
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 3, 5);
+  ExpectRecords(&f, TestPath("file"), 3, 5);
+}
+
+TEST_F(DiskFileioTest, AppendAppends) {
+  FileIO f;
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kAppend, 0, 3);
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kAppend, 3, 5);
+  ExpectRecords(&f, TestPath("file"), 0, 5);
+}
+
+TEST_F(DiskFileioTest, CreatesParentDirectories) {
+  FileIO f;
+  WriteRecords(&f, TestPath("a/b/c/file"), mako::FileIO::AccessMode::kWrite,
+               0, 1);
+  WriteRecords(&f, TestPath("a/b/d/file"), mako::FileIO::AccessMode::kAppend,
+               0, 1);
+  ExpectRecords(&f, TestPath("a/b/c/file"), 0, 1);
+  ExpectRecords(&f, TestPath("a/b/d/file"), 0, 1);
+}
+
+TEST_F(DiskFileioTest, OpenForWritingTwice) {
+  FileIO f;
+  ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+  ASSERT_FALSE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+  ASSERT_TRUE(f.Close());
+}
+
+TEST_F(DiskFileioTest, OpenForReadingNoSuchFile) {
+  FileIO f;
+  ASSERT_FALSE(f.Open(TestPath("nosuch"), mako::FileIO::AccessMode::kRead));
+  EXPECT_THAT(f.Error(), testing::HasSubstr("nosuch"));
+  ASSERT_TRUE(f.Close());
+}
+
+TEST_F(DiskFileioTest, ReadWhileWriting) {
+  FileIO f;
+  ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+  KeyedValue k;
+  ASSERT_FALSE(f.Read(&k));
+  ASSERT_FALSE(f.ReadEOF());
+  ASSERT_TRUE(f.Close());
+
+  ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+  ASSERT_FALSE(f.Write(k));
+}
+
+TEST_F(DiskFileioTest, MakeInstance) {
+  FileIO f;
+  std::unique_ptr<mako::FileIO> f2 = f.MakeInstance();
+  WriteRecords(f2.get(), TestPath("file"), mako::FileIO::AccessMode::kWrite,
+               0, 3);
+  ExpectRecords(&f, TestPath("file"), 0, 3);
+}
+
+TEST_F(DiskFileioTest, Delete) {
+  FileIO f;
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0, 1);
+
+  // Won't delete while the file is open.
+  ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+  ASSERT_FALSE(f.Delete(TestPath("file")));
+  ASSERT_TRUE(f.Close());
+
+  ASSERT_TRUE(f.Delete(TestPath("file")));
+  ASSERT_FALSE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+  ASSERT_FALSE(f.Delete(TestPath("file")));
+}
+
+TEST_F(DiskFileioTest, CorruptedLength) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 2);
+    CorruptByte(TestPath("file"), 0);
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    KeyedValue k;
+    ASSERT_FALSE(f.Read(&k));
+    EXPECT_FALSE(f.ReadEOF());
+    EXPECT_THAT(f.Error(), testing::HasSubstr("Corrupted record length"));
+  }
+}
+
+TEST_F(DiskFileioTest, CorruptedData) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 2);
+    // The first byte of the first record's data, after its header.
+    CorruptByte(TestPath("file"), 12);
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    KeyedValue k;
+    ASSERT_FALSE(f.Read(&k));
+    EXPECT_FALSE(f.ReadEOF());
+    EXPECT_THAT(f.Error(), testing::HasSubstr("Corrupted record data"));
+  }
+}
+
+TEST_F(DiskFileioTest, TruncatedRecord) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    ASSERT_TRUE(
+        f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+    ASSERT_TRUE(f.Write("record"));
+    ASSERT_TRUE(f.Close());
+    // Leave off the record's checksum.
+    ASSERT_EQ(truncate(TestPath("file").c_str(), 12 + 6), 0);
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    std::string record;
+    ASSERT_FALSE(f.Read(&record));
+    EXPECT_FALSE(f.ReadEOF());
+    EXPECT_THAT(f.Error(), testing::HasSubstr("Truncated record"));
+  }
+}
+
+TEST_F(DiskFileioTest, CompressedRecordsReadBack) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    f.set_compression(FileIO::Compression::kZlib);
+    // Enough records for several blocks.
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 50000);
+    EXPECT_EQ(FileStart(TestPath("file")), "MAKOZLIB");
+    ExpectRecords(&f, TestPath("file"), 0, 50000);
+
+    // Readers do not need to know how the file was written.
+    FileIO uncompressed(FileIO::kDefaultBufferSize, mmap_reads);
+    ExpectRecords(&uncompressed, TestPath("file"), 0, 50000);
+  }
+}
+
+TEST_F(DiskFileioTest, CompressedFileIsSmaller) {
+  FileIO f;
+  WriteRecords(&f, TestPath("uncompressed"), mako::FileIO::AccessMode::kWrite,
+               0, 10000);
+  f.set_compression(FileIO::Compression::kZlib);
+  WriteRecords(&f, TestPath("compressed"), mako::FileIO::AccessMode::kWrite, 0,
+               10000);
+  EXPECT_LT(FileSize(TestPath("compressed")) * 2,
+            FileSize(TestPath("uncompressed")));
+}
+
+TEST_F(DiskFileioTest, CompressedEmptyFile) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    f.set_compression(FileIO::Compression::kZlib);
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 0);
+    EXPECT_EQ(FileStart(TestPath("file")), "MAKOZLIB");
+    ExpectRecords(&f, TestPath("file"), 0, 0);
+  }
+}
+
+TEST_F(DiskFileioTest, CompressedHeaderNotWritten) {
+  // Unbuffered, so writing the header to the full device fails in Open().
+  FileIO f(/*buffer_size=*/0);
+  f.set_compression(FileIO::Compression::kZlib);
+  ASSERT_FALSE(f.Open("/dev/full", mako::FileIO::AccessMode::kWrite));
+  EXPECT_THAT(f.Error(), testing::HasSubstr("/dev/full"));
+  // The file was closed, so another can be opened.
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0, 1);
+  ExpectRecords(&f, TestPath("file"), 0, 1);
+}
+
+TEST_F(DiskFileioTest, AppendKeepsCompressionOfFile) {
+  FileIO compressed;
+  compressed.set_compression(FileIO::Compression::kZlib);
+  FileIO uncompressed;
+
+  WriteRecords(&compressed, TestPath("file"),
+               mako::FileIO::AccessMode::kAppend, 0, 3);
+  WriteRecords(&uncompressed, TestPath("file"),
+               mako::FileIO::AccessMode::kAppend, 3, 5);
+  EXPECT_EQ(FileStart(TestPath("file")), "MAKOZLIB");
+  ExpectRecords(&uncompressed, TestPath("file"), 0, 5);
+
+  WriteRecords(&uncompressed, TestPath("file2"),
+               mako::FileIO::AccessMode::kAppend, 0, 3);
+  WriteRecords(&compressed, TestPath("file2"),
+               mako::FileIO::AccessMode::kAppend, 3, 5);
+  EXPECT_NE(FileStart(TestPath("file2")), "MAKOZLIB");
+  ExpectRecords(&compressed, TestPath("file2"), 0, 5);
+}
+
+TEST_F(DiskFileioTest, MakeInstanceKeepsCompression) {
+  FileIO f;
+  f.set_compression(FileIO::Compression::kZlib);
+  std::unique_ptr<mako::FileIO> f2 = f.MakeInstance();
+  WriteRecords(f2.get(), TestPath("file"), mako::FileIO::AccessMode::kWrite,
+               0, 3);
+  EXPECT_EQ(FileStart(TestPath("file")), "MAKOZLIB");
+  ExpectRecords(&f, TestPath("file"), 0, 3);
+}
+
+TEST_F(DiskFileioTest, CorruptedCompressedBlock) {
+  for (bool mmap_reads : {false, true}) {
+    SCOPED_TRACE(mmap_reads);
+    FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+    f.set_compression(FileIO::Compression::kZlib);
+    WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0,
+                 100);
+    // A byte of the compressed data, after the magic, the block's header and
+    // its uncompressed size.
+    CorruptByte(TestPath("file"), 8 + 12 + 8 + 4);
+
+    ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+    KeyedValue k;
+    ASSERT_FALSE(f.Read(&k));
+    EXPECT_FALSE(f.ReadEOF());
+    EXPECT_THAT(f.Error(), testing::HasSubstr("Corrupted record data"));
+  }
+}
+
+TEST_F(DiskFileioTest, WriteBatchReadBatch) {
+  for (bool compressed : {false, true}) {
+    for (bool mmap_reads : {false, true}) {
+      SCOPED_TRACE(absl::StrCat(compressed, mmap_reads));
+      FileIO f(FileIO::kDefaultBufferSize, mmap_reads);
+      if (compressed) {
+        f.set_compression(FileIO::Compression::kZlib);
+      }
+      // Batches of 1000 records, with single records between them.
+      ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kWrite));
+      std::vector<std::string> batch;
+      KeyedValue k;
+      for (int i = 0; i < 20020; i++) {
+        k.set_value_key(std::to_string(i));
+        k.set_value(i);
+        if (i % 1001 == 1000) {
+          ASSERT_TRUE(f.WriteBatch(batch)) << f.Error();
+          batch.clear();
+          ASSERT_TRUE(f.Write(k)) << f.Error();
+        } else {
+          batch.push_back(k.SerializeAsString());
+        }
+      }
+      ASSERT_TRUE(f.WriteBatch(batch)) << f.Error();
+      ASSERT_TRUE(f.Close()) << f.Error();
+      ExpectRecords(&f, TestPath("file"), 0, 20020);
+
+      ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+      int i = 0;
+      while (f.ReadBatch(333, &batch)) {
+        ASSERT_TRUE(batch.size() == 333 || i + batch.size() == 20020)
+            << batch.size();
+        for (const std::string& record : batch) {
+          ASSERT_TRUE(k.ParseFromString(record));
+          EXPECT_EQ(k.value(), i++);
+        }
+      }
+      EXPECT_TRUE(f.ReadEOF()) << f.Error();
+      EXPECT_TRUE(batch.empty());
+      EXPECT_EQ(i, 20020);
+      EXPECT_TRUE(f.Close());
+    }
+  }
+}
+
+TEST_F(DiskFileioTest, ReadBatchCorruptedRecord) {
+  FileIO f(FileIO::kDefaultBufferSize, /*mmap_reads=*/false);
+  WriteRecords(&f, TestPath("file"), mako::FileIO::AccessMode::kWrite, 0, 10);
+  // The last byte of the data of the fifth record.
+  CorruptByte(TestPath("file"), 5 * FileSize(TestPath("file")) / 10 - 5);
+
+  ASSERT_TRUE(f.Open(TestPath("file"), mako::FileIO::AccessMode::kRead));
+  std::vector<std::string> batch;
+  ASSERT_FALSE(f.ReadBatch(8, &batch));
+  EXPECT_FALSE(f.ReadEOF());
+  EXPECT_THAT(f.Error(), testing::HasSubstr("Corrupted record data"));
+}
+
+// Writes count sample records to the file at path, returning the number of
+// bytes in the records.
+int64_t WriteSampleRecords(FileIO* f, const std::string& path, int count) {
+  CHECK(f->Open(path, mako::FileIO::AccessMode::kWrite)) << f->Error();
+  SampleRecord record;
+  SamplePoint* point = record.mutable_sample_point();
+  for (const char* key : {"m1", "m2", "m3"}) {
+    point->add_metric_value_list()->set_value_key(key);
+  }
+  int64_t bytes = 0;
+  for (int i = 0; i < count; ++i) {
+    point->set_input_value(i);
+    for (auto& metric_value : *point->mutable_metric_value_list()) {
+      metric_value.set_value(i * 0.5);
+    }
+    bytes += record.ByteSizeLong();
+    CHECK(f->Write(record)) << f->Error();
+  }
+  CHECK(f->Close()) << f->Error();
+  return bytes;
+}
+
+constexpr int kBenchmarkRecords = 1000000;
+
+// Returns the path of a file of sample records, compressed if compressed is
+// true, written on first use, and sets record_bytes to the number of bytes in
+// its records.
+const std::string& BenchmarkFile(bool compressed, int64_t* record_bytes) {
+  static int64_t bytes = 0;
+  static const std::string* const paths = [] {
+    auto* paths = new std::string[2];
+    for (bool compressed : {false, true}) {
+      paths[compressed] = absl::StrCat(::testing::TempDir(),
+                                       "/disk_fileio_benchmark", compressed);
+      FileIO f;
+      if (compressed) {
+        f.set_compression(FileIO::Compression::kZlib);
+      }
+      bytes = WriteSampleRecords(&f, paths[compressed], kBenchmarkRecords);
+    }
+    return paths;
+  }();
+  *record_bytes = bytes;
+  return paths[compressed];
+}
+
+// Reports the throughput in bytes of records, and the bytes of records per
+// byte of the file at path.
+void SetCounters(benchmark::State& state, int64_t record_bytes,
+                 const std::string& path) {
+  state.SetBytesProcessed(state.iterations() * record_bytes);
+  state.counters["compression_ratio"] =
+      static_cast<double>(record_bytes) / FileSize(path);
+}
+
+// Writes sample records, compressed if state.range(0) is nonzero.
+static void BM_WriteRecords(benchmark::State& state) {
+  const std::string path =
+      absl::StrCat(::testing::TempDir(), "/disk_fileio_write_benchmark");
+  FileIO f;
+  if (state.range(0) != 0) {
+    f.set_compression(FileIO::Compression::kZlib);
+  }
+  int64_t record_bytes = 0;
+  for (auto _ : state) {
+    record_bytes = WriteSampleRecords(&f, path, 100000);
+  }
+  SetCounters(state, record_bytes, path);
+  CHECK(f.Delete(path)) << f.Error();
+}
+BENCHMARK(BM_WriteRecords)->Arg(0)->Arg(1);
+
+// Writes the sample records of BM_WriteRecords serialized in batches of 1000,
+// compressed if state.range(0) is nonzero.
+static void BM_WriteBatches(benchmark::State& state) {
+  const std::string path =
+      absl::StrCat(::testing::TempDir(), "/disk_fileio_write_benchmark");
+  FileIO f;
+  if (state.range(0) != 0) {
+    f.set_compression(FileIO::Compression::kZlib);
+  }
+  std::vector<std::string> batches[100];
+  int64_t record_bytes = 0;
+  SampleRecord record;
+  SamplePoint* point = record.mutable_sample_point();
+  for (const char* key : {"m1", "m2", "m3"}) {
+    point->add_metric_value_list()->set_value_key(key);
+  }
+  for (int i = 0; i < 100000; ++i) {
+    point->set_input_value(i);
+    for (auto& metric_value : *point->mutable_metric_value_list()) {
+      metric_value.set_value(i * 0.5);
+    }
+    batches[i / 1000].push_back(record.SerializeAsString());
+    record_bytes += batches[i / 1000].back().size();
+  }
+  for (auto _ : state) {
+    CHECK(f.Open(path, mako::FileIO::AccessMode::kWrite)) << f.Error();
+    for (const auto& batch : batches) {
+      CHECK(f.WriteBatch(batch)) << f.Error();
+    }
+    CHECK(f.Close()) << f.Error();
+  }
+  SetCounters(state, record_bytes, path);
+  CHECK(f.Delete(path)) << f.Error();
+}
+BENCHMARK(BM_WriteBatches)->Arg(0)->Arg(1);
+
+// Parses every record of the benchmark file, with mmap reads if
+// state.range(0) is nonzero, from the compressed file if state.range(1) is
+// nonzero.
+static void BM_ReadRecords(benchmark::State& state) {
+  int64_t record_bytes;
+  const std::string& path = BenchmarkFile(state.range(1) != 0, &record_bytes);
+  FileIO f(FileIO::kDefaultBufferSize, state.range(0) != 0);
+  SampleRecord record;
+  for (auto _ : state) {
+    CHECK(f.Open(path, mako::FileIO::AccessMode::kRead)) << f.Error();
+    while (f.Read(&record)) {
+    }
+    CHECK(f.ReadEOF()) << f.Error();
+    CHECK(f.Close());
+  }
+  SetCounters(state, record_bytes, path);
+}
+BENCHMARK(BM_ReadRecords)->Args({0, 0})->Args({1, 0})->Args({0, 1})->Args({1, 1});
+
+// Checks every record of the benchmark file without parsing it, with mmap
+// reads if state.range(0) is nonzero, from the compressed file if
+// state.range(1) is nonzero.
+static void BM_ReadViews(benchmark::State& state) {
+  int64_t record_bytes;
+  const std::string& path = BenchmarkFile(state.range(1) != 0, &record_bytes);
+  FileIO f(FileIO::kDefaultBufferSize, state.range(0) != 0);
+  absl::string_view view;
+  for (auto _ : state) {
+    CHECK(f.Open(path, mako::FileIO::AccessMode::kRead)) << f.Error();
+    while (f.ReadView(&view)) {
+    }
+    CHECK(f.ReadEOF()) << f.Error();
+    CHECK(f.Close());
+  }
+  SetCounters(state, record_bytes, path);
+}
+BENCHMARK(BM_ReadViews)->Args({0, 0})->Args({1, 0})->Args({0, 1})->Args({1, 1});
+
+}  // namespace
+}  // namespace disk_fileio
+}  // namespace mako
@@ -13,6 +13,7 @@
 // limitations under the license.
 #include "cxx/clients/fileio/memory_fileio.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -29,10 +30,10 @@ namespace mako {
 namespace memory_fileio {
 
 ABSL_CONST_INIT absl::Mutex FileIO::files_mu_(absl::kConstInit);
-// Mapping from file path to list of records written to that path.
-absl::flat_hash_map<std::string, std::unique_ptr<FileIO::File>>*
+// Mapping from file path to the records written to that path.
+absl::flat_hash_map<std::string, std::shared_ptr<FileIO::FileData>>*
     FileIO::files_ =
-        new absl::flat_hash_map<std::string, std::unique_ptr<FileIO::File>>;
+        new absl::flat_hash_map<std::string, std::shared_ptr<FileIO::FileData>>;
 
 FileIO::FileIO()
     : error_prefix_("memory_fileio::FileIO "),
@@ -48,6 +49,13 @@ void FileIO::SetError(absl::string_view err_msg) {
   }
 }
 
+void FileIO::MarkDeleted(FileData* file) {
+  if (file != nullptr) {
+    absl::MutexLock lock(&file->mu);
+    file->deleted = true;
+  }
+}
+
 bool FileIO::Open(absl::string_view path, mako::FileIO::AccessMode mode) {
   if (!open_error_.empty()) {
     SetError(open_error_);
@@ -60,27 +68,34 @@ bool FileIO::Open(absl::string_view path, mako::FileIO::AccessMode mode) {
 
   absl::MutexLock lock(&files_mu_);
 
+  auto search = files_->find(path);
+  std::shared_ptr<FileData> file =
+      search == files_->end() ? nullptr : search->second;
   if (mode == mako::FileIO::AccessMode::kWrite) {
-    (*files_)[path] = absl::make_unique<FileIO::File>();
+    MarkDeleted(file.get());
+    file = std::make_shared<FileData>();
+    (*files_)[path] = file;
     writing_ = true;
   } else if (mode == mako::FileIO::AccessMode::kAppend) {
-    if (files_->count(path) == 0) {
-      (*files_)[path] = absl::make_unique<FileIO::File>();
+    if (file == nullptr) {
+      file = std::make_shared<FileData>();
+      (*files_)[path] = file;
     }
     writing_ = true;
   } else {
-    if (nullptr == GetFileForPath(path)) {
+    if (file == nullptr) {
       SetError(absl::StrCat("File not found at: ", path));
       return false;
     }
     read_idx_ = 0;
   }
+  file_ = std::move(file);
   // Save the path we're operating on.
   path_ = std::string(path);
   return true;
 }
 
-bool FileIO::Write(absl::string_view serialized_record) {
+bool FileIO::CheckWritable() {
   if (!write_error_.empty()) {
     SetError(write_error_);
     return false;
@@ -89,13 +104,39 @@ bool FileIO::Write(absl::string_view serialized_record) {
     SetError("File has not been opened for writing.");
     return false;
   }
-  absl::MutexLock lock(&files_mu_);
-  auto file = GetFileForPath(path_);
-  if (nullptr == file) {
-    SetError("File cannot be written to. It has been deleted.");
+  return true;
+}
+
+bool FileIO::CheckNotDeleted(absl::string_view action) {
+  if (file_->deleted) {
+    SetError(absl::StrCat("File cannot be ", action, ". It has been deleted."));
+    return false;
+  }
+  return true;
+}
+
+bool FileIO::Write(absl::string_view serialized_record) {
+  if (!CheckWritable()) {
+    return false;
+  }
+  absl::MutexLock lock(&file_->mu);
+  if (!CheckNotDeleted("written to")) {
     return false;
   }
-  file->push_back(std::string(serialized_record));
+  file_->records.push_back(std::string(serialized_record));
+  return true;
+}
+
+bool FileIO::WriteBatch(const std::vector<std::string>& serialized_records) {
+  if (!CheckWritable()) {
+    return false;
+  }
+  absl::MutexLock lock(&file_->mu);
+  if (!CheckNotDeleted("written to")) {
+    return false;
+  }
+  file_->records.insert(file_->records.end(), serialized_records.begin(),
+                        serialized_records.end());
   return true;
 }
 
@@ -112,7 +153,7 @@ bool FileIO::Write(const google::protobuf::Message& record) {
   return false;
 }
 
-bool FileIO::Read(std::string* serialized_record) {
+bool FileIO::CheckReadable() {
   if (!read_error_.empty()) {
     SetError(read_error_);
     return false;
@@ -121,44 +162,70 @@ bool FileIO::Read(std::string* serialized_record) {
     SetError("File is not open for read.");
     return false;
   }
-  absl::MutexLock lock(&files_mu_);
-  auto file = GetFileForPath(path_);
-  if (nullptr == file) {
-    SetError("File cannot be read from. It has been deleted.");
+  return true;
+}
+
+bool FileIO::HasNextRecord() {
+  if (!CheckNotDeleted("read from")) {
     return false;
   }
-  if (static_cast<std::size_t>(read_idx_) >=
-      file->size()) {
+  if (static_cast<std::size_t>(read_idx_) >= file_->records.size()) {
     SetError("EOF");
     read_eof_ = true;
     return false;
   }
-  *serialized_record = file->at(read_idx_++);
   return true;
 }
 
+bool FileIO::Read(std::string* serialized_record) {
+  if (!CheckReadable()) {
+    return false;
+  }
+  absl::ReaderMutexLock lock(&file_->mu);
+  if (!HasNextRecord()) {
+    return false;
+  }
+  *serialized_record = file_->records[read_idx_++];
+  return true;
+}
+
+bool FileIO::ReadBatch(int max_records,
+                       std::vector<std::string>* serialized_records) {
+  if (!CheckReadable()) {
+    serialized_records->clear();
+    return false;
+  }
+  absl::ReaderMutexLock lock(&file_->mu);
+  if (!HasNextRecord()) {
+    serialized_records->clear();
+    return false;
+  }
+  const File& records = file_->records;
+  const int count =
+      std::min<std::size_t>(max_records, records.size() - read_idx_);
+  serialized_records->resize(count);
+  std::copy(records.begin() + read_idx_, records.begin() + read_idx_ + count,
+            serialized_records->begin());
+  read_idx_ += count;
+  return count > 0;
+}
+
 bool FileIO::Read(google::protobuf::Message* record) {
-  if (!read_error_.empty()) {
-    SetError(read_error_);
+  if (!CheckReadable()) {
     return false;
   }
-  std::string serialized_record;
-  if (!Read(&serialized_record)) {
+  absl::ReaderMutexLock lock(&file_->mu);
+  if (!HasNextRecord()) {
     return false;
   }
-  if (record->ParseFromString(serialized_record)) {
+  // Parsed in place rather than from a copy of the record.
+  if (record->ParseFromString(file_->records[read_idx_++])) {
     return true;
   }
   SetError("Failed to parse record from std::string.");
   return false;
 }
 
-FileIO::File* FileIO::GetFileForPath(absl::string_view path)
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(files_mu_) {
-  auto search = files_->find(path);
-  return search == files_->end() ? nullptr : search->second.get();
-}
-
 bool FileIO::Delete(absl::string_view path) {
   if (!delete_error_.empty()) {
     SetError(delete_error_);
@@ -169,15 +236,21 @@ bool FileIO::Delete(absl::string_view path) {
     return false;
   }
   absl::MutexLock lock(&files_mu_);
-  if (files_->erase(path) != 1) {
+  auto search = files_->find(path);
+  if (search == files_->end()) {
     SetError(absl::StrCat("No such file path: ", path));
     return false;
   }
+  MarkDeleted(search->second.get());
+  files_->erase(search);
   return true;
 }
 
 bool FileIO::Clear() {
   absl::MutexLock lock(&files_mu_);
+  for (const auto& path_and_file : *files_) {
+    MarkDeleted(path_and_file.second.get());
+  }
   files_->clear();
   return true;
 }
@@ -192,6 +265,7 @@ bool FileIO::Close() {
   path_ = "";
   writing_ = false;
   read_idx_ = -1;
+  file_.reset();
   return true;
 }
 
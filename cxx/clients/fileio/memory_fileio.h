@@ -24,6 +24,7 @@
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "cxx/spec/fileio.h"
 
 namespace mako {
@@ -36,6 +37,11 @@ namespace memory_fileio {
 // Calling Clear() will clear memory of all files, and individual files can be
 // cleared from memory with Delete().
 //
+// An open file is locked on its own rather than with all files, and only once
+// per ReadBatch() or WriteBatch() call, so instances reading or writing
+// different files, or reading the same file, from threads do not wait on each
+// other.
+//
 // THIS CLASS IS NOT THREAD SAFE
 // (But using different instances from threads IS safe)
 class FileIO : public mako::FileIO {
@@ -51,13 +57,17 @@ class FileIO : public mako::FileIO {
   // See interface docs for more information.
   bool Write(const google::protobuf::Message& record) override;
   bool Write(absl::string_view serialized_record) override;
+  bool WriteBatch(const std::vector<std::string>& serialized_records) override;
 
   // Read reads the next record in the opened file
   // See interface docs for more information.
   bool Read(google::protobuf::Message* record) override;
   bool Read(std::string* serialized_record) override;
+  bool ReadBatch(int max_records,
+                 std::vector<std::string>* serialized_records) override;
 
-  // Returns true if last call to Read() returned false and reached EOF.
+  // Returns true if last call to Read() or ReadBatch() returned false and
+  // reached EOF.
   // See interface docs for more information.
   bool ReadEOF() override { return read_eof_; }
 
@@ -107,10 +117,30 @@ class FileIO : public mako::FileIO {
   }
 
  private:
+  // The records of a file, with the lock that guards them.
+  struct FileData {
+    absl::Mutex mu;
+    File records ABSL_GUARDED_BY(mu);
+    // Set when the file is deleted, or replaced by opening its path for
+    // writing, after which instances that have it open fail.
+    bool deleted ABSL_GUARDED_BY(mu) = false;
+  };
+
   // set value to be returned by Error() to msg
   void SetError(absl::string_view err_msg);
-  // return vector for path_ or nullptr.
-  File* GetFileForPath(absl::string_view path);
+  // Marks the file deleted, if there is one.
+  static void MarkDeleted(FileData* file);
+  // Checks that a file is open for writing, setting the error if not.
+  bool CheckWritable();
+  // Checks that a file is open for reading, setting the error if not.
+  bool CheckReadable();
+  // Checks that the open file has not been deleted, setting the error for the
+  // given action if it has.
+  bool CheckNotDeleted(absl::string_view action)
+      ABSL_SHARED_LOCKS_REQUIRED(file_->mu);
+  // Checks that the open file has a record at read_idx_, setting the error,
+  // and read_eof_ at the end of the file, if not.
+  bool HasNextRecord() ABSL_SHARED_LOCKS_REQUIRED(file_->mu);
   // error prefix useful for debugging
   std::string error_prefix_;
   // if true, at EOF
@@ -123,6 +153,8 @@ class FileIO : public mako::FileIO {
   bool writing_;
   // index into vector when reading file. -1 otherwise.
   int read_idx_;
+  // The open file, or null.
+  std::shared_ptr<FileData> file_;
 
   // Injected errors
   std::string open_error_;
@@ -131,10 +163,11 @@ class FileIO : public mako::FileIO {
   std::string delete_error_;
   std::string close_error_;
 
+  // Guards the mapping of paths to files, but not the files themselves.
   static absl::Mutex files_mu_;
-  // Mapping from file path to list of records written to that path.
-  static absl::flat_hash_map<std::string, std::unique_ptr<FileIO::File> >*
-      files_ ABSL_GUARDED_BY(files_mu_);
+  // Mapping from file path to the records written to that path.
+  static absl::flat_hash_map<std::string, std::shared_ptr<FileData>>* files_
+      ABSL_GUARDED_BY(files_mu_);
 
 #ifndef SWIG
   // Not copyable.
@@ -13,8 +13,13 @@
 // limitations under the license.
 #include "cxx/clients/fileio/memory_fileio.h"
 
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
 #include "spec/proto/mako.pb.h"
 
 namespace mako {
@@ -326,6 +331,108 @@ TEST_F(MemoryFileioTest, InjectedErrorsMakeInstanceTest) {
   ASSERT_EQ(copy->Error(), "memory_fileio::FileIO open");
 }
 
+// Uses the per-record ReadBatch() and WriteBatch() of mako::FileIO.
+class PerRecordFileIO : public FileIO {
+ public:
+  bool WriteBatch(const std::vector<std::string>& serialized_records) override {
+    return mako::FileIO::WriteBatch(serialized_records);
+  }
+  bool ReadBatch(int max_records,
+                 std::vector<std::string>* serialized_records) override {
+    return mako::FileIO::ReadBatch(max_records, serialized_records);
+  }
+};
+
+// Writes 5 records in batches and reads them back in batches of 2.
+void WriteAndReadBatches(mako::FileIO* f) {
+  ASSERT_TRUE(f->Open("/tmp/batches", mako::FileIO::AccessMode::kWrite));
+  ASSERT_TRUE(f->WriteBatch({"0", "1", "2"})) << f->Error();
+  ASSERT_TRUE(f->WriteBatch({})) << f->Error();
+  ASSERT_TRUE(f->WriteBatch({"3", "4"})) << f->Error();
+  ASSERT_TRUE(f->Close());
+
+  ASSERT_TRUE(f->Open("/tmp/batches", mako::FileIO::AccessMode::kRead));
+  std::vector<std::string> batch = {"stale", "stale", "stale"};
+  ASSERT_TRUE(f->ReadBatch(2, &batch)) << f->Error();
+  EXPECT_THAT(batch, ::testing::ElementsAre("0", "1"));
+  ASSERT_TRUE(f->ReadBatch(2, &batch)) << f->Error();
+  EXPECT_THAT(batch, ::testing::ElementsAre("2", "3"));
+  ASSERT_TRUE(f->ReadBatch(2, &batch)) << f->Error();
+  EXPECT_THAT(batch, ::testing::ElementsAre("4"));
+  ASSERT_FALSE(f->ReadBatch(2, &batch));
+  EXPECT_TRUE(batch.empty());
+  EXPECT_TRUE(f->ReadEOF());
+  ASSERT_TRUE(f->Close());
+}
+
+TEST_F(MemoryFileioTest, WriteBatchReadBatch) {
+  FileIO f;
+  WriteAndReadBatches(&f);
+}
+
+TEST_F(MemoryFileioTest, DefaultWriteBatchReadBatch) {
+  PerRecordFileIO f;
+  WriteAndReadBatches(&f);
+}
+
+TEST_F(MemoryFileioTest, BatchesFailOnDeletedFile) {
+  FileIO f;
+  ASSERT_TRUE(f.Open("/tmp/blah", mako::FileIO::AccessMode::kWrite));
+  ASSERT_TRUE(f.WriteBatch({"0", "1"}));
+  ASSERT_TRUE(f.Close());
+
+  ASSERT_TRUE(f.Open("/tmp/blah", mako::FileIO::AccessMode::kRead));
+  // Opening the path for writing replaces the file being read.
+  FileIO f2;
+  ASSERT_TRUE(f2.Open("/tmp/blah", mako::FileIO::AccessMode::kWrite));
+  std::vector<std::string> batch;
+  ASSERT_FALSE(f.ReadBatch(2, &batch));
+  EXPECT_FALSE(f.ReadEOF());
+  EXPECT_THAT(f.Error(), ::testing::HasSubstr("deleted"));
+  f.Close();
+
+  ASSERT_TRUE(FileIO().Delete("/tmp/blah"));
+  ASSERT_FALSE(f2.WriteBatch({"0"}));
+  EXPECT_THAT(f2.Error(), ::testing::HasSubstr("deleted"));
+}
+
+TEST_F(MemoryFileioTest, ParallelReadersAndWriters) {
+  const int kNumRecords = 1000;
+  FileIO f;
+  ASSERT_TRUE(f.Open("/tmp/shared", mako::FileIO::AccessMode::kWrite));
+  for (int i = 0; i < kNumRecords; ++i) {
+    ASSERT_TRUE(f.Write(std::to_string(i)));
+  }
+  ASSERT_TRUE(f.Close());
+
+  std::vector<int> counts(8);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([t, &counts] {
+      FileIO f;
+      if (t % 2 == 0) {
+        // Readers of the same file.
+        f.Open("/tmp/shared", mako::FileIO::AccessMode::kRead);
+        std::vector<std::string> batch;
+        while (f.ReadBatch(64, &batch)) {
+          counts[t] += batch.size();
+        }
+      } else {
+        // Writers of files of their own.
+        f.Open(absl::StrCat("/tmp/own", t), mako::FileIO::AccessMode::kWrite);
+        for (int i = 0; i < kNumRecords; ++i) {
+          counts[t] += f.WriteBatch({std::to_string(i)});
+        }
+      }
+      f.Close();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_THAT(counts, ::testing::Each(kNumRecords));
+}
+
 TEST(FileIOTest, WriteProtoReadString) {
   std::string path = "write-proto-read-string";
   mako::memory_fileio::FileIO fio;
@@ -13,19 +13,26 @@
 // limitations under the License.
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <thread>  // NOLINT(build/c++11)
 #include <utility>
 
 #include "glog/logging.h"
 #include "src/google/protobuf/repeated_field.h"
-#include "absl/container/node_hash_map.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/span.h"
 #include "cxx/helpers/status/canonical_errors.h"
 #include "cxx/helpers/status/status.h"
 #include "cxx/helpers/status/statusor.h"
+#include "cxx/internal/load/common/thread_pool_factory.h"
 #include "cxx/internal/utils/cleanup.h"
 #include "proto/helpers/rolling_window_reducer/rolling_window_reducer.pb.h"
 #include "spec/proto/mako.pb.h"
@@ -39,20 +46,54 @@ using mako::internal::RunningStats;
 // Maximum number of metric values per AddPoint call.
 constexpr int kMaxBufferSize = 100000;
 
+// Maximum number of batches read ahead of those added, per file being read.
+constexpr std::size_t kQueuedBatchesPerFile = 2;
+
 constexpr char kNoError[] = "";
 
 static std::string ToMakoError(const Status& status) {
   return status.ok() ? kNoError : StatusToString(status);
 }
 
-Status ProcessFileData(absl::string_view file_path,
-                       RollingWindowReducer* reducer, FileIO* file_io) {
-  RWRAddPointsInput points_to_process;
+// A batch of the records of a file: points and errors, or a block of records
+// stored by column.
+struct Batch {
+  RWRAddPointsInput points;
+  bool has_columns = false;
+  mako::internal::SampleColumns columns;
+};
+
+// Reads the records of the open file into batches of at most kMaxBufferSize
+// metric values, passing each to process_batch. Blocks of records stored by
+// column are passed as they are, after the records before them.
+Status ProcessFileData(absl::string_view file_path, FileIO* file_io,
+                       const std::function<Status(Batch*)>& process_batch) {
+  Batch batch;
+  RWRAddPointsInput& points_to_process = batch.points;
   int buffer_size = 0;
 
   // Add each sample point in file to points_to_process
-  SampleRecord sample_record;
-  while (file_io->Read(&sample_record)) {
+  mako::internal::SampleFileReader reader(file_io);
+  while (reader.Next()) {
+    if (reader.has_columns()) {
+      if (buffer_size != 0) {
+        const Status status = process_batch(&batch);
+        if (!status.ok()) {
+          return status;
+        }
+        points_to_process.Clear();
+        buffer_size = 0;
+      }
+      Batch block;
+      block.has_columns = true;
+      std::swap(block.columns, *reader.mutable_columns());
+      const Status status = process_batch(&block);
+      if (!status.ok()) {
+        return status;
+      }
+      continue;
+    }
+    const SampleRecord& sample_record = reader.record();
     if (sample_record.has_sample_point()) {
       *points_to_process.add_point_list() = sample_record.sample_point();
       buffer_size += sample_record.sample_point().metric_value_list_size();
@@ -62,14 +103,14 @@ Status ProcessFileData(absl::string_view file_path,
       buffer_size += sample_record.sample_error().ByteSizeLong();
     }
 
-    // Once the points_to_process buffer is filled, call AddPoints
-    // for each RWR instance and reset the buffer
+    // Once the points_to_process buffer is filled, process it and reset the
+    // buffer
     if (buffer_size >= kMaxBufferSize) {
       VLOG(1) << "Size of AddPointsInput Proto to be passed for file "
               << file_path << ": "
               << points_to_process.ByteSizeLong() << " bytes";
 
-      const Status status = reducer->AddPoints(points_to_process);
+      const Status status = process_batch(&batch);
       if (!status.ok()) {
         return status;
       }
@@ -79,16 +120,16 @@ Status ProcessFileData(absl::string_view file_path,
   }
 
   // Make sure read return false to indicate EOF
-  if (!file_io->ReadEOF()) {
-    return Annotate(UnknownError(file_io->Error()), "ReadEOF");
+  if (!reader.error().empty()) {
+    return Annotate(UnknownError(reader.error()), "ReadEOF");
   }
 
-  // If any points in buffer, add them to each reducer instance
+  // If any points in buffer, process them
   if (buffer_size != 0) {
     VLOG(1) << "Size of AddPointsInput Proto to be passed for file "
             << file_path << ": "
             << points_to_process.ByteSizeLong() << " bytes";
-    const Status status = reducer->AddPoints(points_to_process);
+    const Status status = process_batch(&batch);
     if (!status.ok()) {
       return status;
     }
@@ -97,9 +138,143 @@ Status ProcessFileData(absl::string_view file_path,
   return OkStatus();
 }
 
-static mako::internal::Random* GetRandom() {
-  static mako::internal::Random* random = new mako::internal::Random;
-  return random;
+// Opens the file, passes its records to process_batch as ProcessFileData
+// does, and closes it.
+Status ProcessFile(absl::string_view file_path, FileIO* file_io,
+                   const std::function<Status(Batch*)>& process_batch) {
+  if (!file_io->Open(std::string(file_path), FileIO::AccessMode::kRead)) {
+    return Annotate(UnknownError(file_io->Error()), "opening file");
+  }
+
+  const auto close_file =
+      mako::internal::MakeCleanup([file_io] { file_io->Close(); });
+
+  const Status status = ProcessFileData(file_path, file_io, process_batch);
+  if (!status.ok()) {
+    return Annotate(status, absl::StrFormat("processing file: %s",
+                                            file_path));
+  }
+  return OkStatus();
+}
+
+// Returns the number of threads to run num_tasks tasks on, given a maximum
+// that is not positive for one thread per core.
+int NumThreads(int max_threads, std::size_t num_tasks) {
+  if (max_threads <= 0) {
+    max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+  }
+  return std::min<std::size_t>(max_threads,
+                               std::max<std::size_t>(num_tasks, 1));
+}
+
+// Returns a started thread pool to run tasks on with num_threads threads, or
+// null to run them on the calling thread.
+std::unique_ptr<mako::internal::ThreadPool> NewThreadPool(int num_threads) {
+  if (num_threads <= 1) {
+    return nullptr;
+  }
+  auto thread_pool = mako::internal::CreateThreadPool(num_threads);
+  thread_pool->StartWorkers();
+  return thread_pool;
+}
+
+// Runs task(i) for each i in [0, num_tasks) on thread_pool, and waits for them
+// to finish. Runs them on the calling thread if thread_pool is null.
+void RunTasks(mako::internal::ThreadPool* thread_pool, std::size_t num_tasks,
+              const std::function<void(std::size_t)>& task) {
+  if (thread_pool == nullptr || num_tasks <= 1) {
+    for (std::size_t i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+  absl::BlockingCounter done(num_tasks);
+  for (std::size_t i = 0; i < num_tasks; ++i) {
+    thread_pool->Schedule([&task, &done, i] {
+      task(i);
+      done.DecrementCount();
+    });
+  }
+  done.Wait();
+}
+
+// The batches of one file, passed from the thread reading the file to the
+// thread adding them. At most kQueuedBatchesPerFile batches are held; the
+// reader waits for the others to be taken.
+class FileBatchQueue {
+ public:
+  // Waits until there is room for batch, and moves it into the queue. Returns
+  // false, without taking batch, if the batches are no longer wanted.
+  bool Push(Batch* batch) {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(this, &FileBatchQueue::CanPush));
+    if (cancelled_) {
+      return false;
+    }
+    batches_.push_back(std::move(*batch));
+    return true;
+  }
+
+  // Marks the file as read, with the status of reading it.
+  void Close(const Status& status) {
+    absl::MutexLock lock(&mu_);
+    status_ = status;
+    closed_ = true;
+  }
+
+  // Waits until there is a batch and moves it to batch. Returns false, with
+  // the status of reading the file in status, once all batches are taken.
+  bool Pop(Batch* batch, Status* status) {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(this, &FileBatchQueue::CanPop));
+    if (batches_.empty()) {
+      *status = status_;
+      return false;
+    }
+    *batch = std::move(batches_.front());
+    batches_.pop_front();
+    return true;
+  }
+
+  // Drops the queued batches, and makes Push fail so that the reader stops.
+  void Cancel() {
+    absl::MutexLock lock(&mu_);
+    cancelled_ = true;
+    batches_.clear();
+  }
+
+ private:
+  bool CanPush() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return cancelled_ || batches_.size() < kQueuedBatchesPerFile;
+  }
+  bool CanPop() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return closed_ || !batches_.empty();
+  }
+
+  absl::Mutex mu_;
+  std::deque<Batch> batches_ ABSL_GUARDED_BY(mu_);
+  bool closed_ ABSL_GUARDED_BY(mu_) = false;
+  bool cancelled_ ABSL_GUARDED_BY(mu_) = false;
+  Status status_ ABSL_GUARDED_BY(mu_);
+};
+
+// Returns the error for input that fell in finalized windows.
+Status FinalizedInputError(int num_finalized, double first_finalized,
+                           const std::string& metric_key) {
+  return FailedPreconditionError(absl::StrFormat(
+      "%d input values fell in windows already finalized by streaming, "
+      "starting with %f for output %s",
+      num_finalized, first_finalized, metric_key));
+}
+
+// Returns the first error of statuses, in order, or OK if there is none.
+Status FirstError(const std::vector<Status>& statuses) {
+  for (const auto& status : statuses) {
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  return OkStatus();
 }
 
 std::set<std::string> ToStringSet(
@@ -121,6 +296,23 @@ int EffectiveMaxSampleSize(const RWRConfig& config) {
   }
 }
 
+int EffectiveSketchK(const RWRConfig& config) {
+  if (config.window_operation() != RWRConfig::PERCENTILE) {
+    return 0;  // do not keep a sketch unless percentile
+  }
+  return std::max(config.quantile_sketch_k(), 0);
+}
+
+// Returns the RunningStats config needed by windows for the given RWRConfig.
+// The subreducer supplies the Random needed by a bounded sample.
+RunningStats::Config EffectiveRunningStatsConfig(const RWRConfig& config) {
+  int sketch_k = EffectiveSketchK(config);
+  if (sketch_k > 0) {
+    return RunningStats::Config::Sketch(sketch_k);
+  }
+  return RunningStats::Config(EffectiveMaxSampleSize(config), nullptr);
+}
+
 // Note: Doesn't check if 'error_matcher' compiles to a valid RE2.
 Status ValidateConfig(const RWRConfig& config) {
   // Validate config protobuf
@@ -221,9 +413,10 @@ double DivByZero(double numerator) {
 }  // namespace
 
 StatusOr<google::protobuf::RepeatedPtrField<SamplePoint>>
-RollingWindowReducer::ReduceImpl(absl::Span<absl::string_view> file_paths,
-                                 const std::vector<RWRConfig>& configs,
-                                 FileIO* file_io) {
+RollingWindowReducer::ReduceImpl(
+    absl::Span<absl::string_view> file_paths,
+    const std::vector<RWRConfig>& configs, FileIO* file_io,
+    const FinalizedWindowCallback& streaming_callback, int max_threads) {
   if (file_io == nullptr) {
     return InvalidArgumentError("FileIO pointer invalid.");
   }
@@ -233,20 +426,78 @@ RollingWindowReducer::ReduceImpl(absl::Span<absl::string_view> file_paths,
     return reducer_or.status();
   }
   RollingWindowReducer* reducer = reducer_or.value().get();
+  if (streaming_callback) {
+    reducer->EnableStreaming(streaming_callback, /*input_ordered=*/true);
+  }
 
-  // Loop through all files
-  for (auto file_path : file_paths) {
-    if (!file_io->Open(std::string(file_path), FileIO::AccessMode::kRead)) {
-      return Annotate(UnknownError(file_io->Error()), "opening file");
+  reducer->SetMaxThreads(max_threads);
+  const auto add_batch = [reducer](const Batch& batch) {
+    return batch.has_columns ? reducer->AddColumns(batch.columns)
+                             : reducer->AddPoints(batch.points);
+  };
+
+  const int num_threads = NumThreads(max_threads, file_paths.size());
+  if (num_threads == 1) {
+    // Loop through all files
+    for (auto file_path : file_paths) {
+      const Status status =
+          ProcessFile(file_path, file_io,
+                      [&add_batch](Batch* batch) { return add_batch(*batch); });
+      if (!status.ok()) {
+        return status;
+      }
     }
-
-    const auto close_file =
-        mako::internal::MakeCleanup([file_io] { file_io->Close(); });
-
-    const Status status = ProcessFileData(file_path, reducer, file_io);
-    if (!status.ok()) {
-      return Annotate(status, absl::StrFormat("processing file: %s",
-                                              file_path));
+  } else {
+    // Read up to num_threads files concurrently, each with its own FileIO
+    // instance, while adding the batches of the first file not yet added on
+    // this thread, so that the output does not depend on which file is read
+    // first. Each file's batches go through a FileBatchQueue, and a file is
+    // only read once the file num_threads before it is added, so at most
+    // num_threads * kQueuedBatchesPerFile batches are held at once.
+    //
+    // The queues outlive the thread pool, whose destructor waits for the
+    // readers to finish.
+    std::vector<std::unique_ptr<FileBatchQueue>> queues;
+    queues.reserve(file_paths.size());
+    const auto thread_pool = NewThreadPool(num_threads);
+    // Stops the readers if adding a batch fails.
+    const auto cancel_readers = mako::internal::MakeCleanup([&queues] {
+      for (const auto& queue : queues) {
+        queue->Cancel();
+      }
+    });
+    const auto read_file = [&file_paths, file_io, &queues,
+                            &thread_pool](std::size_t i) {
+      queues.push_back(absl::make_unique<FileBatchQueue>());
+      FileBatchQueue* queue = queues.back().get();
+      thread_pool->Schedule([&file_paths, file_io, i, queue] {
+        std::unique_ptr<FileIO> file_instance = file_io->MakeInstance();
+        queue->Close(ProcessFile(
+            file_paths[i], file_instance.get(), [queue](Batch* batch) {
+              return queue->Push(batch) ? OkStatus()
+                                        : CancelledError("reading cancelled");
+            }));
+      });
+    };
+    for (std::size_t i = 0;
+         i < std::min<std::size_t>(num_threads, file_paths.size()); ++i) {
+      read_file(i);
+    }
+    Batch batch;
+    for (std::size_t i = 0; i < file_paths.size(); ++i) {
+      Status read_status;
+      while (queues[i]->Pop(&batch, &read_status)) {
+        const Status status = add_batch(batch);
+        if (!status.ok()) {
+          return status;
+        }
+      }
+      if (!read_status.ok()) {
+        return read_status;
+      }
+      if (i + num_threads < file_paths.size()) {
+        read_file(i + num_threads);
+      }
     }
   }
 
@@ -293,7 +544,6 @@ Status RollingWindowReducer::AddConfig(const RWRConfig& config) {
   }
 
   VLOG(1) << "Creating new subreducer: " << config.ShortDebugString();
-  int max_sample_size = EffectiveMaxSampleSize(config);
   std::unique_ptr<RE2> error_matcher;
   if (config.window_operation() == RWRConfig::ERROR_COUNT &&
       !config.error_matcher().empty()) {
@@ -305,7 +555,8 @@ Status RollingWindowReducer::AddConfig(const RWRConfig& config) {
     }
   }
   subreducers_.push_back(absl::make_unique<Subreducer>(
-      config, max_sample_size, std::move(error_matcher)));
+      config, EffectiveRunningStatsConfig(config), std::move(error_matcher),
+      &metric_keys_));
   return OkStatus();
 }
 
@@ -321,26 +572,49 @@ std::unique_ptr<RollingWindowReducer> RollingWindowReducer::Create(
   return std::move(reducer_or.value());
 }
 
-RollingWindowReducer::Subreducer::Subreducer(const RWRConfig& config,
-                                             int max_sample_size,
-                                             std::unique_ptr<RE2> error_matcher)
+RollingWindowReducer::Subreducer::Subreducer(
+    const RWRConfig& config, const RunningStats::Config& running_stats_config,
+    std::unique_ptr<RE2> error_matcher,
+    mako::internal::MetricKeyDictionary* metric_keys)
     : window_size_(config.window_size()),
       step_size_(config.window_size() / config.steps_per_window()),
       steps_per_window_(config.steps_per_window()),
+      running_stats_config_(running_stats_config),
       base_window_loc_(std::numeric_limits<double>::max()),
       min_window_index_(std::numeric_limits<int>::max()),
       max_window_index_(std::numeric_limits<int>::min()),
+      next_window_index_(std::numeric_limits<int>::min()),
+      max_input_value_(-std::numeric_limits<double>::infinity()),
+      first_step_index_(0),
       error_matcher_(std::move(error_matcher)) {
   input_metric_keys_ = ToStringSet(config.input_metric_keys());
   denominator_input_metric_keys_ =
       ToStringSet(config.denominator_input_metric_keys());
   error_sampler_name_inputs_ = ToStringSet(config.error_sampler_name_inputs());
+  if (running_stats_config_.max_sample_size > 0) {
+    running_stats_config_.random = &random_;
+  }
+  for (const auto& key : input_metric_keys_) {
+    int id = metric_keys->Intern(key);
+    metric_roles_.resize(std::max<std::size_t>(metric_roles_.size(), id + 1));
+    metric_roles_[id] |= kPrimaryMetric;
+  }
+  for (const auto& key : denominator_input_metric_keys_) {
+    int id = metric_keys->Intern(key);
+    metric_roles_.resize(std::max<std::size_t>(metric_roles_.size(), id + 1));
+    metric_roles_[id] |= kDenominatorMetric;
+  }
+  AddOutputConfig(config);
+}
 
-  running_stats_config_.max_sample_size = max_sample_size;
-  if (max_sample_size > 0) {
-    running_stats_config_.random = GetRandom();
+void RollingWindowReducer::Subreducer::AddOutputConfig(
+    const RWRConfig& config) {
+  OutputConfig output_config(config);
+  if (output_config.window_operation == RWRConfig::PERCENTILE) {
+    output_config.percentile_index = percentiles_.size();
+    percentiles_.push_back(output_config.percentile);
   }
-  output_configs_.push_back(OutputConfig(config));
+  output_configs_.push_back(output_config);
 }
 
 bool RollingWindowReducer::Subreducer::TryMergeSimilarConfig(
@@ -371,54 +645,255 @@ bool RollingWindowReducer::Subreducer::TryMergeSimilarConfig(
 
   VLOG(2) << "All input fields match, adding output metric to reducer";
 
-  output_configs_.push_back(OutputConfig(other_config));
+  AddOutputConfig(other_config);
 
-  // Increase max_sample_size to match the new config, if needed.
+  // A sketch is only kept when every merged config asked for one; any config
+  // that wants a sample gets one, and its bounds are handled below.
+  int other_sketch_k = EffectiveSketchK(other_config);
+  if (other_sketch_k > 0) {
+    if (running_stats_config_.sketch_k > 0 ||
+        running_stats_config_.max_sample_size == 0) {
+      running_stats_config_.sketch_k =
+          std::max(running_stats_config_.sketch_k, other_sketch_k);
+    }
+    return true;
+  }
   int other_max_sample_size = EffectiveMaxSampleSize(other_config);
+  if (other_max_sample_size != 0 && running_stats_config_.sketch_k > 0) {
+    running_stats_config_.sketch_k = 0;
+    running_stats_config_.max_sample_size = other_max_sample_size;
+    if (other_max_sample_size > 0) {
+      running_stats_config_.random = &random_;
+    }
+    return true;
+  }
+
+  // Increase max_sample_size to match the new config, if needed.
   if (other_max_sample_size < 0) {
     running_stats_config_.max_sample_size = -1;
   } else if (other_max_sample_size > running_stats_config_.max_sample_size &&
              running_stats_config_.max_sample_size > 0) {
     running_stats_config_.max_sample_size = other_max_sample_size;
-    if (running_stats_config_.random == nullptr) {
-      running_stats_config_.random = GetRandom();
-    }
+    running_stats_config_.random = &random_;
   }
 
   return true;
 }
 
 Status RollingWindowReducer::AddPoints(const RWRAddPointsInput& input) {
-  for (auto& subreducer : subreducers_) {
-    subreducer->AddPoints(input);
+  LookUpMetricIds(input.point_list());
+  // Each subreducer only touches its own data, so they can add the points
+  // concurrently.
+  std::vector<Status> statuses(subreducers_.size());
+  RunTasks(thread_pool_.get(), subreducers_.size(),
+           [this, &input, &statuses](std::size_t i) {
+             statuses[i] = subreducers_[i]->AddPoints(input, metric_ids_);
+           });
+  const Status status = FirstError(statuses);
+  if (!status.ok()) {
+    return status;
+  }
+  if (streaming_callback_ && input_ordered_) {
+    return FinalizeWindows();
+  }
+  return OkStatus();
+}
+
+Status RollingWindowReducer::AddColumns(
+    const mako::internal::SampleColumns& columns) {
+  // The records not stored by column are added as points and errors.
+  RWRAddPointsInput others;
+  for (const SampleRecord& record : columns.other_records()) {
+    if (record.has_sample_point()) {
+      *others.add_point_list() = record.sample_point();
+    }
+    if (record.has_sample_error()) {
+      *others.add_error_list() = record.sample_error();
+    }
+  }
+  LookUpMetricIds(others.point_list());
+  column_metric_ids_.clear();
+  for (int key_id = 0; key_id < columns.num_keys(); ++key_id) {
+    column_metric_ids_.push_back(metric_keys_.Find(columns.key(key_id)));
+  }
+  std::vector<Status> statuses(subreducers_.size());
+  RunTasks(thread_pool_.get(), subreducers_.size(),
+           [this, &columns, &others, &statuses](std::size_t i) {
+             const Status status =
+                 subreducers_[i]->AddColumns(columns, column_metric_ids_);
+             statuses[i] = subreducers_[i]->AddPoints(others, metric_ids_);
+             if (!status.ok()) {
+               statuses[i] = status;
+             }
+           });
+  const Status status = FirstError(statuses);
+  if (!status.ok()) {
+    return status;
+  }
+  if (streaming_callback_ && input_ordered_) {
+    return FinalizeWindows();
+  }
+  return OkStatus();
+}
+
+void RollingWindowReducer::SetMaxThreads(int max_threads) {
+  // Each call to AddPoints(), AddColumns() or Complete() runs at most one task
+  // per subreducer, on threads that are started once here.
+  thread_pool_ = NewThreadPool(NumThreads(max_threads, subreducers_.size()));
+}
+
+void RollingWindowReducer::EnableStreaming(FinalizedWindowCallback callback,
+                                           bool input_ordered) {
+  streaming_callback_ = std::move(callback);
+  input_ordered_ = input_ordered;
+}
+
+Status RollingWindowReducer::AdvanceWatermark(double watermark) {
+  if (!streaming_callback_) {
+    return FailedPreconditionError(
+        "AdvanceWatermark requires streaming mode to be enabled.");
+  }
+  watermark_ = std::max(watermark_, watermark);
+  return FinalizeWindows();
+}
+
+Status RollingWindowReducer::FinalizeWindows() {
+  // The lowest input value that each subreducer may yet output.
+  std::vector<double> lowest_future_outputs;
+  lowest_future_outputs.reserve(subreducers_.size());
+  for (std::size_t i = 0; i < subreducers_.size(); ++i) {
+    Subreducer* subreducer = subreducers_[i].get();
+    double watermark =
+        input_ordered_ ? subreducer->max_input_value() : watermark_;
+    for (std::size_t earlier = 0; earlier < i; ++earlier) {
+      if (subreducer->TakesOutputOf(*subreducers_[earlier])) {
+        watermark = std::min(watermark, lowest_future_outputs[earlier]);
+      }
+    }
+    google::protobuf::RepeatedPtrField<SamplePoint> finalized;
+    subreducer->FinalizeWindows(watermark, &finalized);
+    lowest_future_outputs.push_back(subreducer->LowestFutureOutput(watermark));
+    const Status status = StreamOutput(i, &finalized, nullptr);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  return OkStatus();
+}
+
+Status RollingWindowReducer::StreamOutput(
+    std::size_t subreducer_index,
+    google::protobuf::RepeatedPtrField<SamplePoint>* points,
+    google::protobuf::RepeatedPtrField<SamplePoint>* output) {
+  if (points->empty()) {
+    return OkStatus();
+  }
+  RWRAddPointsInput input;
+  input.mutable_point_list()->Swap(points);
+  if (subreducer_index + 1 < subreducers_.size()) {
+    LookUpMetricIds(input.point_list());
+    for (std::size_t i = subreducer_index + 1; i < subreducers_.size(); ++i) {
+      const Status status = subreducers_[i]->AddPoints(input, metric_ids_);
+      if (!status.ok()) {
+        return status;
+      }
+    }
+  }
+  if (output != nullptr) {
+    for (auto& point : *input.mutable_point_list()) {
+      *output->Add() = std::move(point);
+    }
+    return OkStatus();
+  }
+  for (const auto& point : input.point_list()) {
+    const Status status = streaming_callback_(point);
+    if (!status.ok()) {
+      return status;
+    }
   }
   return OkStatus();
 }
 
-void RollingWindowReducer::Subreducer::AddPoints(
-    const RWRAddPointsInput& input) {
+void RollingWindowReducer::LookUpMetricIds(
+    const google::protobuf::RepeatedPtrField<SamplePoint>& points) {
+  metric_ids_.clear();
+  for (const auto& point : points) {
+    for (const auto& metric_value : point.metric_value_list()) {
+      metric_ids_.push_back(metric_keys_.Find(metric_value.value_key()));
+    }
+  }
+}
+
+Status RollingWindowReducer::Subreducer::AddPoints(
+    const RWRAddPointsInput& input, const std::vector<int>& metric_ids) {
+  // Input values that fell in finalized windows, reported after the rest of
+  // the input has been added.
+  int num_finalized = 0;
+  double first_finalized = 0;
   // Since the config(s) passed validation, input_metric_keys_ is empty iff the
   // window_operation is ERROR_COUNT.
   if (input_metric_keys_.empty()) {
     // Loop through all SampleErrors
     for (const auto& error : input.error_list()) {
       if (error_sampler_name_inputs_.count(error.sampler_name()) &&
-          IsMatch(error.error_message())) {
-        AddErrorToAllContainingWindows(error.input_value());
+          IsMatch(error.error_message()) &&
+          !AddErrorToStep(error.input_value()) && num_finalized++ == 0) {
+        first_finalized = error.input_value();
       }
     }
   } else {
     // Loop through all SamplePoints
+    auto metric_id = metric_ids.begin();
     for (const auto& point : input.point_list()) {
-      // Add the point to all relevant windows if it contains a metric value key
-      // we are interested in
+      // Add the point to its step if it contains a metric value key we are
+      // interested in
       for (const auto& metric_value : point.metric_value_list()) {
-          AddPointToAllContainingWindows(point.input_value(),
-                                         metric_value.value(),
-                                         metric_value.value_key());
+        if (!AddPointToStep(point.input_value(), metric_value.value(),
+                            *metric_id++) &&
+            num_finalized++ == 0) {
+          first_finalized = point.input_value();
+        }
+      }
+    }
+  }
+  if (num_finalized > 0) {
+    return FinalizedInputError(num_finalized, first_finalized,
+                               output_configs_.front().metric_key);
+  }
+  return OkStatus();
+}
+
+Status RollingWindowReducer::Subreducer::AddColumns(
+    const mako::internal::SampleColumns& columns,
+    const std::vector<int>& key_metric_ids) {
+  int num_finalized = 0;
+  double first_finalized = 0;
+  for (int key_id = 0; key_id < columns.num_keys(); ++key_id) {
+    const int metric_id = key_metric_ids[key_id];
+    // Skip the columns of metrics that are not input to this subreducer.
+    if (!TakesMetric(metric_id)) {
+      continue;
+    }
+    const absl::Span<const double> inputs = columns.value_inputs(key_id);
+    const absl::Span<const double> values = columns.values(key_id);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      if (!AddPointToStep(inputs[i], values[i], metric_id) &&
+          num_finalized++ == 0) {
+        first_finalized = inputs[i];
       }
     }
   }
+  if (num_finalized > 0) {
+    return FinalizedInputError(num_finalized, first_finalized,
+                               output_configs_.front().metric_key);
+  }
+  return OkStatus();
+}
+
+bool RollingWindowReducer::Subreducer::TakesMetric(int metric_id) const {
+  return metric_id >= 0 &&
+         static_cast<std::size_t>(metric_id) < metric_roles_.size() &&
+         metric_roles_[metric_id] != 0;
 }
 
 bool RollingWindowReducer::Subreducer::IsMatch(
@@ -439,30 +914,100 @@ Status RollingWindowReducer::CompleteImpl(
   if (output == nullptr) {
     return InvalidArgumentError("RepeatedPtrField pointer invalid.");
   }
-  for (auto& subreducer : subreducers_) {
-    RWRAddPointsInput input;
-    *input.mutable_point_list() = {output->begin(), output->end()};
-    subreducer->AddPoints(input);
-    subreducer->Complete(output);
+  if (streaming_callback_) {
+    // Unlike without streaming, the points already in output are not input:
+    // they are normally the windows finalized so far. Those have been passed
+    // to later subreducers, so only the remaining windows are.
+    for (std::size_t i = 0; i < subreducers_.size(); ++i) {
+      google::protobuf::RepeatedPtrField<SamplePoint> remaining;
+      subreducers_[i]->Complete(&remaining);
+      const Status status = StreamOutput(i, &remaining, output);
+      if (!status.ok()) {
+        return status;
+      }
+    }
+    return OkStatus();
+  }
+  // Each subreducer takes the points already in output, then those of the
+  // earlier subreducers whose output it takes, in the order that a serial pass
+  // would add them. A subreducer runs in the wave after the last of those, so
+  // the subreducers of a wave can run concurrently. Their outputs are appended
+  // in subreducer order.
+  const std::size_t num_subreducers = subreducers_.size();
+  std::vector<int> waves(num_subreducers, 0);
+  int num_waves = 0;
+  for (std::size_t i = 0; i < num_subreducers; ++i) {
+    for (std::size_t earlier = 0; earlier < i; ++earlier) {
+      if (subreducers_[i]->TakesOutputOf(*subreducers_[earlier])) {
+        waves[i] = std::max(waves[i], waves[earlier] + 1);
+      }
+    }
+    num_waves = std::max(num_waves, waves[i] + 1);
+  }
+  std::vector<google::protobuf::RepeatedPtrField<SamplePoint>> outputs(
+      num_subreducers);
+  for (int wave = 0; wave < num_waves; ++wave) {
+    std::vector<std::size_t> wave_subreducers;
+    std::vector<RWRAddPointsInput> inputs;
+    std::vector<std::vector<int>> input_metric_ids;
+    for (std::size_t i = 0; i < num_subreducers; ++i) {
+      if (waves[i] != wave) {
+        continue;
+      }
+      wave_subreducers.push_back(i);
+      inputs.emplace_back();
+      auto* points = inputs.back().mutable_point_list();
+      *points = {output->begin(), output->end()};
+      for (std::size_t earlier = 0; earlier < i; ++earlier) {
+        if (subreducers_[i]->TakesOutputOf(*subreducers_[earlier])) {
+          points->MergeFrom(outputs[earlier]);
+        }
+      }
+      LookUpMetricIds(*points);
+      input_metric_ids.push_back(metric_ids_);
+    }
+    std::vector<Status> statuses(wave_subreducers.size());
+    RunTasks(thread_pool_.get(), wave_subreducers.size(),
+             [this, &wave_subreducers, &inputs, &input_metric_ids, &statuses,
+              &outputs](std::size_t j) {
+               const std::size_t i = wave_subreducers[j];
+               statuses[j] =
+                   subreducers_[i]->AddPoints(inputs[j], input_metric_ids[j]);
+               if (statuses[j].ok()) {
+                 subreducers_[i]->Complete(&outputs[i]);
+               }
+             });
+    const Status status = FirstError(statuses);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  for (auto& subreducer_output : outputs) {
+    for (auto& point : subreducer_output) {
+      *output->Add() = std::move(point);
+    }
   }
   return OkStatus();
 }
 
 void RollingWindowReducer::Subreducer::AppendOutputPointsForWindow(
-    int window_index, WindowDataProcessor* window,
+    int window_index, const WindowTotals& window,
+    RunningStats::Error summary_error,
     google::protobuf::RepeatedPtrField<SamplePoint>* output) {
+  const bool empty_window = window.count == 0 && window.error_count == 0;
   for (const auto& output_config : output_configs_) {
-    if (!window && !output_config.zero_for_empty_window) {
+    if (empty_window && !output_config.zero_for_empty_window) {
       continue;
     }
 
-    double value_to_set = window ? window->GetWindowValue(output_config) : 0;
+    double value_to_set =
+        empty_window ? 0
+                     : GetWindowValue(output_config, window, summary_error,
+                                      window_summary_);
 
     if (output_config.window_operation == RWRConfig::RATIO_SUM) {
-      auto& denominator_windows = window_data_denominator_;
-      auto iter = denominator_windows.find(window_index);
-      if (iter != denominator_windows.end()) {
-        double denominator = iter->second.GetWindowValue(output_config);
+      if (window.denominator_count > 0) {
+        double denominator = window.denominator_sum;
         // The tests check for "proper" div-by-zero behavior; this is a bug, but
         // for now we preserve existing behavior.
         // Note that this is inconsistent with zero_for_empty_window.
@@ -492,31 +1037,96 @@ void RollingWindowReducer::Subreducer::AppendOutputPointsForWindow(
 void RollingWindowReducer::Subreducer::Complete(
     google::protobuf::RepeatedPtrField<SamplePoint>* output) {
   // No point processed, return an empty list
-  if (window_data_.empty()) {
+  if (steps_.empty()) {
     return;
   }
+  OutputWindows(max_window_index_ + 1, output);
+}
 
-  bool care_about_empty_windows = false;
-  for (const auto& config : output_configs_) {
-    care_about_empty_windows |= config.zero_for_empty_window;
+void RollingWindowReducer::Subreducer::FinalizeWindows(
+    double watermark, google::protobuf::RepeatedPtrField<SamplePoint>* output) {
+  if (steps_.empty() || !std::isfinite(watermark)) {
+    return;
   }
+  // Later input is at or after the step of the watermark, so it can only fall
+  // in the windows that span that step or later ones.
+  const int watermark_step = WindowIndex(HighestWindowLoc(watermark));
+  OutputWindows(watermark_step - steps_per_window_ + 1, output);
+}
 
-  if (care_about_empty_windows) {
-    // Loop through all possible windows locations
-    for (int curr_window_index = min_window_index_;
-         curr_window_index <= max_window_index_; curr_window_index++) {
-      const auto window_iter = window_data_.find(curr_window_index);
-      WindowDataProcessor* window =
-          window_iter != window_data_.end() ? &window_iter->second : nullptr;
-      AppendOutputPointsForWindow(curr_window_index, window, output);
+double RollingWindowReducer::Subreducer::LowestFutureOutput(double watermark) {
+  // Windows yet to be output are at next_window_index_ or later, or contain
+  // input at or after the watermark.
+  double lowest = std::isfinite(watermark)
+                      ? HighestWindowLoc(watermark) - window_size_ + step_size_
+                      : watermark;
+  if (next_window_index_ != std::numeric_limits<int>::min() &&
+      next_window_index_ <= max_window_index_) {
+    lowest = std::min(lowest, WindowLocation(next_window_index_));
+  }
+  return lowest;
+}
+
+bool RollingWindowReducer::Subreducer::TakesOutputOf(
+    const Subreducer& other) const {
+  for (const auto& output_config : other.output_configs_) {
+    if (input_metric_keys_.count(output_config.metric_key) ||
+        denominator_input_metric_keys_.count(output_config.metric_key)) {
+      return true;
     }
-  } else {
-    // Only loop through all windows in window_data_ map
-    for (auto& indexed_window : window_data_) {
-      int curr_window_index = indexed_window.first;
-      WindowDataProcessor* window = &indexed_window.second;
-      AppendOutputPointsForWindow(curr_window_index, window, output);
+  }
+  return false;
+}
+
+void RollingWindowReducer::Subreducer::OutputWindows(
+    int end_window_index,
+    google::protobuf::RepeatedPtrField<SamplePoint>* output) {
+  const int begin_window_index = std::max(next_window_index_,
+                                          min_window_index_);
+  end_window_index = std::min(end_window_index, max_window_index_ + 1);
+  if (begin_window_index >= end_window_index) {
+    return;
+  }
+
+  const int num_steps = steps_.size();
+  for (int curr_window_index = begin_window_index;
+       curr_window_index < end_window_index; curr_window_index++) {
+    // The window spans [first, last) in steps_, which may reach past either
+    // end.
+    const int first = curr_window_index - first_step_index_;
+    const int last = first + steps_per_window_;
+    // The totals are summed over the steps of each window rather than taken
+    // as differences of running totals, which would lose the sums of small
+    // values that follow much larger ones.
+    WindowTotals window;
+    for (int i = std::max(first, 0); i < std::min(last, num_steps); ++i) {
+      window += steps_[i].totals;
     }
+    RunningStats::Error summary_error = RunningStats::Error::kOk;
+    if (!percentiles_.empty() && window.count > 0) {
+      RunningStats window_stats(running_stats_config_);
+      for (int i = std::max(first, 0);
+           i < std::min(last, num_steps) &&
+           summary_error == RunningStats::Error::kOk;
+           ++i) {
+        if (steps_[i].stats) {
+          summary_error = window_stats.TryMerge(*steps_[i].stats);
+        }
+      }
+      if (summary_error == RunningStats::Error::kOk) {
+        summary_error = window_stats.Summarize(percentiles_, &window_summary_);
+      }
+    }
+    AppendOutputPointsForWindow(curr_window_index, window, summary_error,
+                                output);
+  }
+  next_window_index_ = end_window_index;
+
+  // Later windows start at next_window_index_, so no longer span the steps
+  // before it.
+  while (!steps_.empty() && first_step_index_ < next_window_index_) {
+    steps_.pop_front();
+    ++first_step_index_;
   }
 }
 
@@ -532,41 +1142,53 @@ double RollingWindowReducer::Subreducer::WindowLocation(int window_index) {
   return window_index * step_size_ + base_window_loc_;
 }
 
-void RollingWindowReducer::Subreducer::AddPointToAllContainingWindows(
-    double x_val, double y_val, const std::string& value_key) {
-  const bool is_primary_metric = input_metric_keys_.count(value_key);
-  const bool is_denominator_metric =
-      denominator_input_metric_keys_.count(value_key);
-
-  if (!is_primary_metric && !is_denominator_metric) return;
+bool RollingWindowReducer::Subreducer::InFinalizedWindow(double x_val) {
+  // The lowest window containing x_val is the first one spanning its step.
+  return next_window_index_ != std::numeric_limits<int>::min() &&
+         WindowIndex(HighestWindowLoc(x_val)) - steps_per_window_ + 1 <
+             next_window_index_;
+}
 
-  auto index_bounds = UpdateWindowIndexBounds(x_val);
+RollingWindowReducer::StepData*
+RollingWindowReducer::Subreducer::MutableStepData(double x_val) {
+  return &steps_[UpdateWindowIndexBounds(x_val).high - first_step_index_];
+}
 
-  for (int curr_window_index = index_bounds.low;
-       curr_window_index <= index_bounds.high; curr_window_index++) {
-    if (is_primary_metric) {
-      auto insert_result = window_data_.insert(
-          {curr_window_index, WindowDataProcessor(running_stats_config_)});
-      insert_result.first->second.AddPoint(y_val);
-    }
-    if (is_denominator_metric) {
-      auto insert_result = window_data_denominator_.insert(
-          {curr_window_index, WindowDataProcessor(running_stats_config_)});
-      insert_result.first->second.AddPoint(y_val);
+bool RollingWindowReducer::Subreducer::AddPointToStep(double x_val,
+                                                      double y_val,
+                                                      int metric_id) {
+  const char role = TakesMetric(metric_id) ? metric_roles_[metric_id] : 0;
+  const bool is_primary_metric = role & kPrimaryMetric;
+  const bool is_denominator_metric = role & kDenominatorMetric;
+
+  if (!is_primary_metric && !is_denominator_metric) return true;
+  if (InFinalizedWindow(x_val)) return false;
+
+  max_input_value_ = std::max(max_input_value_, x_val);
+  StepData* step = MutableStepData(x_val);
+  if (is_primary_metric) {
+    ++step->totals.count;
+    step->totals.sum += y_val;
+    if (!percentiles_.empty()) {
+      if (!step->stats) {
+        step->stats = absl::make_unique<RunningStats>(running_stats_config_);
+      }
+      step->stats->TryAdd(y_val);
     }
   }
+  if (is_denominator_metric) {
+    ++step->totals.denominator_count;
+    step->totals.denominator_sum += y_val;
+  }
+  return true;
 }
 
-void RollingWindowReducer::Subreducer::AddErrorToAllContainingWindows(
-    double x_val) {
-  auto index_bounds = UpdateWindowIndexBounds(x_val);
+bool RollingWindowReducer::Subreducer::AddErrorToStep(double x_val) {
+  if (InFinalizedWindow(x_val)) return false;
 
-  for (int curr_window_index = index_bounds.low;
-       curr_window_index <= index_bounds.high; curr_window_index++) {
-    auto insert_result = window_data_.insert(
-        {curr_window_index, WindowDataProcessor(running_stats_config_)});
-    insert_result.first->second.AddError();
-  }
+  max_input_value_ = std::max(max_input_value_, x_val);
+  ++MutableStepData(x_val)->totals.error_count;
+  return true;
 }
 
 // Updates the base window index and window bounds with the sample X value. It
@@ -600,38 +1222,65 @@ RollingWindowReducer::Subreducer::UpdateWindowIndexBounds(double sample_x_val) {
     min_window_index_ = bounds.low;
   }
 
+  // Grow steps_ at either end so that it holds the step of the highest window.
+  if (steps_.empty()) {
+    first_step_index_ = bounds.high;
+  }
+  for (; first_step_index_ > bounds.high; --first_step_index_) {
+    steps_.emplace_front();
+  }
+  if (bounds.high - first_step_index_ >= static_cast<int>(steps_.size())) {
+    steps_.resize(bounds.high - first_step_index_ + 1);
+  }
+
   // return the lower and upper windows that contain the point in question
   return bounds;
 }
 
-RollingWindowReducer::WindowDataProcessor::WindowDataProcessor(
-    const RunningStats::Config& config)
-    : running_stats_(config), error_count_(0) {}
+RollingWindowReducer::WindowTotals& RollingWindowReducer::WindowTotals::
+operator+=(const WindowTotals& other) {
+  count += other.count;
+  sum += other.sum;
+  error_count += other.error_count;
+  denominator_count += other.denominator_count;
+  denominator_sum += other.denominator_sum;
+  return *this;
+}
 
-double RollingWindowReducer::WindowDataProcessor::GetWindowValue(
-    const OutputConfig& output_config) {
-  RunningStats::Result result;
+// static
+double RollingWindowReducer::Subreducer::GetWindowValue(
+    const OutputConfig& output_config, const WindowTotals& window,
+    RunningStats::Error summary_error, const RunningStats::Summary& summary) {
+  RunningStats::Error error = RunningStats::Error::kOk;
+  double value = 0;
 
   switch (output_config.window_operation) {
     case RWRConfig::RATIO_SUM:
       // The ratio in RATIO_SUM is calculated outside of the individual
-      // WindowDataProcessor value calculation, which only provides the SUM
-      // values for both the numerator and denominator of the RATIO calculation.
+      // window value calculation, which only provides the SUM values for both
+      // the numerator and denominator of the RATIO calculation.
       ABSL_FALLTHROUGH_INTENDED;
     case RWRConfig::SUM:
-      result = running_stats_.Sum();
+      value = window.sum;
       break;
     case RWRConfig::MEAN:
-      result = running_stats_.Mean();
+      if (window.count == 0) {
+        error = RunningStats::Error::kNoData;
+      } else {
+        value = window.sum / window.count;
+      }
       break;
     case RWRConfig::COUNT:
-      result = running_stats_.Count();
+      value = window.count;
       break;
     case RWRConfig::ERROR_COUNT:
-      result.value = error_count_;
+      value = window.error_count;
       break;
     case RWRConfig::PERCENTILE:
-      result = running_stats_.Percentile(output_config.percentile);
+      error = summary_error;
+      if (error == RunningStats::Error::kOk) {
+        value = summary.percentiles[output_config.percentile_index];
+      }
       break;
     default:
       LOG(FATAL) << "Unknown window operation type: "
@@ -640,12 +1289,13 @@ double RollingWindowReducer::WindowDataProcessor::GetWindowValue(
       return 0;
   }
 
-  if (!result.error.empty()) {
-    LOG(WARNING) << "RunningStats::Result has error: " << result.error;
+  if (error != RunningStats::Error::kOk) {
+    LOG(WARNING) << "RunningStats::Result has error: "
+                 << RunningStats::ErrorMessage(error);
     return 0;
   }
 
-  return result.value;
+  return value;
 }
 
 std::string RollingWindowReducer::StringAddPoints(
@@ -20,6 +20,9 @@
 #ifndef CXX_HELPERS_ROLLING_WINDOW_REDUCER_ROLLING_WINDOW_REDUCER_H_
 #define CXX_HELPERS_ROLLING_WINDOW_REDUCER_ROLLING_WINDOW_REDUCER_H_
 
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <set>
@@ -29,11 +32,13 @@
 #include <vector>
 
 #include "src/google/protobuf/repeated_field.h"
-#include "absl/container/node_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "cxx/helpers/status/status.h"
 #include "cxx/helpers/status/statusor.h"
+#include "cxx/internal/load/common/thread_pool_factory.h"
+#include "cxx/internal/metric_key_dictionary.h"
 #include "cxx/internal/pgmath.h"
+#include "cxx/internal/sample_columns.h"
 #include "cxx/spec/fileio.h"
 #include "proto/helpers/rolling_window_reducer/rolling_window_reducer.pb.h"
 #include "spec/proto/mako.pb.h"
@@ -83,6 +88,37 @@ class RollingWindowReducer {
   // metric key = output_metric_key
   Status Complete(mako::helpers::RWRCompleteOutput* output);
 
+  // Sets the maximum number of threads used to process points. Subreducers
+  // that do not take each other's output then process the same points
+  // concurrently, with the same output as a single thread. A value that is not
+  // positive means one thread per core. Defaults to 1.
+  void SetMaxThreads(int max_threads);
+
+#ifndef SWIG
+  // Receives each SamplePoint of the windows finalized in streaming mode.
+  using FinalizedWindowCallback = std::function<Status(const SamplePoint&)>;
+
+  // Enables streaming mode, in which a window is finalized as soon as no
+  // further input can fall in it. The SamplePoints of finalized windows are
+  // passed to callback instead of being output by Complete(), and their data
+  // is freed, so memory is bounded by the windows still open. Complete()
+  // outputs the windows that remain. Unlike without streaming, it does not
+  // take the points already in its output as input, so that callback may
+  // append to the same output; reducers are chained through callback instead.
+  //
+  // If input_ordered, the points (or errors) for each config must be added in
+  // order of input value, and windows are finalized as the input moves past
+  // them. Otherwise windows are finalized by AdvanceWatermark(). Either way,
+  // AddPoints() returns an error for input that falls in a finalized window.
+  // Must be called before any points are added.
+  void EnableStreaming(FinalizedWindowCallback callback, bool input_ordered);
+
+  // Declares that no point or error with an input value below watermark will
+  // be added, and finalizes the windows that the watermark has moved past.
+  // Returns an error if streaming mode is not enabled.
+  Status AdvanceWatermark(double watermark);
+#endif  // #ifndef SWIG
+
   // Exposed for SWIG which doesn't work with mako::helpers::Status
   std::string StringAddPoints(
       const mako::helpers::RWRAddPointsInput& input);
@@ -102,43 +138,79 @@ class RollingWindowReducer {
   // it. Returns an error if the config is not valid.
   Status AddConfig(const RWRConfig& config);
 
+  // Reduces the files, returning the output points. If streaming_callback is
+  // set, the files must be in order of input value, and the points of windows
+  // are passed to it as they are finalized rather than returned. Up to
+  // max_threads files are read concurrently, as per SetMaxThreads().
   static StatusOr<google::protobuf::RepeatedPtrField<SamplePoint> > ReduceImpl(
       absl::Span<absl::string_view> file_paths,
-      const std::vector<RWRConfig>& configs, FileIO* file_io);
+      const std::vector<RWRConfig>& configs, FileIO* file_io,
+      const FinalizedWindowCallback& streaming_callback = nullptr,
+      int max_threads = 1);
   Status CompleteImpl(google::protobuf::RepeatedPtrField<SamplePoint>* output);
 
+  // In streaming mode, finalizes the windows of each subreducer that neither
+  // new input nor the future output of earlier subreducers can fall in.
+  Status FinalizeWindows();
+
+  // Passes the points output by the subreducer at subreducer_index to the
+  // subreducers after it, which may take them as input, and then to the
+  // streaming callback if there is one, or else appends them to output.
+  Status StreamOutput(std::size_t subreducer_index,
+                      google::protobuf::RepeatedPtrField<SamplePoint>* points,
+                      google::protobuf::RepeatedPtrField<SamplePoint>* output);
+
+  // Adds the records of a block read from a sample file, taking the values of
+  // each input metric a column at a time.
+  Status AddColumns(const mako::internal::SampleColumns& columns);
+
+  // Fills metric_ids_ with the id in metric_keys_ of each metric value in
+  // points, in order, or MetricKeyDictionary::kNotFound for metrics that no
+  // config takes as input.
+  void LookUpMetricIds(
+      const google::protobuf::RepeatedPtrField<SamplePoint>& points);
+
   struct OutputConfig {
     explicit OutputConfig(const RWRConfig& config)
         : metric_key(config.output_metric_key()),
           window_operation(config.window_operation()),
           percentile(config.percentile_milli() / 100000.0),
+          percentile_index(-1),
           scaling_factor(config.output_scaling_factor()),
           zero_for_empty_window(config.zero_for_empty_window()) {}
 
     std::string metric_key;
     RWRConfig::WindowOperation window_operation;
     double percentile;  // only for percentile operation
+    // Index of percentile in the window summary; only for percentile
+    // operation.
+    int percentile_index;
     double scaling_factor;
     bool zero_for_empty_window;
   };
 
-  // Class to keep track of metric values in a specific window.
-  // Important to keep this class's size small since an instance of it
-  // will be created for each window
-  class WindowDataProcessor {
-   public:
-    explicit WindowDataProcessor(
-        const mako::internal::RunningStats::Config& config);
-
-    void AddPoint(double point) { running_stats_.Add(point); }
-    void AddError() { ++error_count_; }
-
-    // Get current value of window.
-    double GetWindowValue(const OutputConfig& output_config);
+  // Totals of the values and errors at a step, or over a run of steps. Each
+  // point is added to the totals of one step, regardless of steps_per_window,
+  // and the totals of a window are the sum of those of the steps it spans.
+  struct WindowTotals {
+    WindowTotals& operator+=(const WindowTotals& other);
+
+    int64_t count = 0;
+    double sum = 0;
+    int64_t error_count = 0;
+    // For use when computing RATIO, the totals of the denominator.
+    int64_t denominator_count = 0;
+    double denominator_sum = 0;
+  };
 
-   private:
-    mako::internal::RunningStats running_stats_;
-    int64_t error_count_;
+  // Keeps track of the points and errors whose highest containing window
+  // starts at a specific step. Important to keep this small since an instance
+  // of it will be created for each step.
+  struct StepData {
+    WindowTotals totals;
+    // Only kept for percentile operations, since percentiles cannot be
+    // derived from totals. A window merges the stats of the steps it spans.
+    std::unique_ptr<mako::internal::RunningStats> stats;
   };
 
   // Each Subreducer keeps track of the windows for the metric(s) for a
@@ -147,12 +219,40 @@ class RollingWindowReducer {
   // only create one object per set of similar configs.
   class Subreducer {
    public:
-    Subreducer(const RWRConfig& config, int max_sample_size,
-               std::unique_ptr<RE2> error_matcher);
-
-    void AddPoints(const mako::helpers::RWRAddPointsInput& input);
+    // The input metric keys of config are interned in metric_keys.
+    Subreducer(const RWRConfig& config,
+               const mako::internal::RunningStats::Config& running_stats_config,
+               std::unique_ptr<RE2> error_matcher,
+               mako::internal::MetricKeyDictionary* metric_keys);
+
+    // metric_ids holds the id of each metric value in input, in order.
+    // Returns an error if any input falls in a finalized window, after adding
+    // the rest.
+    Status AddPoints(const mako::helpers::RWRAddPointsInput& input,
+                     const std::vector<int>& metric_ids);
+    // Adds the points stored by column in columns, whose key with id k has
+    // id key_metric_ids[k]. Their other records are not added.
+    Status AddColumns(const mako::internal::SampleColumns& columns,
+                      const std::vector<int>& key_metric_ids);
+    // Outputs the windows not yet finalized.
     void Complete(google::protobuf::RepeatedPtrField<SamplePoint>* output);
 
+    // Outputs the windows that lie wholly below watermark and have not been
+    // output yet, and frees the data that no later window needs.
+    void FinalizeWindows(double watermark,
+                         google::protobuf::RepeatedPtrField<SamplePoint>* output);
+
+    // Returns a lower bound on the input value of the points that will be
+    // output for windows not yet finalized, if no further input falls below
+    // watermark.
+    double LowestFutureOutput(double watermark);
+
+    // Returns whether this takes an output metric of other as input.
+    bool TakesOutputOf(const Subreducer& other) const;
+
+    // The highest input value of the points or errors added so far.
+    double max_input_value() const { return max_input_value_; }
+
     // Compare another config to this reducer's config. If the two configs are
     // "similar", merge other_config into this reducer and return true. If the
     // other config is not similar, does nothing and returns false.
@@ -160,6 +260,13 @@ class RollingWindowReducer {
     bool TryMergeSimilarConfig(const RWRConfig& other_config);
 
    private:
+    // Adds an output for the config, registering its percentile if needed.
+    void AddOutputConfig(const RWRConfig& config);
+
+    // Returns whether the metric with the given id is an input or denominator
+    // metric.
+    bool TakesMetric(int metric_id) const;
+
     // Returns whether a sampler error message matches the error_matcher set in
     // the config. Will always return true if no error_matcher was set.
     bool IsMatch(absl::string_view error_message);
@@ -178,35 +285,64 @@ class RollingWindowReducer {
       int low, high;  // inclusive
     };
 
-    // Updates the base window index and window bounds with the sample X value.
-    // It then returns the indices of the lower and upper windows that contain
-    // the X value.
+    // Updates the base window index and window bounds with the sample X value,
+    // growing steps_ to hold the step of the X value. It then returns the
+    // indices of the lower and upper windows that contain the X value.
     WindowIndexBounds UpdateWindowIndexBounds(double sample_x_val);
 
     // Returns a window starting location based on the index.
     double WindowLocation(int window_index);
 
-    // Given a point, this function gives the point to all relevant
-    // WindowDataProcessors. No-op if value_key is not an input_metric_key or
-    // denominator_metric_key.
-    void AddPointToAllContainingWindows(double x_val, double y_val,
-                                        const std::string& value_key);
-
-    // Given an error, this function gives the error to all relevant
-    // WindowDataProcessors
-    void AddErrorToAllContainingWindows(double x_val);
-
-    // Append the SamplePoint(s) for the window at the given index. An empty
-    // window has no WindowDataProcessor and is represented by null.
+    // Returns the data of the step holding the highest window that contains
+    // the X value, creating it if needed.
+    StepData* MutableStepData(double x_val);
+
+    // Returns whether a window containing the X value has been finalized.
+    bool InFinalizedWindow(double x_val);
+
+    // Given a point, this function adds the point to the step of its highest
+    // containing window. No-op if the metric is not an input_metric_key or
+    // denominator_metric_key. Returns false, without adding it, if the point
+    // falls in a finalized window.
+    bool AddPointToStep(double x_val, double y_val, int metric_id);
+
+    // Given an error, this function adds the error to the step of its highest
+    // containing window. Returns false, without adding it, if the error falls
+    // in a finalized window.
+    bool AddErrorToStep(double x_val);
+
+    // Appends the SamplePoint(s) for the windows from next_window_index_ up to
+    // but excluding end_window_index, and at most through max_window_index_,
+    // then frees the steps that no later window spans.
+    void OutputWindows(int end_window_index,
+                       google::protobuf::RepeatedPtrField<SamplePoint>* output);
+
+    // Append the SamplePoint(s) for the window at the given index. The summary
+    // and its error must come from summarizing the window's stats if there are
+    // percentile outputs.
     void AppendOutputPointsForWindow(
-        int window_index, WindowDataProcessor* window,
+        int window_index, const WindowTotals& window,
+        mako::internal::RunningStats::Error summary_error,
         google::protobuf::RepeatedPtrField<SamplePoint>* output);
 
+    // Get the value of a window for an output config. The ratio of RATIO_SUM
+    // is computed by the caller; this only provides the numerator.
+    static double GetWindowValue(
+        const OutputConfig& output_config, const WindowTotals& window,
+        mako::internal::RunningStats::Error summary_error,
+        const mako::internal::RunningStats::Summary& summary);
+
     // Construction parameters
     std::set<std::string> input_metric_keys_;
     // When computing window of a Ratio, remember which metric is the
     // denominator.
     std::set<std::string> denominator_input_metric_keys_;
+    // The above as flags, indexed by metric id. Ids past the end are neither.
+    enum MetricRole : char {
+      kPrimaryMetric = 1,
+      kDenominatorMetric = 2,
+    };
+    std::vector<char> metric_roles_;
     // Sampler names to pull errors from
     std::set<std::string> error_sampler_name_inputs_;
     double window_size_;
@@ -214,6 +350,13 @@ class RollingWindowReducer {
     int steps_per_window_;
     mako::internal::RunningStats::Config running_stats_config_;
     std::vector<OutputConfig> output_configs_;
+    // Percentiles of all percentile output configs, summarized together.
+    std::vector<double> percentiles_;
+    // Reused for each window, to avoid reallocating its percentiles.
+    mako::internal::RunningStats::Summary window_summary_;
+    // Used by bounded samples. Each subreducer has its own so that subreducers
+    // can run on different threads.
+    mako::internal::Random random_;
 
     // Used to map window indices to window locations
     double base_window_loc_;
@@ -221,13 +364,17 @@ class RollingWindowReducer {
     // Useful in looping through all windows
     int min_window_index_;
     int max_window_index_;
-
-    // Maps window index to window data (stored in WindowDataProcessor
-    // instances)
-    absl::node_hash_map<int, WindowDataProcessor> window_data_;
-    // For use when computing RATIO, keep a separate window data for the
-    // denominator.
-    absl::node_hash_map<int, WindowDataProcessor> window_data_denominator_;
+    // The first window that has not been output, or the minimum int if none
+    // has. The windows before it are finalized.
+    int next_window_index_;
+    double max_input_value_;
+
+    // The data of the points and errors for which each window is the highest
+    // containing window, for every window index from first_step_index_ on.
+    // Window i spans the steps i to i + steps_per_window_ - 1. Grows at either
+    // end as UpdateWindowIndexBounds widens the range of windows.
+    std::deque<StepData> steps_;
+    int first_step_index_;
     // Regex specified in RWRConfig.error_matcher. Used to match against error
     // text to determine if that error should be counted for ERROR_COUNT
     // operations.
@@ -236,12 +383,29 @@ class RollingWindowReducer {
 
   // At least one subreducer, and at most one subreducer per config.
   std::vector<std::unique_ptr<Subreducer> > subreducers_;
+  // Ids of the input metric keys of all configs, shared by the subreducers so
+  // that each key is looked up once per point rather than once per
+  // subreducer.
+  mako::internal::MetricKeyDictionary metric_keys_;
+  // Reused by LookUpMetricIds.
+  std::vector<int> metric_ids_;
+  // Reused by AddColumns, for the ids of the keys of a block.
+  std::vector<int> column_metric_ids_;
+  // Runs the subreducers concurrently, as per SetMaxThreads(). Null for one
+  // thread.
+  std::unique_ptr<mako::internal::ThreadPool> thread_pool_;
+
+  // Set in streaming mode.
+  FinalizedWindowCallback streaming_callback_;
+  bool input_ordered_ = false;
+  double watermark_ = -std::numeric_limits<double>::infinity();
 
   // friend function so that it can live in a separate visibility-restricted
   // build rule but still have access to private methods / fields.
   friend Status Reduce(
       absl::string_view file_path, const std::vector<RWRConfig>& configs,
-      FileIO* file_io);
+      FileIO* file_io, bool input_ordered, int max_threads);
+  friend class ReduceFilesTest;
 };
 
 
@@ -13,6 +13,12 @@
 // limitations under the License.
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer_internal.h"
 
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer.h"
 #include "cxx/helpers/status/canonical_errors.h"
@@ -21,14 +27,103 @@
 namespace mako {
 namespace helpers {
 
+namespace {
+
+// The number of records passed to each FileIO::ReadBatch() or WriteBatch().
+constexpr std::size_t kBatchSize = 1024;
+
+// Appends each point to the open file.
+Status WritePoints(const google::protobuf::RepeatedPtrField<SamplePoint>& points,
+                   FileIO* file_io) {
+  std::vector<std::string> batch;
+  mako::SampleRecord record;
+  for (const auto& point : points) {
+    *record.mutable_sample_point() = point;
+    batch.push_back(record.SerializeAsString());
+    if (batch.size() == kBatchSize) {
+      if (!file_io->WriteBatch(batch)) {
+        return Annotate(UnknownError(file_io->Error()), "writing record");
+      }
+      batch.clear();
+    }
+  }
+  if (!file_io->WriteBatch(batch)) {
+    return Annotate(UnknownError(file_io->Error()), "writing record");
+  }
+  return OkStatus();
+}
+
+// Appends the records of the file at from_path to the open file.
+Status CopyRecords(absl::string_view from_path, FileIO* from_file_io,
+                   FileIO* file_io) {
+  if (!from_file_io->Open(std::string(from_path), FileIO::AccessMode::kRead)) {
+    return Annotate(UnknownError(from_file_io->Error()),
+                    "opening finalized windows file");
+  }
+  const auto close_file = mako::internal::MakeCleanup(
+      [from_file_io] { from_file_io->Close(); });
+  // The records are copied as they are, without parsing them.
+  std::vector<std::string> batch;
+  while (from_file_io->ReadBatch(kBatchSize, &batch)) {
+    if (!file_io->WriteBatch(batch)) {
+      return Annotate(UnknownError(file_io->Error()), "writing record");
+    }
+  }
+  if (!from_file_io->ReadEOF()) {
+    return Annotate(UnknownError(from_file_io->Error()),
+                    "reading finalized windows file");
+  }
+  return OkStatus();
+}
+
+}  // namespace
+
 Status Reduce(absl::string_view file_path,
                                     const std::vector<RWRConfig>& configs,
-                                    FileIO* file_io) {
+                                    FileIO* file_io, bool input_ordered,
+                                    int max_threads) {
+  // Windows finalized while file_path is being read cannot be appended to it
+  // yet, so they are written to a temporary file and copied over at the end.
+  const std::string finalized_path = absl::StrCat(file_path, ".finalized");
+  std::unique_ptr<FileIO> finalized_file_io;
+  RollingWindowReducer::FinalizedWindowCallback streaming_callback;
+  if (input_ordered) {
+    if (file_io == nullptr) {
+      return InvalidArgumentError("FileIO pointer invalid.");
+    }
+    finalized_file_io = file_io->MakeInstance();
+    if (!finalized_file_io->Open(finalized_path, FileIO::AccessMode::kWrite)) {
+      return Annotate(UnknownError(finalized_file_io->Error()),
+                      "opening finalized windows file");
+    }
+    streaming_callback = [&finalized_file_io](const SamplePoint& point) {
+      mako::SampleRecord record;
+      *record.mutable_sample_point() = point;
+      if (!finalized_file_io->Write(record)) {
+        return Annotate(UnknownError(finalized_file_io->Error()),
+                        "writing finalized windows file");
+      }
+      return OkStatus();
+    };
+  }
+  const auto delete_finalized = mako::internal::MakeCleanup(
+      [&finalized_file_io, &finalized_path] {
+        if (finalized_file_io) {
+          finalized_file_io->Close();
+          finalized_file_io->Delete(finalized_path);
+        }
+      });
+
   auto status_or_points = RollingWindowReducer::ReduceImpl(
-      absl::MakeSpan(&file_path, 1), configs, file_io);
+      absl::MakeSpan(&file_path, 1), configs, file_io, streaming_callback,
+      max_threads);
   if (!status_or_points.ok()) {
     return std::move(status_or_points).status();
   }
+  if (finalized_file_io && !finalized_file_io->Close()) {
+    return Annotate(UnknownError(finalized_file_io->Error()),
+                    "closing finalized windows file");
+  }
 
   if (!file_io->Open(std::string(file_path), FileIO::AccessMode::kAppend)) {
     return Annotate(UnknownError(file_io->Error()), "opening file");
@@ -36,14 +131,14 @@ Status Reduce(absl::string_view file_path,
   const auto close_file =
       mako::internal::MakeCleanup([file_io] { file_io->Close(); });
 
-  for (auto& point : std::move(status_or_points).value()) {
-    mako::SampleRecord record;
-    *record.mutable_sample_point() = std::move(point);
-    if (!file_io->Write(record)) {
-      return Annotate(UnknownError(file_io->Error()), "writing record");
+  if (finalized_file_io) {
+    const Status status =
+        CopyRecords(finalized_path, finalized_file_io.get(), file_io);
+    if (!status.ok()) {
+      return status;
     }
   }
-  return OkStatus();
+  return WritePoints(status_or_points.value(), file_io);
 }
 }  // namespace helpers
 }  // namespace mako
@@ -29,8 +29,17 @@ namespace helpers {
 // Intended for use by Quickstore. If you think you have a valid use case for
 // this functionit, please reach out to us at
 // https://github.com/google/mako/issues
+//
+// If input_ordered, the sample points in the file, and separately the sample
+// errors, must be in order of input value. Windows are then finalized as the
+// file is read and buffered in a temporary file next to file_path, so memory
+// is bounded by the windows still open.
+//
+// The subreducers run on up to max_threads threads, or one per core if
+// max_threads is not positive; see RollingWindowReducer::SetMaxThreads().
 Status Reduce(absl::string_view file_path,
-              const std::vector<RWRConfig>& configs, FileIO* file_io);
+              const std::vector<RWRConfig>& configs, FileIO* file_io,
+              bool input_ordered = false, int max_threads = 1);
 
 }  // namespace helpers
 }  // namespace mako
@@ -13,9 +13,13 @@
 // limitations under the License.
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <utility>
 
+#include "benchmark/benchmark.h"
 #include "glog/logging.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -25,6 +29,7 @@
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer_internal.h"
 #include "cxx/helpers/status/canonical_errors.h"
 #include "cxx/helpers/status/status_matchers.h"
+#include "cxx/internal/sample_columns.h"
 #include "cxx/testing/protocol-buffer-matchers.h"
 #include "proto/helpers/rolling_window_reducer/rolling_window_reducer.pb.h"
 #include "spec/proto/mako.pb.h"
@@ -1115,6 +1120,270 @@ TEST(RollingWindowReducerTest, MergeAfterPercentile) {
 }
 
 
+TEST(RollingWindowReducerTest, MergeSketchPercentile) {
+  RWRConfig base_config;
+  base_config.add_input_metric_keys(kInputKey);
+  base_config.set_window_size(2);
+  base_config.set_steps_per_window(2);
+  base_config.set_zero_for_empty_window(false);
+  RWRConfig config1 = base_config;
+  config1.set_output_metric_key("p90");
+  config1.set_window_operation(RWRConfig::PERCENTILE);
+  config1.set_percentile_milli(90000);
+  config1.set_quantile_sketch_k(50);
+  RWRConfig config2 = base_config;
+  config2.set_output_metric_key("sum");
+  config2.set_window_operation(RWRConfig::SUM);
+
+  auto reducer_or = RollingWindowReducer::NewMerged({config1, config2});
+  ASSERT_OK(reducer_or);
+  auto rwr = std::move(reducer_or).value();
+
+  // 10000 points in [0, 1) with values 0..9999, so the window at x=1 holds
+  // them all and far exceeds the sketch capacity.
+  std::vector<std::pair<double, double>> points;
+  constexpr int kNumPoints = 10000;
+  for (int i = 0; i < kNumPoints; ++i) {
+    points.emplace_back(static_cast<double>(i) / kNumPoints, i);
+  }
+  ASSERT_OK(rwr->AddPoints(HelperCreateRWRAddPointsInput(kInputKey, points)));
+  RWRCompleteOutput output;
+  ASSERT_OK(rwr->Complete(&output));
+
+  // Rank error is bounded by about 1.7 / k.
+  const double max_error = 1.7 / 50 * kNumPoints;
+  EXPECT_THAT(
+      output.point_list(),
+      ContainsPoints({SamplePointFullMatch(
+          HelperDoubleNear(1),
+          KeyedValueIs("p90", ::testing::DoubleNear(0.9 * (kNumPoints - 1),
+                                                    max_error)))}));
+  EXPECT_THAT(output.point_list(),
+              ContainsPoints({ExactSamplePoint(
+                  1, "sum", kNumPoints * (kNumPoints - 1) / 2.0)}));
+}
+
+
+// Sorts points by input value and then metric key, for comparing output that
+// is produced in a different order.
+std::vector<SamplePoint> SortedPoints(
+    const google::protobuf::RepeatedPtrField<SamplePoint>& points) {
+  std::vector<SamplePoint> sorted(points.begin(), points.end());
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const SamplePoint& a, const SamplePoint& b) {
+                     return std::make_pair(
+                                a.input_value(),
+                                a.metric_value_list(0).value_key()) <
+                            std::make_pair(b.input_value(),
+                                           b.metric_value_list(0).value_key());
+                   });
+  return sorted;
+}
+
+std::vector<RWRConfig> StreamingTestConfigs() {
+  std::vector<RWRConfig> configs(5);
+  for (auto& config : configs) {
+    config.add_input_metric_keys(kInputKey);
+    config.set_window_size(2);
+    config.set_steps_per_window(4);
+    config.set_zero_for_empty_window(true);
+  }
+  configs[0].set_output_metric_key("sum");
+  configs[0].set_window_operation(RWRConfig::SUM);
+  configs[1].set_output_metric_key("median");
+  configs[1].set_window_operation(RWRConfig::PERCENTILE);
+  configs[1].set_percentile_milli(50000);
+  configs[1].set_zero_for_empty_window(false);
+  configs[2].set_output_metric_key("mean");
+  configs[2].set_window_operation(RWRConfig::MEAN);
+  configs[2].set_steps_per_window(1);
+  configs[2].set_zero_for_empty_window(false);
+  // Takes the output of the sum config as input.
+  configs[3].set_input_metric_keys(0, "sum");
+  configs[3].set_output_metric_key("max_sum");
+  configs[3].set_window_operation(RWRConfig::PERCENTILE);
+  configs[3].set_percentile_milli(100000);
+  configs[3].set_window_size(5);
+  configs[4].clear_input_metric_keys();
+  configs[4].add_error_sampler_name_inputs(kSamplerName);
+  configs[4].set_output_metric_key("errors");
+  configs[4].set_window_operation(RWRConfig::ERROR_COUNT);
+  return configs;
+}
+
+TEST(RollingWindowReducerTest, StreamingMatchesComplete) {
+  // Points in order of input value, with a gap from 20 to 30.
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 500; ++i) {
+    const double x = i * 0.1;
+    if (x < 20 || x > 30) {
+      points.emplace_back(x, i % 13);
+    }
+  }
+  std::vector<double> errors;
+  for (int i = 0; i < 40; ++i) {
+    errors.push_back(i * 1.3);
+  }
+
+  auto batch = RollingWindowReducer::NewMerged(StreamingTestConfigs());
+  ASSERT_OK(batch);
+  RWRAddPointsInput input = HelperCreateRWRAddPointsInput(kInputKey, points);
+  *input.mutable_error_list() =
+      HelperCreateRWRAddPointsInputWithErrors(kSamplerName, errors)
+          .error_list();
+  ASSERT_OK(batch.value()->AddPoints(input));
+  RWRCompleteOutput batch_output;
+  ASSERT_OK(batch.value()->Complete(&batch_output));
+
+  auto streaming = RollingWindowReducer::NewMerged(StreamingTestConfigs());
+  ASSERT_OK(streaming);
+  RWRCompleteOutput streaming_output;
+  streaming.value()->EnableStreaming(
+      [&streaming_output](const SamplePoint& point) {
+        *streaming_output.add_point_list() = point;
+        return OkStatus();
+      },
+      /*input_ordered=*/true);
+  // Add the points in batches, and the errors after all of them.
+  for (std::size_t i = 0; i < points.size(); i += 37) {
+    ASSERT_OK(streaming.value()->AddPoints(HelperCreateRWRAddPointsInput(
+        kInputKey,
+        {points.begin() + i,
+         points.begin() + std::min(i + 37, points.size())})));
+  }
+  ASSERT_OK(streaming.value()->AddPoints(
+      HelperCreateRWRAddPointsInputWithErrors(kSamplerName, errors)));
+  // Most windows are finalized before Complete().
+  EXPECT_GT(streaming_output.point_list_size(),
+            batch_output.point_list_size() / 2);
+  ASSERT_OK(streaming.value()->Complete(&streaming_output));
+
+  EXPECT_THAT(SortedPoints(streaming_output.point_list()),
+              ::testing::Pointwise(EqualsProto(),
+                                   SortedPoints(batch_output.point_list())));
+}
+
+TEST(RollingWindowReducerTest, StreamingLeavesCompleteOutput) {
+  // Without streaming, points already in the output of Complete() are input,
+  // to chain reducers. With streaming they are left as they are, since they
+  // are normally the windows finalized so far.
+  const RWRAddPointsInput input =
+      HelperCreateRWRAddPointsInput(kInputKey, {{1, 10}, {1.5, 20}});
+
+  auto batch = RollingWindowReducer::NewMerged(StreamingTestConfigs());
+  ASSERT_OK(batch);
+  RWRCompleteOutput batch_output;
+  *batch_output.mutable_point_list() = input.point_list();
+  ASSERT_OK(batch.value()->Complete(&batch_output));
+  EXPECT_GT(batch_output.point_list_size(), input.point_list_size());
+
+  auto streaming = RollingWindowReducer::NewMerged(StreamingTestConfigs());
+  ASSERT_OK(streaming);
+  RWRCompleteOutput streaming_output;
+  streaming.value()->EnableStreaming(
+      [&streaming_output](const SamplePoint& point) {
+        *streaming_output.add_point_list() = point;
+        return OkStatus();
+      },
+      /*input_ordered=*/false);
+  *streaming_output.mutable_point_list() = input.point_list();
+  ASSERT_OK(streaming.value()->Complete(&streaming_output));
+  EXPECT_THAT(streaming_output.point_list(),
+              ::testing::Pointwise(EqualsProto(), input.point_list()));
+}
+
+TEST(RollingWindowReducerTest, StreamingWithWatermark) {
+  auto reducer_or = RollingWindowReducer::New(StreamingTestConfigs()[0]);
+  ASSERT_OK(reducer_or);
+  auto rwr = std::move(reducer_or).value();
+  EXPECT_THAT(rwr->AdvanceWatermark(0),
+              StatusIs(StatusCode::kFailedPrecondition));
+
+  std::vector<SamplePoint> finalized;
+  rwr->EnableStreaming(
+      [&finalized](const SamplePoint& point) {
+        finalized.push_back(point);
+        return OkStatus();
+      },
+      /*input_ordered=*/false);
+  // Input out of order is accepted until the watermark passes it.
+  ASSERT_OK(rwr->AddPoints(
+      HelperCreateRWRAddPointsInput(kInputKey, {{3, 1}, {0, 2}, {1, 4}})));
+  EXPECT_THAT(finalized, ::testing::IsEmpty());
+
+  // The windows at 0 to 1.5 hold input only below 2.5.
+  ASSERT_OK(rwr->AdvanceWatermark(2.5));
+  EXPECT_THAT(finalized,
+              ::testing::ElementsAre(SamplePointWithXY(-0.5, 2),
+                                     SamplePointWithXY(0, 2),
+                                     SamplePointWithXY(0.5, 6),
+                                     SamplePointWithXY(1, 6),
+                                     SamplePointWithXY(1.5, 4)));
+
+  // Input that would fall in a finalized window is rejected.
+  EXPECT_THAT(rwr->AddPoints(
+                  HelperCreateRWRAddPointsInput(kInputKey, {{2.4, 8}})),
+              StatusIs(StatusCode::kFailedPrecondition));
+  ASSERT_OK(
+      rwr->AddPoints(HelperCreateRWRAddPointsInput(kInputKey, {{2.6, 8}})));
+
+  RWRCompleteOutput output;
+  ASSERT_OK(rwr->Complete(&output));
+  EXPECT_THAT(output.point_list(),
+              ::testing::ElementsAre(SamplePointWithXY(2, 12),
+                                     SamplePointWithXY(2.5, 9),
+                                     SamplePointWithXY(3, 9),
+                                     SamplePointWithXY(3.5, 9),
+                                     SamplePointWithXY(4, 1)));
+}
+
+TEST(RollingWindowReducerTest, ParallelMatchesSerial) {
+  std::vector<RWRConfig> configs = StreamingTestConfigs();
+  // Takes the output of the max_sum config, which takes that of the sum
+  // config, so the subreducers run in three waves.
+  configs.push_back(configs[3]);
+  configs.back().set_input_metric_keys(0, "max_sum");
+  configs.back().set_output_metric_key("mean_max_sum");
+  configs.back().set_window_operation(RWRConfig::MEAN);
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.emplace_back(i * 0.037, std::sin(i) * 1e3);
+  }
+  std::vector<double> errors;
+  for (int i = 0; i < 40; ++i) {
+    errors.push_back(i * 1.3);
+  }
+
+  RWRCompleteOutput serial_output;
+  for (int max_threads : {1, 2, 4, 0}) {
+    SCOPED_TRACE(max_threads);
+    auto reducer = RollingWindowReducer::NewMerged(configs);
+    ASSERT_OK(reducer);
+    reducer.value()->SetMaxThreads(max_threads);
+    for (std::size_t i = 0; i < points.size(); i += 300) {
+      ASSERT_OK(reducer.value()->AddPoints(HelperCreateRWRAddPointsInput(
+          kInputKey,
+          {points.begin() + i,
+           points.begin() + std::min(i + 300, points.size())})));
+    }
+    ASSERT_OK(reducer.value()->AddPoints(
+        HelperCreateRWRAddPointsInputWithErrors(kSamplerName, errors)));
+    RWRCompleteOutput output;
+    ASSERT_OK(reducer.value()->Complete(&output));
+    if (max_threads == 1) {
+      serial_output = output;
+      // The last subreducer, in the last wave, outputs last.
+      ASSERT_GT(serial_output.point_list_size(), 0);
+      EXPECT_EQ("mean_max_sum", serial_output.point_list()
+                                    .rbegin()
+                                    ->metric_value_list(0)
+                                    .value_key());
+    } else {
+      EXPECT_THAT(output, EqualsProto(serial_output));
+    }
+  }
+}
+
 TEST(RollingWindowReducerTest, ReduceAppendsToFileTest) {
   const std::string error_count_key = "error_count";
 
@@ -1150,6 +1419,102 @@ TEST(RollingWindowReducerTest, ReduceAppendsToFileTest) {
   EXPECT_TRUE(has_key);
 }
 
+TEST(RollingWindowReducerTest, ReduceOrderedInputStreams) {
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 300; ++i) {
+    points.emplace_back(i * 0.1, i % 7);
+  }
+  RWRAddPointsInput input = HelperCreateRWRAddPointsInput(kInputKey, points);
+  *input.mutable_error_list() =
+      HelperCreateRWRAddPointsInputWithErrors(kSamplerName, {1, 5, 9})
+          .error_list();
+
+  mako::memory_fileio::FileIO file_io;
+  WriteFile("batch_file", input, &file_io);
+  ASSERT_OK(Reduce("batch_file", StreamingTestConfigs(), &file_io));
+  WriteFile("ordered_file", input, &file_io);
+  ASSERT_OK(Reduce("ordered_file", StreamingTestConfigs(), &file_io,
+                   /*input_ordered=*/true));
+
+  RWRCompleteOutput batch_output;
+  RWRCompleteOutput ordered_output;
+  for (auto file : {std::make_pair("batch_file", &batch_output),
+                    std::make_pair("ordered_file", &ordered_output)}) {
+    ASSERT_TRUE(file_io.Open(file.first, mako::FileIO::kRead))
+        << file_io.Error();
+    mako::SampleRecord record;
+    while (file_io.Read(&record)) {
+      if (record.has_sample_point()) {
+        *file.second->add_point_list() = record.sample_point();
+      }
+    }
+    EXPECT_TRUE(file_io.ReadEOF()) << file_io.Error();
+    file_io.Close();
+  }
+  EXPECT_GT(ordered_output.point_list_size(), input.point_list_size());
+  EXPECT_THAT(SortedPoints(ordered_output.point_list()),
+              ::testing::Pointwise(EqualsProto(),
+                                   SortedPoints(batch_output.point_list())));
+  // The temporary file of finalized windows is gone.
+  EXPECT_FALSE(file_io.Open("ordered_file.finalized", mako::FileIO::kRead));
+}
+
+TEST(RollingWindowReducerTest, ReduceColumnsFiles) {
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 300; ++i) {
+    points.emplace_back(i * 0.1, i % 7);
+  }
+  RWRAddPointsInput input = HelperCreateRWRAddPointsInput(kInputKey, points);
+  *input.mutable_error_list() =
+      HelperCreateRWRAddPointsInputWithErrors(kSamplerName, {1, 5, 9})
+          .error_list();
+
+  mako::memory_fileio::FileIO file_io;
+  WriteFile("records_file", input, &file_io);
+  ASSERT_OK(Reduce("records_file", StreamingTestConfigs(), &file_io));
+  for (const bool input_ordered : {false, true}) {
+    // Blocks of 64 records, the last of which holds the errors.
+    ASSERT_TRUE(file_io.Open("columns_file", FileIO::AccessMode::kWrite));
+    mako::internal::SampleColumnsWriter writer(&file_io, 64);
+    for (const SamplePoint& sp : input.point_list()) {
+      SampleRecord sr;
+      *sr.mutable_sample_point() = sp;
+      ASSERT_TRUE(writer.Write(sr)) << file_io.Error();
+    }
+    for (const SampleError& se : input.error_list()) {
+      SampleRecord sr;
+      *sr.mutable_sample_error() = se;
+      ASSERT_TRUE(writer.Write(sr)) << file_io.Error();
+    }
+    ASSERT_TRUE(writer.Flush()) << file_io.Error();
+    file_io.Close();
+    ASSERT_OK(Reduce("columns_file", StreamingTestConfigs(), &file_io,
+                     input_ordered));
+
+    RWRCompleteOutput records_output;
+    RWRCompleteOutput columns_output;
+    for (auto file : {std::make_pair("records_file", &records_output),
+                      std::make_pair("columns_file", &columns_output)}) {
+      ASSERT_TRUE(file_io.Open(file.first, mako::FileIO::kRead))
+          << file_io.Error();
+      mako::internal::SampleFileReader reader(&file_io);
+      mako::SampleRecord record;
+      while (reader.Read(&record)) {
+        if (record.has_sample_point()) {
+          *file.second->add_point_list() = record.sample_point();
+        }
+      }
+      EXPECT_EQ("", reader.error());
+      file_io.Close();
+    }
+    EXPECT_GT(columns_output.point_list_size(), input.point_list_size());
+    EXPECT_THAT(SortedPoints(columns_output.point_list()),
+                ::testing::Pointwise(EqualsProto(),
+                                     SortedPoints(records_output.point_list())))
+        << "input_ordered: " << input_ordered;
+  }
+}
+
 TEST(RollingWindowReducerTest, SanityCheck) {
   // Simple test which is easy to rationalize.
   // Points every 0.25 starting at 0 and going to 2, with y-val = 10.
@@ -1205,6 +1570,293 @@ TEST(RollingWindowReducerTest, SanityCheck) {
   }
 }
 
+TEST(RollingWindowReducerTest, ManyStepsPerWindow) {
+  // Every point is in 50 windows, whose values must match those computed
+  // directly from the points each window contains.
+  constexpr double kManyStepsWindowSize = 10;
+  constexpr int kManyStepsPerWindow = 50;
+  RWRConfig base_config;
+  base_config.add_input_metric_keys(kInputKey);
+  base_config.set_window_size(kManyStepsWindowSize);
+  base_config.set_steps_per_window(kManyStepsPerWindow);
+  base_config.set_zero_for_empty_window(false);
+  std::vector<RWRConfig> configs;
+  for (auto window_op : {RWRConfig::COUNT, RWRConfig::SUM, RWRConfig::MEAN,
+                         RWRConfig::PERCENTILE}) {
+    RWRConfig config = base_config;
+    config.set_output_metric_key(RWRConfig_WindowOperation_Name(window_op));
+    config.set_window_operation(window_op);
+    config.set_percentile_milli(100000);  // the maximum
+    configs.push_back(config);
+  }
+  auto reducer_or = RollingWindowReducer::NewMerged(configs);
+  ASSERT_OK(reducer_or);
+  auto rwr = std::move(reducer_or).value();
+
+  // Points are kept off the window boundaries, which are multiples of 0.2.
+  // A gap between 30 and 50 leaves some windows empty.
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 300; ++i) {
+    const double x = 0.3 * i + 0.05;
+    if (x < 30 || x > 50) {
+      points.emplace_back(x, (i * 7) % 11);
+    }
+  }
+  ASSERT_OK(rwr->AddPoints(HelperCreateRWRAddPointsInput(kInputKey, points)));
+  RWRCompleteOutput output;
+  ASSERT_OK(rwr->Complete(&output));
+
+  ASSERT_GT(output.point_list_size(), 0);
+  double last_x = -std::numeric_limits<double>::infinity();
+  for (const auto& sp : output.point_list()) {
+    const double x = sp.input_value();
+    EXPECT_LE(last_x, x) << "windows are output in order";
+    last_x = x;
+
+    double count = 0, sum = 0;
+    double max = -std::numeric_limits<double>::infinity();
+    for (const auto& point : points) {
+      if (point.first >= x - kManyStepsWindowSize / 2 &&
+          point.first < x + kManyStepsWindowSize / 2) {
+        ++count;
+        sum += point.second;
+        max = std::max(max, point.second);
+      }
+    }
+    ASSERT_GT(count, 0) << "no output for empty window at " << x;
+    ASSERT_EQ(1, sp.metric_value_list_size());
+    const KeyedValue& kv = sp.metric_value_list(0);
+    const double expected =
+        kv.value_key() == "COUNT" ? count
+        : kv.value_key() == "SUM" ? sum
+        : kv.value_key() == "MEAN" ? sum / count
+                                   : max;
+    EXPECT_THAT(kv.value(), HelperDoubleNear(expected))
+        << kv.value_key() << " at " << x;
+  }
+  // 4 outputs for each window containing a point.
+  int nonempty_windows = 0;
+  for (int step = -100; step <= 1000; ++step) {
+    const double x = step * kManyStepsWindowSize / kManyStepsPerWindow;
+    nonempty_windows += std::any_of(
+        points.begin(), points.end(),
+        [x](const std::pair<double, double>& point) {
+          return point.first >= x - kManyStepsWindowSize / 2 &&
+                 point.first < x + kManyStepsWindowSize / 2;
+        });
+  }
+  EXPECT_EQ(4 * nonempty_windows, output.point_list_size());
+}
+
+TEST(RollingWindowReducerTest, SmallValuesAfterLargeOnes) {
+  // Each window holds one point, and the sums of the windows holding 1.0 must
+  // not be lost to the 1e15 values before them.
+  RWRConfig sum_config;
+  sum_config.add_input_metric_keys(kInputKey);
+  sum_config.set_output_metric_key("SUM");
+  sum_config.set_window_operation(RWRConfig::SUM);
+  sum_config.set_window_size(1);
+  sum_config.set_steps_per_window(1);
+  sum_config.set_zero_for_empty_window(false);
+  RWRConfig ratio_config = sum_config;
+  ratio_config.add_denominator_input_metric_keys("denominator");
+  ratio_config.set_output_metric_key("RATIO");
+  ratio_config.set_window_operation(RWRConfig::RATIO_SUM);
+  auto reducer_or = RollingWindowReducer::NewMerged({sum_config, ratio_config});
+  ASSERT_OK(reducer_or);
+  auto rwr = std::move(reducer_or).value();
+
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.emplace_back(i + 0.25, i < 1000 ? 1e15 : 1.0);
+  }
+  ASSERT_OK(rwr->AddPoints(HelperCreateRWRAddPointsInput(kInputKey, points)));
+  ASSERT_OK(
+      rwr->AddPoints(HelperCreateRWRAddPointsInput("denominator", points)));
+  RWRCompleteOutput output;
+  ASSERT_OK(rwr->Complete(&output));
+
+  ASSERT_EQ(2 * points.size(), output.point_list_size());
+  for (const auto& sp : output.point_list()) {
+    ASSERT_EQ(1, sp.metric_value_list_size());
+    const KeyedValue& kv = sp.metric_value_list(0);
+    const double expected = kv.value_key() == "RATIO"   ? 1.0
+                            : sp.input_value() < 1000 ? 1e15
+                                                      : 1.0;
+    EXPECT_EQ(expected, kv.value())
+        << kv.value_key() << " at " << sp.input_value();
+  }
+}
+
+TEST(RollingWindowReducerTest, PointsInAnyOrder) {
+  // Windows are added before and after those seen so far, with gaps between.
+  const std::vector<std::pair<double, double>> points = {
+      {5, 1}, {9, 2}, {1, 3}, {0.5, 4}, {12, 5}, {-3, 6}, {5.2, 7}};
+  for (bool zero_if_empty : {false, true}) {
+    for (auto window_op : {RWRConfig::SUM, RWRConfig::PERCENTILE}) {
+      auto in_order = HelperCreateRWRInstance({kInputKey}, {}, kOutputKey,
+                                              window_op, 2, 4, zero_if_empty,
+                                              50000);
+      ASSERT_NE(nullptr, in_order);
+      std::vector<std::pair<double, double>> sorted_points = points;
+      std::sort(sorted_points.begin(), sorted_points.end());
+      ASSERT_OK(in_order->AddPoints(
+          HelperCreateRWRAddPointsInput(kInputKey, sorted_points)));
+      RWRCompleteOutput in_order_output;
+      ASSERT_OK(in_order->Complete(&in_order_output));
+
+      auto any_order = HelperCreateRWRInstance({kInputKey}, {}, kOutputKey,
+                                               window_op, 2, 4, zero_if_empty,
+                                               50000);
+      ASSERT_NE(nullptr, any_order);
+      for (const auto& point : points) {
+        ASSERT_OK(any_order->AddPoints(
+            HelperCreateRWRAddPointsInput(kInputKey, {point})));
+      }
+      RWRCompleteOutput any_order_output;
+      ASSERT_OK(any_order->Complete(&any_order_output));
+
+      EXPECT_THAT(any_order_output, EqualsProto(in_order_output));
+      EXPECT_GT(any_order_output.point_list_size(), 0);
+    }
+  }
+}
+
+// Reduces points spread over many windows, with state.range(0) steps per
+// window, so that each point is in that many windows.
+static void BM_StepsPerWindow(benchmark::State& state,
+                              RWRConfig::WindowOperation window_operation) {
+  constexpr int kNumPoints = 100000;
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < kNumPoints; ++i) {
+    points.emplace_back(i / 100.0, i % 1000);
+  }
+  const RWRAddPointsInput input =
+      HelperCreateRWRAddPointsInput(kInputKey, points);
+  for (auto _ : state) {
+    auto rwr = HelperCreateRWRInstance({kInputKey}, {}, kOutputKey,
+                                       window_operation, 1, state.range(0),
+                                       false, 99000);
+    CHECK(rwr->AddPoints(input).ok());
+    RWRCompleteOutput output;
+    CHECK(rwr->Complete(&output).ok());
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumPoints);
+}
+BENCHMARK_CAPTURE(BM_StepsPerWindow, mean, RWRConfig::MEAN)->Range(1, 100);
+BENCHMARK_CAPTURE(BM_StepsPerWindow, percentile, RWRConfig::PERCENTILE)
+    ->Range(1, 100);
+
+// Reduces points with 20 percentile configs of different window sizes, so that
+// none merge, on state.range(0) threads.
+static void BM_ParallelSubreducers(benchmark::State& state) {
+  constexpr int kNumPoints = 100000;
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < kNumPoints; ++i) {
+    points.emplace_back(i / 100.0, i % 1000);
+  }
+  const RWRAddPointsInput input =
+      HelperCreateRWRAddPointsInput(kInputKey, points);
+  std::vector<RWRConfig> configs(20);
+  for (std::size_t i = 0; i < configs.size(); ++i) {
+    configs[i].add_input_metric_keys(kInputKey);
+    configs[i].set_output_metric_key(absl::StrCat("p", i));
+    configs[i].set_window_operation(RWRConfig::PERCENTILE);
+    configs[i].set_percentile_milli(99000);
+    configs[i].set_window_size(i + 1);
+    configs[i].set_steps_per_window(4);
+    configs[i].set_zero_for_empty_window(false);
+  }
+  for (auto _ : state) {
+    auto rwr = RollingWindowReducer::NewMerged(configs);
+    CHECK(rwr.ok());
+    rwr.value()->SetMaxThreads(state.range(0));
+    CHECK(rwr.value()->AddPoints(input).ok());
+    RWRCompleteOutput output;
+    CHECK(rwr.value()->Complete(&output).ok());
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumPoints);
+}
+BENCHMARK(BM_ParallelSubreducers)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
+
 }  // namespace
+
+// Tests of reading several files at once, which Reduce() doesn't do.
+class ReduceFilesTest : public ::testing::Test {
+ protected:
+  // Writes file_count files of points_per_file points each, with increasing
+  // input values across files, and returns their paths.
+  std::vector<std::string> WriteFiles(int file_count, int points_per_file) {
+    std::vector<std::string> paths;
+    for (int file = 0; file < file_count; ++file) {
+      std::vector<std::pair<double, double>> points;
+      for (int i = 0; i < points_per_file; ++i) {
+        const int index = file * points_per_file + i;
+        points.emplace_back(index * 0.001, index % 11);
+      }
+      paths.push_back(absl::StrCat("file", file));
+      WriteFile(paths.back(), HelperCreateRWRAddPointsInput(kInputKey, points),
+                &file_io_);
+    }
+    return paths;
+  }
+
+  StatusOr<google::protobuf::RepeatedPtrField<SamplePoint>> ReduceFiles(
+      const std::vector<std::string>& paths,
+      const RollingWindowReducer::FinalizedWindowCallback& streaming_callback,
+      int max_threads) {
+    std::vector<absl::string_view> path_views(paths.begin(), paths.end());
+    return RollingWindowReducer::ReduceImpl(
+        absl::MakeSpan(path_views), StreamingTestConfigs(), &file_io_,
+        streaming_callback, max_threads);
+  }
+
+  mako::memory_fileio::FileIO file_io_;
+};
+
+TEST_F(ReduceFilesTest, ParallelMatchesSerial) {
+  // More files than threads, each of several batches, so that readers wait for
+  // their batches to be added.
+  const std::vector<std::string> paths = WriteFiles(3, 210000);
+  auto serial = ReduceFiles(paths, nullptr, 1);
+  ASSERT_OK(serial);
+  ASSERT_GT(serial.value().size(), 0);
+  auto parallel = ReduceFiles(paths, nullptr, 2);
+  ASSERT_OK(parallel);
+  EXPECT_THAT(parallel.value(),
+              ::testing::Pointwise(EqualsProto(), serial.value()));
+}
+
+TEST_F(ReduceFilesTest, ReadErrorIsReturned) {
+  std::vector<std::string> paths = WriteFiles(4, 1000);
+  paths.insert(paths.begin() + 1, "missing_file");
+  for (int max_threads : {1, 2}) {
+    SCOPED_TRACE(max_threads);
+    auto output = ReduceFiles(paths, nullptr, max_threads);
+    EXPECT_THAT(output,
+                StatusIs(StatusCode::kUnknown, HasSubstr("opening file")));
+  }
+}
+
+TEST_F(ReduceFilesTest, AddErrorStopsReaders) {
+  // Streaming needs the files in order of input value, so adding the points of
+  // the second file fails while the others are being read.
+  std::vector<std::string> paths = WriteFiles(3, 210000);
+  std::swap(paths[0], paths[1]);
+  int finalized = 0;
+  auto output = ReduceFiles(
+      paths,
+      [&finalized](const SamplePoint&) {
+        ++finalized;
+        return OkStatus();
+      },
+      2);
+  EXPECT_THAT(output, StatusIs(StatusCode::kFailedPrecondition,
+                               HasSubstr("finalized")));
+  EXPECT_GT(finalized, 0);
+}
+
 }  // namespace helpers
 }  // namespace mako
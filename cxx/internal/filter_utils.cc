@@ -19,6 +19,7 @@
 #include "src/google/protobuf/repeated_field.h"
 #include "spec/proto/mako.pb.h"
 #include "absl/strings/str_cat.h"
+#include "cxx/internal/ignore_range_index.h"
 
 namespace mako {
 namespace internal {
@@ -117,10 +118,13 @@ FilterError FindValueKeyFromDataFilter(const BenchmarkInfo& benchmark_info,
                    " with label: ", data_filter.label()));
 }
 
-FilterError ProcessSamplePoint(
-    const SamplePoint& sample_point, const std::string& value_key,
-    const google::protobuf::RepeatedPtrField<LabeledRange>& ignore_ranges,
-    std::vector<DataPoint>* results) {
+// missing_range is the first of the run's ignore ranges without a range, or
+// nullptr if they all have one.
+FilterError ProcessSamplePoint(const SamplePoint& sample_point,
+                               const std::string& value_key,
+                               const LabeledRange* missing_range,
+                               IgnoreRangeIndex::Cursor* ignore_cursor,
+                               std::vector<DataPoint>* results) {
   for (const auto& keyed_value : sample_point.metric_value_list()) {
     if (!keyed_value.has_value() || !keyed_value.has_value_key()) {
       return FilterError::Error(
@@ -129,22 +133,18 @@ FilterError ProcessSamplePoint(
     }
 
     if (keyed_value.value_key() == value_key) {
+      if (missing_range != nullptr) {
+        return FilterError::Error(absl::StrCat("IgnoreRange with label ",
+                                               missing_range->label(),
+                                               " missing range."));
+      }
       // Check if sample_point was taken inside an ignore region.
-      for (const LabeledRange& ignore_range : ignore_ranges) {
-        if (!ignore_range.has_range()) {
-          return FilterError::Error(absl::StrCat("IgnoreRange with label ",
-                                                 ignore_range.label(),
-                                                 " missing range."));
-        }
-        const Range& range = ignore_range.range();
-        if (sample_point.input_value() >= range.start() &&
-            sample_point.input_value() <= range.end()) {
-          // We don't need to check any more points inside this sample point
-          // because the entire point is at the same InputValue().
-          // Performing this check here to avoid iterating through
-          // ignoreRegions for SampleBatches which don't contain metricKey.
-          return FilterError::NoError();
-        }
+      if (ignore_cursor->Contains(sample_point.input_value())) {
+        // We don't need to check any more points inside this sample point
+        // because the entire point is at the same InputValue().
+        // Performing this check here to avoid looking up ignore regions for
+        // SampleBatches which don't contain metricKey.
+        return FilterError::NoError();
       }
       results->push_back(DataPoint(/*x=*/sample_point.input_value(),
                                    /*y=*/keyed_value.value()));
@@ -158,6 +158,17 @@ FilterError FilterSamplePoints(
     const std::string& value_key,
     const google::protobuf::RepeatedPtrField<LabeledRange>& ignore_ranges, bool sort_data,
     std::vector<DataPoint>* results) {
+  const LabeledRange* missing_range = nullptr;
+  for (const LabeledRange& ignore_range : ignore_ranges) {
+    if (!ignore_range.has_range()) {
+      missing_range = &ignore_range;
+      break;
+    }
+  }
+  const IgnoreRangeIndex ignore_index(ignore_ranges);
+  // Sample points are usually in order of input value within each batch.
+  IgnoreRangeIndex::Cursor ignore_cursor = ignore_index.cursor();
+
   for (const auto sample_batch : sample_batches) {
     if (sample_batch == nullptr) {
       return FilterError::Error("nullptr SampleBatch found.");
@@ -167,8 +178,8 @@ FilterError FilterSamplePoints(
       if (!sample_point.has_input_value()) {
         return FilterError::Error("SamplePoint missing input value.");
       }
-      FilterError error =
-          ProcessSamplePoint(sample_point, value_key, ignore_ranges, results);
+      FilterError error = ProcessSamplePoint(
+          sample_point, value_key, missing_range, &ignore_cursor, results);
       if (error.error()) {
         return error;
       }
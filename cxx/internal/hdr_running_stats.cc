@@ -0,0 +1,343 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/hdr_running_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace mako {
+namespace internal {
+namespace {
+
+using Error = RunningStats::Error;
+
+// Values are rounded to multiples of lowest_discernible_value, which must be
+// exact in a double.
+constexpr double kMaxUnits = 9007199254740992.0;  // 2^53
+
+// Returns the number of bits needed to represent x.
+int BitWidth(uint64_t x) {
+  return x == 0 ? 0 : 64 - __builtin_clzll(x);
+}
+
+}  // namespace
+
+std::string HdrRunningStats::ValidateConfig(const Config& config) {
+  std::stringstream ss;
+  if (!(config.lowest_discernible_value > 0)) {
+    ss << "lowest_discernible_value must be positive, got "
+       << config.lowest_discernible_value;
+  } else if (!(config.highest_trackable_value >=
+               2 * config.lowest_discernible_value)) {
+    ss << "highest_trackable_value must be at least twice "
+       << "lowest_discernible_value, got " << config.highest_trackable_value;
+  } else if (!(config.highest_trackable_value /
+                   config.lowest_discernible_value <
+               kMaxUnits)) {
+    ss << "highest_trackable_value must be less than 2^53 times "
+       << "lowest_discernible_value, got " << config.highest_trackable_value;
+  } else if (config.significant_digits < 1 || config.significant_digits > 5) {
+    ss << "significant_digits must be in range [1, 5], got "
+       << config.significant_digits;
+  }
+  return ss.str();
+}
+
+HdrRunningStats::HdrRunningStats(const Config& config)
+    : config_(config),
+      n_(0),
+      min_(0.0),
+      max_(0.0),
+      sum_(0.0),
+      mean_(0.0),
+      m2_(0.0) {
+  // Enough buckets per magnitude that each is narrower than
+  // 10^-significant_digits of its values.
+  int64_t min_buckets = 2;
+  for (int i = 0; i < config.significant_digits; ++i) {
+    min_buckets *= 10;
+  }
+  half_group_magnitude_ = BitWidth(min_buckets - 1) - 1;
+  half_group_size_ = int64_t{1} << half_group_magnitude_;
+  highest_unit_ = static_cast<int64_t>(
+      std::ceil(config.highest_trackable_value /
+                config.lowest_discernible_value));
+  counts_.resize(BucketIndex(config.highest_trackable_value) + 1);
+}
+
+int HdrRunningStats::BucketIndex(double x) const {
+  double units = x / config_.lowest_discernible_value;
+  uint64_t unit;
+  if (!(units > 0)) {
+    // Also catches NaN.
+    unit = 0;
+  } else if (units >= highest_unit_) {
+    unit = highest_unit_;
+  } else {
+    unit = std::llround(units);
+  }
+  // The first group holds 2 * half_group_size_ buckets of width 1; the group
+  // of magnitude m > 0 holds half_group_size_ buckets of width 1 << m.
+  const uint64_t group_mask = 2 * half_group_size_ - 1;
+  int magnitude = BitWidth(unit | group_mask) - (half_group_magnitude_ + 1);
+  int64_t sub_index = unit >> magnitude;
+  return ((magnitude + 1) << half_group_magnitude_) +
+         (sub_index - half_group_size_);
+}
+
+double HdrRunningStats::BucketValue(int index) const {
+  int magnitude = (index >> half_group_magnitude_) - 1;
+  int64_t sub_index = (index & (half_group_size_ - 1)) + half_group_size_;
+  if (magnitude < 0) {
+    sub_index -= half_group_size_;
+    magnitude = 0;
+  }
+  // The middle of the bucket, as HdrHistogram reports it.
+  int64_t unit = (sub_index << magnitude) + ((int64_t{1} << magnitude) >> 1);
+  double value = unit * config_.lowest_discernible_value;
+  // No value is reported beyond those seen.
+  return std::min(std::max(value, min_), max_);
+}
+
+void HdrRunningStats::Add(double x) {
+  ++counts_[BucketIndex(x)];
+  ++n_;
+  sum_ += x;
+  if (n_ == 1) {
+    min_ = max_ = mean_ = x;
+    m2_ = 0.0;
+  } else {
+    min_ = std::min(min_, x);
+    max_ = std::max(max_, x);
+    double delta = x - mean_;
+    mean_ += delta / static_cast<double>(n_);
+    m2_ += delta * (x - mean_);
+  }
+}
+
+void HdrRunningStats::AddVector(const std::vector<double>& values) {
+  for (double x : values) {
+    Add(x);
+  }
+}
+
+Error HdrRunningStats::Merge(const HdrRunningStats& other) {
+  // preconditions
+  if (config_.lowest_discernible_value !=
+          other.config_.lowest_discernible_value ||
+      config_.highest_trackable_value !=
+          other.config_.highest_trackable_value ||
+      config_.significant_digits != other.config_.significant_digits) {
+    return Error::kMergeDifferentConfigs;
+  }
+  if (other.n_ == 0) {
+    return Error::kOk;
+  }
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  if (n_ == 0) {
+    min_ = other.min_;
+    max_ = other.max_;
+  } else {
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+  // Chan et al.'s parallel variance algorithm.
+  double n_a = n_;
+  double n_b = other.n_;
+  double total = n_a + n_b;
+  double delta = other.mean_ - mean_;
+  mean_ += delta * n_b / total;
+  m2_ += other.m2_ + delta * delta * n_a * n_b / total;
+  sum_ += other.sum_;
+  n_ += other.n_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Count(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = n_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Sum(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = sum_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Min(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = min_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Max(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = max_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Mean(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = mean_;
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Median(double* value) const {
+  return Percentile(0.5, value);
+}
+
+Error HdrRunningStats::Variance(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  // For perf data, a single value has 0 variance
+  *value = n_ <= 1 ? 0.0 : m2_ / static_cast<double>(n_);
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Stddev(double* value) const {
+  Error error = Variance(value);
+  if (error == Error::kOk) {
+    *value = std::sqrt(*value);
+  }
+  return error;
+}
+
+Error HdrRunningStats::Mad(double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  *value = MadImpl(PercentileImpl(0.5));
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Percentile(double pct, double* value) const {
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  if (pct < 0.0 || pct > 1.0) {
+    return Error::kBadPercentile;
+  }
+  *value = PercentileImpl(pct);
+  return Error::kOk;
+}
+
+Error HdrRunningStats::Summarize(const std::vector<double>& pcts,
+                                 RunningStats::Summary* summary) const {
+  // preconditions
+  if (n_ <= 0) {
+    return Error::kNoData;
+  }
+  for (double pct : pcts) {
+    if (pct < 0.0 || pct > 1.0) {
+      return Error::kBadPercentile;
+    }
+  }
+  summary->median = PercentileImpl(0.5);
+  summary->mad = MadImpl(summary->median);
+  summary->percentiles.clear();
+  for (double pct : pcts) {
+    summary->percentiles.push_back(PercentileImpl(pct));
+  }
+  return Error::kOk;
+}
+
+double HdrRunningStats::ValueAtRank(int64_t rank) const {
+  const int last = BucketIndex(max_);
+  int64_t seen = 0;
+  for (int i = BucketIndex(min_); i < last; ++i) {
+    seen += counts_[i];
+    if (seen > rank) {
+      return BucketValue(i);
+    }
+  }
+  return BucketValue(last);
+}
+
+double HdrRunningStats::PercentileImpl(double pct) const {
+  // The extremes are known exactly.
+  if (pct == 0.0) {
+    return min_;
+  } else if (pct == 1.0) {
+    return max_;
+  }
+  double k = static_cast<double>(n_ - 1) * pct;
+  double f = std::floor(k);
+  double c = std::ceil(k);
+  if (f == c) {
+    return ValueAtRank(static_cast<int64_t>(f));
+  }
+  // interpolate
+  return ValueAtRank(static_cast<int64_t>(f)) * (c - k) +
+         ValueAtRank(static_cast<int64_t>(c)) * (k - f);
+}
+
+double HdrRunningStats::DistanceAtRank(double center, int64_t rank) const {
+  // Walk outward from center, taking whichever of the nearest nonempty buckets
+  // below and above is closer.
+  const int first = BucketIndex(min_);
+  const int last = BucketIndex(max_);
+  int above = BucketIndex(center);
+  if (BucketValue(above) <= center) {
+    ++above;
+  }
+  int below = above - 1;
+  int64_t seen = 0;
+  double distance = 0.0;
+  while (seen <= rank) {
+    while (below >= first && counts_[below] == 0) --below;
+    while (above <= last && counts_[above] == 0) ++above;
+    if (below < first && above > last) {
+      break;
+    }
+    if (above > last ||
+        (below >= first &&
+         center - BucketValue(below) <= BucketValue(above) - center)) {
+      distance = center - BucketValue(below);
+      seen += counts_[below--];
+    } else {
+      distance = BucketValue(above) - center;
+      seen += counts_[above++];
+    }
+  }
+  return distance;
+}
+
+double HdrRunningStats::MadImpl(double median) const {
+  double k = static_cast<double>(n_ - 1) * 0.5;
+  double f = std::floor(k);
+  double c = std::ceil(k);
+  if (f == c) {
+    return DistanceAtRank(median, static_cast<int64_t>(f));
+  }
+  return DistanceAtRank(median, static_cast<int64_t>(f)) * (c - k) +
+         DistanceAtRank(median, static_cast<int64_t>(c)) * (k - f);
+}
+
+}  // namespace internal
+}  // namespace mako
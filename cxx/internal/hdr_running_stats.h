@@ -0,0 +1,146 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+
+// Running stats kept in a log-linear bucketed histogram.
+#ifndef CXX_INTERNAL_HDR_RUNNING_STATS_H_
+#define CXX_INTERNAL_HDR_RUNNING_STATS_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cxx/internal/pgmath.h"
+
+namespace mako {
+namespace internal {
+
+// Efficiently maintains running stats for a numeric population with a known
+// range and precision, such as latencies.
+//
+// Values are counted in log-linear buckets, in the style of HdrHistogram
+// (http://hdrhistogram.org): each value is rounded to a multiple of
+// lowest_discernible_value, and every bucket is narrower than
+// 10^-significant_digits of the values in it. Percentiles, median, and MAD are
+// computed from the buckets, so they are within that relative precision (or
+// within lowest_discernible_value for values near 0). Count, sum, min, max,
+// mean, and variance are exact, as in RunningStats.
+//
+// Adding a value is O(1), memory use is fixed by the Config, and merging is
+// linear in the number of buckets. Values outside of
+// [0, highest_trackable_value] are counted in the first or last bucket; they
+// are still reported exactly by Min() and Max(), and no percentile is reported
+// beyond those.
+class HdrRunningStats {
+ public:
+  // Configuration for construction.
+  struct Config {
+    Config() : Config(1.0, 1e9, 3) {}
+    Config(double lowest, double highest, int digits)
+        : lowest_discernible_value(lowest),
+          highest_trackable_value(highest),
+          significant_digits(digits) {}
+
+    // The resolution of the histogram. Must be positive.
+    double lowest_discernible_value;
+
+    // The highest value counted in its own bucket. Must be at least twice
+    // lowest_discernible_value.
+    double highest_trackable_value;
+
+    // The number of significant decimal digits kept for each value. Must be in
+    // range [1, 5].
+    int significant_digits;
+  };
+
+  // Returns an error message if config is not valid, otherwise "".
+  static std::string ValidateConfig(const Config& config);
+
+  // The config must be valid.
+  explicit HdrRunningStats(const Config& config);
+
+  // Adds a value.
+  void Add(double x);
+
+  // Adds many values.
+  void AddVector(const std::vector<double>& values);
+
+  // Adds all values that were added to other, which must have the same config.
+  RunningStats::Error Merge(const HdrRunningStats& other);
+
+  // Each of these stores its value in *value and returns
+  // RunningStats::Error::kOk, or returns the error and leaves *value unchanged,
+  // like the corresponding RunningStats methods.
+  RunningStats::Error Count(double* value) const;
+  RunningStats::Error Sum(double* value) const;
+  RunningStats::Error Min(double* value) const;
+  RunningStats::Error Max(double* value) const;
+  RunningStats::Error Mean(double* value) const;
+  RunningStats::Error Median(double* value) const;
+  RunningStats::Error Variance(double* value) const;
+  RunningStats::Error Stddev(double* value) const;
+  RunningStats::Error Mad(double* value) const;
+  RunningStats::Error Percentile(double pct, double* value) const;
+  RunningStats::Error Summarize(const std::vector<double>& pcts,
+                                RunningStats::Summary* summary) const;
+
+  const Config& config() const { return config_; }
+
+  // Returns the number of buckets, which fixes the memory used.
+  std::size_t bucket_count() const { return counts_.size(); }
+
+ private:
+  // Returns the index of the bucket counting x.
+  int BucketIndex(double x) const;
+  // Returns the value reported for the values in a bucket.
+  double BucketValue(int index) const;
+  // Returns the value at the given rank (0-based, in ascending order), as
+  // represented by its bucket.
+  double ValueAtRank(int64_t rank) const;
+  // Returns the given percentile, interpolating between ranks as RunningStats
+  // does.
+  double PercentileImpl(double pct) const;
+  // Returns the distance from center at the given rank (0-based, in ascending
+  // order of distance), treating each value as its bucket's value.
+  double DistanceAtRank(double center, int64_t rank) const;
+  double MadImpl(double median) const;
+
+  Config config_;
+  // Each bucket spans 1 << bucket_magnitude multiples of
+  // lowest_discernible_value. Buckets are grouped by magnitude, with
+  // half_group_size_ buckets per magnitude except for 2 * half_group_size_ at
+  // magnitude 0.
+  int half_group_magnitude_;
+  int64_t half_group_size_;
+  // The highest multiple of lowest_discernible_value that is tracked.
+  int64_t highest_unit_;
+  // Count of values in each bucket.
+  std::vector<int64_t> counts_;
+
+  // Count of values added
+  int64_t n_;
+  // Exact min seen so far
+  double min_;
+  // Exact max seen so far
+  double max_;
+  // Exact sum so far
+  double sum_;
+  // Running mean and sum of squared differences from it (Welford)
+  double mean_;
+  double m2_;
+};
+
+}  // namespace internal
+}  // namespace mako
+
+#endif  // CXX_INTERNAL_HDR_RUNNING_STATS_H_
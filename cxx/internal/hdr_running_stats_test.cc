@@ -0,0 +1,217 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/hdr_running_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "glog/logging.h"
+#include "benchmark/benchmark.h"
+#include "gtest/gtest.h"
+#include "cxx/internal/pgmath.h"
+
+namespace mako {
+namespace internal {
+namespace {
+
+using Error = RunningStats::Error;
+
+// Log-normally distributed values, like latencies.
+std::vector<double> Latencies(int n) {
+  std::mt19937 gen(1234);
+  std::lognormal_distribution<double> dist(5, 1.5);
+  std::vector<double> values(n);
+  for (double& x : values) x = dist(gen);
+  return values;
+}
+
+TEST(HdrRunningStatsTest, ValidateConfig) {
+  ASSERT_EQ("", HdrRunningStats::ValidateConfig(HdrRunningStats::Config()));
+  ASSERT_NE("", HdrRunningStats::ValidateConfig({0, 100, 3}));
+  ASSERT_NE("", HdrRunningStats::ValidateConfig({1, 1, 3}));
+  ASSERT_NE("", HdrRunningStats::ValidateConfig({1e-9, 1e9, 3}));
+  ASSERT_NE("", HdrRunningStats::ValidateConfig({1, 100, 0}));
+  ASSERT_NE("", HdrRunningStats::ValidateConfig({1, 100, 6}));
+}
+
+TEST(HdrRunningStatsTest, EmptyHasNoData) {
+  HdrRunningStats stats(HdrRunningStats::Config{});
+  double value = -1;
+  ASSERT_EQ(Error::kNoData, stats.Count(&value));
+  ASSERT_EQ(Error::kNoData, stats.Mean(&value));
+  ASSERT_EQ(Error::kNoData, stats.Median(&value));
+  ASSERT_EQ(Error::kNoData, stats.Mad(&value));
+  RunningStats::Summary summary;
+  ASSERT_EQ(Error::kNoData, stats.Summarize({0.5}, &summary));
+  ASSERT_EQ(-1, value);
+
+  stats.Add(1);
+  ASSERT_EQ(Error::kBadPercentile, stats.Percentile(1.5, &value));
+  ASSERT_EQ(Error::kBadPercentile, stats.Summarize({0.5, -1}, &summary));
+}
+
+TEST(HdrRunningStatsTest, ExactForSmallIntegers) {
+  // Integers below 2 * 10^significant_digits each have their own bucket, so
+  // everything matches RunningStats.
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 1999);
+  std::vector<double> values(1001);
+  for (double& x : values) x = dist(gen);
+  RunningStats want;
+  want.AddVector(values);
+  HdrRunningStats got(HdrRunningStats::Config(1, 1e6, 3));
+  got.AddVector(values);
+
+  double want_value, got_value;
+  ASSERT_EQ(Error::kOk, want.Mean(&want_value));
+  ASSERT_EQ(Error::kOk, got.Mean(&got_value));
+  ASSERT_NEAR(want_value, got_value, 1e-9 * want_value);
+  ASSERT_EQ(Error::kOk, want.Stddev(&want_value));
+  ASSERT_EQ(Error::kOk, got.Stddev(&got_value));
+  ASSERT_NEAR(want_value, got_value, 1e-9 * want_value);
+  ASSERT_EQ(Error::kOk, want.Mad(&want_value));
+  ASSERT_EQ(Error::kOk, got.Mad(&got_value));
+  ASSERT_EQ(want_value, got_value);
+  for (double pct : {0.0, 0.001, 0.25, 0.5, 0.75, 0.999, 1.0}) {
+    ASSERT_EQ(Error::kOk, want.Percentile(pct, &want_value));
+    ASSERT_EQ(Error::kOk, got.Percentile(pct, &got_value));
+    ASSERT_EQ(want_value, got_value) << "pct " << pct;
+  }
+}
+
+TEST(HdrRunningStatsTest, PercentilesWithinPrecision) {
+  std::vector<double> values = Latencies(100000);
+  for (int digits : {1, 2, 3}) {
+    RunningStats want;
+    want.AddVector(values);
+    HdrRunningStats::Config config(0.01, 1e7, digits);
+    HdrRunningStats got(config);
+    got.AddVector(values);
+    // Relative precision, or absolute precision near 0.
+    const double tolerance = std::pow(10, -digits);
+    auto within = [&](double value) {
+      return std::max(tolerance * value, config.lowest_discernible_value);
+    };
+
+    double want_value, got_value;
+    ASSERT_EQ(Error::kOk, want.Min(&want_value));
+    ASSERT_EQ(Error::kOk, got.Min(&got_value));
+    ASSERT_EQ(want_value, got_value);
+    ASSERT_EQ(Error::kOk, want.Max(&want_value));
+    ASSERT_EQ(Error::kOk, got.Max(&got_value));
+    ASSERT_EQ(want_value, got_value);
+    ASSERT_EQ(Error::kOk, want.Mean(&want_value));
+    ASSERT_EQ(Error::kOk, got.Mean(&got_value));
+    ASSERT_NEAR(want_value, got_value, 1e-9 * want_value);
+    ASSERT_EQ(Error::kOk, want.Mad(&want_value));
+    ASSERT_EQ(Error::kOk, got.Mad(&got_value));
+    ASSERT_NEAR(want_value, got_value, 2 * within(want_value))
+        << "digits " << digits;
+
+    const std::vector<double> pcts = {0.01, 0.1, 0.5, 0.9, 0.99, 0.999};
+    RunningStats::Summary summary;
+    ASSERT_EQ(Error::kOk, got.Summarize(pcts, &summary));
+    ASSERT_EQ(Error::kOk, got.Median(&got_value));
+    ASSERT_EQ(got_value, summary.median);
+    for (int i = 0; i < pcts.size(); ++i) {
+      ASSERT_EQ(Error::kOk, want.Percentile(pcts[i], &want_value));
+      ASSERT_NEAR(want_value, summary.percentiles[i], within(want_value))
+          << "digits " << digits << " pct " << pcts[i];
+    }
+  }
+}
+
+TEST(HdrRunningStatsTest, OutOfRangeValues) {
+  HdrRunningStats stats(HdrRunningStats::Config(1, 100, 2));
+  const std::size_t buckets = stats.bucket_count();
+  stats.AddVector({-50, 10, 20, 1e6});
+  ASSERT_EQ(buckets, stats.bucket_count());
+  double value;
+  ASSERT_EQ(Error::kOk, stats.Min(&value));
+  ASSERT_EQ(-50, value);
+  ASSERT_EQ(Error::kOk, stats.Max(&value));
+  ASSERT_EQ(1e6, value);
+  // Out of range values are counted at the ends of the range.
+  ASSERT_EQ(Error::kOk, stats.Percentile(1.0 / 3, &value));
+  ASSERT_EQ(10, value);
+  ASSERT_EQ(Error::kOk, stats.Percentile(0.01, &value));
+  ASSERT_GE(value, -50);
+  ASSERT_LE(value, 10);
+}
+
+TEST(HdrRunningStatsTest, Merge) {
+  std::vector<double> values = Latencies(10000);
+  HdrRunningStats::Config config(0.1, 1e6, 3);
+  HdrRunningStats want(config);
+  want.AddVector(values);
+
+  HdrRunningStats got(config);
+  HdrRunningStats empty(config);
+  ASSERT_EQ(Error::kOk, got.Merge(empty));
+  HdrRunningStats part(config);
+  part.AddVector({values.begin(), values.begin() + 3000});
+  ASSERT_EQ(Error::kOk, got.Merge(part));
+  HdrRunningStats rest(config);
+  rest.AddVector({values.begin() + 3000, values.end()});
+  ASSERT_EQ(Error::kOk, got.Merge(rest));
+
+  double want_value, got_value;
+  ASSERT_EQ(Error::kOk, want.Count(&want_value));
+  ASSERT_EQ(Error::kOk, got.Count(&got_value));
+  ASSERT_EQ(want_value, got_value);
+  ASSERT_EQ(Error::kOk, want.Stddev(&want_value));
+  ASSERT_EQ(Error::kOk, got.Stddev(&got_value));
+  ASSERT_NEAR(want_value, got_value, 1e-9 * want_value);
+  ASSERT_EQ(Error::kOk, want.Mad(&want_value));
+  ASSERT_EQ(Error::kOk, got.Mad(&got_value));
+  ASSERT_EQ(want_value, got_value);
+  for (double pct : {0.0, 0.1, 0.5, 0.99, 1.0}) {
+    ASSERT_EQ(Error::kOk, want.Percentile(pct, &want_value));
+    ASSERT_EQ(Error::kOk, got.Percentile(pct, &got_value));
+    ASSERT_EQ(want_value, got_value);
+  }
+
+  HdrRunningStats other(HdrRunningStats::Config(1, 1e6, 3));
+  ASSERT_EQ(Error::kMergeDifferentConfigs, got.Merge(other));
+}
+
+}  // namespace
+
+static void BM_HdrAdd(benchmark::State& state) {
+  HdrRunningStats stats(HdrRunningStats::Config(0.01, 1e7, 3));
+  std::vector<double> vals = Latencies(1 << 16);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    stats.Add(vals[i++ & 0xFFFF]);
+  }
+}
+BENCHMARK(BM_HdrAdd);
+
+// Compare with BM_Summarize in pgmath_test.
+static void BM_HdrSummarize(benchmark::State& state) {
+  const std::vector<double> pcts = {0.001, 0.01, 0.05, 0.1,
+                                    0.9,   0.95, 0.99, 0.999};
+  HdrRunningStats stats(HdrRunningStats::Config(0.01, 1e7, 3));
+  stats.AddVector(Latencies(state.range(0)));
+  RunningStats::Summary summary;
+  for (auto _ : state) {
+    CHECK(stats.Summarize(pcts, &summary) == Error::kOk);
+  }
+}
+BENCHMARK(BM_HdrSummarize)->Range(1, 1<<20);
+
+}  // namespace internal
+}  // namespace mako
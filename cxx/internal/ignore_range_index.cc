@@ -0,0 +1,85 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/ignore_range_index.h"
+
+#include <algorithm>
+
+namespace mako {
+namespace internal {
+
+IgnoreRangeIndex::IgnoreRangeIndex(
+    const google::protobuf::RepeatedPtrField<mako::LabeledRange>&
+        ignore_ranges) {
+  std::vector<Range> ranges;
+  ranges.reserve(ignore_ranges.size());
+  for (const mako::LabeledRange& labeled_range : ignore_ranges) {
+    if (!labeled_range.has_range()) {
+      continue;
+    }
+    const mako::Range& range = labeled_range.range();
+    // Also skips ranges with a NaN bound.
+    if (range.start() <= range.end()) {
+      ranges.push_back({range.start(), range.end()});
+    }
+  }
+  std::sort(ranges.begin(), ranges.end(),
+            [](const Range& a, const Range& b) { return a.start < b.start; });
+
+  // Merge overlapping (or touching) ranges, so that the ends are sorted too.
+  for (const Range& range : ranges) {
+    if (!ranges_.empty() && range.start <= ranges_.back().end) {
+      ranges_.back().end = std::max(ranges_.back().end, range.end);
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+bool IgnoreRangeIndex::Contains(double x) const {
+  std::size_t i = FirstEndingAtOrAfter(x, 0, ranges_.size());
+  return i < ranges_.size() && ranges_[i].start <= x;
+}
+
+std::size_t IgnoreRangeIndex::FirstEndingAtOrAfter(double x,
+                                                   std::size_t begin,
+                                                   std::size_t end) const {
+  return std::lower_bound(
+             ranges_.begin() + begin, ranges_.begin() + end, x,
+             [](const Range& range, double x) { return range.end < x; }) -
+         ranges_.begin();
+}
+
+bool IgnoreRangeIndex::Cursor::Contains(double x) {
+  const std::vector<Range>& ranges = index_->ranges_;
+  if (next_ > 0 && !(ranges[next_ - 1].end < x)) {
+    // x is before the previous value; start over.
+    next_ = index_->FirstEndingAtOrAfter(x, 0, ranges.size());
+  } else if (next_ < ranges.size() && ranges[next_].end < x) {
+    // Gallop forward to bound the ranges that end before x, then search only
+    // between the bounds. The ranges before low end before x, and the one at
+    // low + step, if any, does not.
+    std::size_t step = 1;
+    std::size_t low = next_ + 1;
+    while (low + step < ranges.size() && ranges[low + step].end < x) {
+      low += step;
+      step *= 2;
+    }
+    next_ = index_->FirstEndingAtOrAfter(
+        x, low, std::min(low + step + 1, ranges.size()));
+  }
+  return next_ < ranges.size() && ranges[next_].start <= x;
+}
+
+}  // namespace internal
+}  // namespace mako
@@ -0,0 +1,88 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+
+// Answers whether an input value falls in a run's ignore ranges.
+#ifndef CXX_INTERNAL_IGNORE_RANGE_INDEX_H_
+#define CXX_INTERNAL_IGNORE_RANGE_INDEX_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "src/google/protobuf/repeated_field.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+
+// The union of a set of closed ranges [start, end], kept as a sorted vector of
+// disjoint ranges. Looking up a value is O(log n) in the number of ranges, and
+// a Cursor makes lookups of nondecreasing values O(1) amortized.
+//
+// Immutable once constructed, so it may be shared by threads each using their
+// own Cursor.
+class IgnoreRangeIndex {
+ public:
+  // An index with no ranges, which contains no values.
+  IgnoreRangeIndex() {}
+
+  // Indexes the ranges of ignore_ranges, which may overlap and be in any order.
+  // Entries without a range, and ranges with start > end, are skipped.
+  explicit IgnoreRangeIndex(
+      const google::protobuf::RepeatedPtrField<mako::LabeledRange>&
+          ignore_ranges);
+
+  // Returns whether x is in any range.
+  bool Contains(double x) const;
+
+  // Returns the number of disjoint ranges left after merging.
+  std::size_t size() const { return ranges_.size(); }
+
+  // Looks up values in an index, remembering where the last value was found.
+  class Cursor {
+   public:
+    explicit Cursor(const IgnoreRangeIndex* index) : index_(index), next_(0) {}
+
+    // Returns whether x is in any range of the index. Each call is O(log d),
+    // where d is the number of ranges between x and the previous x, so a scan
+    // of values in nondecreasing order is O(1) amortized per value. Values may
+    // come in any order.
+    bool Contains(double x);
+
+   private:
+    const IgnoreRangeIndex* index_;
+    // The first range that ends at or after the previous value.
+    std::size_t next_;
+  };
+
+  Cursor cursor() const { return Cursor(this); }
+
+ private:
+  struct Range {
+    double start;
+    double end;
+  };
+
+  // Returns the first range in [begin, end) that ends at or after x, or end if
+  // there is none.
+  std::size_t FirstEndingAtOrAfter(double x, std::size_t begin,
+                                   std::size_t end) const;
+
+  // Sorted by start, and disjoint.
+  std::vector<Range> ranges_;
+};
+
+}  // namespace internal
+}  // namespace mako
+
+#endif  // CXX_INTERNAL_IGNORE_RANGE_INDEX_H_
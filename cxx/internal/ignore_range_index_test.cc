@@ -0,0 +1,183 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/ignore_range_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "gtest/gtest.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+namespace {
+
+using RangeList = google::protobuf::RepeatedPtrField<mako::LabeledRange>;
+
+void AddRange(double start, double end, RangeList* ranges) {
+  mako::LabeledRange* range = ranges->Add();
+  range->set_label("range");
+  range->mutable_range()->set_start(start);
+  range->mutable_range()->set_end(end);
+}
+
+// The linear scan that IgnoreRangeIndex replaces.
+bool LinearContains(const RangeList& ranges, double x) {
+  for (const mako::LabeledRange& range : ranges) {
+    if (range.has_range() && range.range().start() <= x &&
+        x <= range.range().end()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Up to n ranges of assorted widths in [0, 1000], in no particular order.
+RangeList RandomRanges(int n, std::mt19937* gen) {
+  std::uniform_real_distribution<double> start(0, 1000);
+  std::exponential_distribution<double> width(0.2);
+  RangeList ranges;
+  for (int i = 0; i < n; ++i) {
+    double s = start(*gen);
+    AddRange(s, s + width(*gen), &ranges);
+  }
+  return ranges;
+}
+
+TEST(IgnoreRangeIndexTest, Empty) {
+  IgnoreRangeIndex index;
+  ASSERT_EQ(0, index.size());
+  ASSERT_FALSE(index.Contains(0));
+  IgnoreRangeIndex::Cursor cursor = index.cursor();
+  ASSERT_FALSE(cursor.Contains(0));
+}
+
+TEST(IgnoreRangeIndexTest, MergesRanges) {
+  RangeList ranges;
+  AddRange(10, 20, &ranges);
+  AddRange(0, 5, &ranges);
+  AddRange(15, 30, &ranges);
+  AddRange(30, 40, &ranges);
+  AddRange(12, 13, &ranges);
+  AddRange(50, 50, &ranges);
+  IgnoreRangeIndex index(ranges);
+  ASSERT_EQ(3, index.size());
+
+  for (double x : {0.0, 5.0, 10.0, 12.5, 20.0, 25.0, 30.0, 40.0, 50.0}) {
+    ASSERT_TRUE(index.Contains(x)) << x;
+  }
+  for (double x : {-1.0, 5.5, 9.99, 40.01, 49.0, 50.5}) {
+    ASSERT_FALSE(index.Contains(x)) << x;
+  }
+}
+
+TEST(IgnoreRangeIndexTest, SkipsInvalidRanges) {
+  RangeList ranges;
+  ranges.Add()->set_label("no range");
+  AddRange(10, 5, &ranges);
+  AddRange(std::nan(""), 5, &ranges);
+  IgnoreRangeIndex index(ranges);
+  ASSERT_EQ(0, index.size());
+  ASSERT_FALSE(index.Contains(0));
+  ASSERT_FALSE(index.Contains(7));
+}
+
+TEST(IgnoreRangeIndexTest, NaNIsNotContained) {
+  RangeList ranges;
+  AddRange(-std::numeric_limits<double>::infinity(),
+           std::numeric_limits<double>::infinity(), &ranges);
+  IgnoreRangeIndex index(ranges);
+  ASSERT_TRUE(index.Contains(1e300));
+  ASSERT_FALSE(index.Contains(std::nan("")));
+  IgnoreRangeIndex::Cursor cursor = index.cursor();
+  ASSERT_TRUE(cursor.Contains(0));
+  ASSERT_FALSE(cursor.Contains(std::nan("")));
+  ASSERT_TRUE(cursor.Contains(0));
+}
+
+TEST(IgnoreRangeIndexTest, MatchesLinearScan) {
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> dist(-10, 1010);
+  for (int n : {1, 2, 10, 100, 1000}) {
+    RangeList ranges = RandomRanges(n, &gen);
+    IgnoreRangeIndex index(ranges);
+    std::vector<double> xs(5000);
+    for (double& x : xs) x = dist(gen);
+    // Also hit the bounds exactly.
+    for (const mako::LabeledRange& range : ranges) {
+      xs.push_back(range.range().start());
+      xs.push_back(range.range().end());
+    }
+
+    // Any order, then sorted order, through the same cursor.
+    IgnoreRangeIndex::Cursor cursor = index.cursor();
+    for (double x : xs) {
+      ASSERT_EQ(LinearContains(ranges, x), index.Contains(x)) << x;
+      ASSERT_EQ(LinearContains(ranges, x), cursor.Contains(x)) << x;
+    }
+    std::sort(xs.begin(), xs.end());
+    for (double x : xs) {
+      ASSERT_EQ(LinearContains(ranges, x), cursor.Contains(x)) << x;
+    }
+    // A sparse sorted scan, so that each value skips many ranges.
+    IgnoreRangeIndex::Cursor sparse_cursor = index.cursor();
+    for (std::size_t i = 0; i < xs.size(); i += 97) {
+      ASSERT_EQ(LinearContains(ranges, xs[i]), sparse_cursor.Contains(xs[i]))
+          << xs[i];
+    }
+  }
+}
+
+}  // namespace
+
+static void BM_IgnoreRangeLinearScan(benchmark::State& state) {
+  std::mt19937 gen(42);
+  RangeList ranges = RandomRanges(state.range(0), &gen);
+  double x = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(LinearContains(ranges, x));
+    x = x >= 1000 ? 0 : x + 0.01;
+  }
+}
+BENCHMARK(BM_IgnoreRangeLinearScan)->Range(1, 1 << 12);
+
+static void BM_IgnoreRangeContains(benchmark::State& state) {
+  std::mt19937 gen(42);
+  IgnoreRangeIndex index(RandomRanges(state.range(0), &gen));
+  double x = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(index.Contains(x));
+    x = x >= 1000 ? 0 : x + 0.01;
+  }
+}
+BENCHMARK(BM_IgnoreRangeContains)->Range(1, 1 << 12);
+
+static void BM_IgnoreRangeCursor(benchmark::State& state) {
+  std::mt19937 gen(42);
+  IgnoreRangeIndex index(RandomRanges(state.range(0), &gen));
+  IgnoreRangeIndex::Cursor cursor = index.cursor();
+  double x = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cursor.Contains(x));
+    x = x >= 1000 ? 0 : x + 0.01;
+  }
+}
+BENCHMARK(BM_IgnoreRangeCursor)->Range(1, 1 << 12);
+
+}  // namespace internal
+}  // namespace mako
@@ -0,0 +1,45 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/metric_key_dictionary.h"
+
+namespace mako {
+namespace internal {
+
+constexpr int MetricKeyDictionary::kNotFound;
+
+MetricKeyDictionary::MetricKeyDictionary(
+    const mako::BenchmarkInfo& benchmark_info) {
+  for (const mako::ValueInfo& info : benchmark_info.metric_info_list()) {
+    Intern(info.value_key());
+  }
+}
+
+int MetricKeyDictionary::Intern(absl::string_view key) {
+  auto it = ids_.find(key);
+  if (it != ids_.end()) {
+    return it->second;
+  }
+  int id = keys_.size();
+  keys_.emplace_back(key);
+  ids_.emplace(keys_.back(), id);
+  return id;
+}
+
+int MetricKeyDictionary::Find(absl::string_view key) const {
+  auto it = ids_.find(key);
+  return it == ids_.end() ? kNotFound : it->second;
+}
+
+}  // namespace internal
+}  // namespace mako
@@ -0,0 +1,67 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+
+// Assigns dense integer ids to metric value_keys.
+#ifndef CXX_INTERNAL_METRIC_KEY_DICTIONARY_H_
+#define CXX_INTERNAL_METRIC_KEY_DICTIONARY_H_
+
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+
+// Interns metric value_keys as ids 0, 1, 2, ..., in the order they are first
+// seen, so that per-metric state can be kept in vectors indexed by id rather
+// than in maps keyed by string. Each key is then hashed once per lookup, and
+// never compared against other keys.
+//
+// Not thread-safe. Dictionaries seeded from the same BenchmarkInfo assign the
+// same ids to its metrics, so each thread can keep its own.
+class MetricKeyDictionary {
+ public:
+  // Returned by Find() for a key that has no id.
+  static constexpr int kNotFound = -1;
+
+  MetricKeyDictionary() {}
+
+  // Assigns the first ids to the metrics of benchmark_info.metric_info_list,
+  // in order.
+  explicit MetricKeyDictionary(const mako::BenchmarkInfo& benchmark_info);
+
+  // Returns the id of key, assigning the next id if it has none.
+  int Intern(absl::string_view key);
+
+  // Returns the id of key, or kNotFound if it has none.
+  int Find(absl::string_view key) const;
+
+  // Returns the key with the given id, which must have been assigned.
+  const std::string& key(int id) const { return keys_[id]; }
+
+  // Returns the number of ids assigned; every id is less than this.
+  int size() const { return keys_.size(); }
+
+ private:
+  absl::flat_hash_map<std::string, int> ids_;
+  std::vector<std::string> keys_;
+};
+
+}  // namespace internal
+}  // namespace mako
+
+#endif  // CXX_INTERNAL_METRIC_KEY_DICTIONARY_H_
@@ -0,0 +1,57 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/metric_key_dictionary.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+namespace {
+
+TEST(MetricKeyDictionaryTest, InternAssignsDenseIds) {
+  MetricKeyDictionary keys;
+  EXPECT_EQ(0, keys.size());
+  EXPECT_EQ(MetricKeyDictionary::kNotFound, keys.Find("a"));
+  EXPECT_EQ(0, keys.Intern("a"));
+  EXPECT_EQ(1, keys.Intern("b"));
+  EXPECT_EQ(0, keys.Intern("a"));
+  EXPECT_EQ(1, keys.Find("b"));
+  EXPECT_EQ(2, keys.size());
+  EXPECT_EQ("a", keys.key(0));
+  EXPECT_EQ("b", keys.key(1));
+}
+
+TEST(MetricKeyDictionaryTest, SeededFromBenchmarkInfo) {
+  mako::BenchmarkInfo benchmark_info;
+  for (const char* key : {"y", "x", "z"}) {
+    benchmark_info.add_metric_info_list()->set_value_key(key);
+  }
+  MetricKeyDictionary keys(benchmark_info);
+  MetricKeyDictionary other_keys(benchmark_info);
+  EXPECT_EQ(3, keys.size());
+  EXPECT_EQ(0, keys.Find("y"));
+  EXPECT_EQ(1, keys.Find("x"));
+  EXPECT_EQ(2, keys.Find("z"));
+  // Keys found at runtime get the next ids.
+  EXPECT_EQ(3, keys.Intern("w"));
+  EXPECT_EQ(3, other_keys.Intern("v"));
+  EXPECT_EQ(keys.Find("z"), other_keys.Find("z"));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace mako
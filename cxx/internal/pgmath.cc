@@ -15,47 +15,413 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <deque>
-#include <functional>
+#include <limits>
 #include <random>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define MAKO_PGMATH_X86_DISPATCH 1
+#endif
 
 namespace mako {
 namespace internal {
 namespace {
 
 // Calculates the given percentile from the given sample.
-// Assumes the sample has already been sorted using the provided transform
-// function to calculate the key for each value.
-RunningStats::Result PercentileImpl(
-    const std::deque<double>& sample, double pct,
-    std::function<double(double)> transform = [](double value) {
-      return value;
-    }) {
-  RunningStats::Result r;
+// Assumes the sample has already been sorted.
+double PercentileImpl(const std::deque<double>& sample, double pct) {
   // simple case for size 1
   if (sample.size() == 1) {
-    r.value = transform(sample[0]);
-    return r;
+    return sample[0];
   }
   // float index that has this value and floor/ceiling of it
   double k = static_cast<double>(sample.size() - 1) * pct;
   double f = std::floor(k);
   double c = std::ceil(k);
   if (f == c) {
-    r.value = transform(sample[static_cast<int>(k)]);
-    return r;
+    return sample[static_cast<int>(k)];
   }
   // interpolate
-  double d0 = transform(sample[static_cast<int>(f)]) * (c - k);
-  double d1 = transform(sample[static_cast<int>(c)]) * (k - f);
-  r.value = d0 + d1;
+  double d0 = sample[static_cast<int>(f)] * (c - k);
+  double d1 = sample[static_cast<int>(c)] * (k - f);
+  return d0 + d1;
+}
+
+RunningStats::Error CheckPercentile(double pct) {
+  if (pct < 0.0 || pct > 1.0) {
+    return RunningStats::Error::kBadPercentile;
+  }
+  return RunningStats::Error::kOk;
+}
+
+// Wraps a value and error code in the string-based Result.
+RunningStats::Result MakeResult(RunningStats::Error error, double value) {
+  RunningStats::Result r;
+  r.error = RunningStats::ErrorMessage(error);
+  r.value = value;
   return r;
 }
+
+// Count, sum, min, max, and sum of squared differences from the mean of a block
+// of values.
+struct BlockMoments {
+  double sum;
+  double min;
+  double max;
+  double m2;
+};
+
+// AddVector processes values in blocks of this size, so that the second pass
+// over a block (for m2) reads from cache.
+constexpr std::size_t kMomentsBlockSize = 4096;
+
+// Computes the moments of x[0, n), for n > 0, with the same min/max semantics
+// as the updates in RunningStats::Add. The vectorized versions below must agree
+// with this one up to floating point rounding.
+void BlockMomentsScalar(const double* x, std::size_t n, BlockMoments* out) {
+  double sum = 0;
+  double min = x[0];
+  double max = x[0];
+  for (std::size_t i = 0; i < n; ++i) {
+    sum += x[i];
+    min = std::min(min, x[i]);
+    max = std::max(max, x[i]);
+  }
+  double mean = sum / n;
+  double m2 = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    m2 += (x[i] - mean) * (x[i] - mean);
+  }
+  *out = {sum, min, max, m2};
+}
+
+#ifdef MAKO_PGMATH_X86_DISPATCH
+__attribute__((target("avx2"))) void BlockMomentsAvx2(const double* x,
+                                                      std::size_t n,
+                                                      BlockMoments* out) {
+  constexpr std::size_t kWidth = 4;
+  __m256d sum = _mm256_setzero_pd();
+  __m256d min = _mm256_set1_pd(x[0]);
+  __m256d max = min;
+  std::size_t i = 0;
+  for (; i + kWidth <= n; i += kWidth) {
+    __m256d v = _mm256_loadu_pd(x + i);
+    sum = _mm256_add_pd(sum, v);
+    // Keeps the accumulator when either is NaN, as std::min and std::max do.
+    min = _mm256_min_pd(v, min);
+    max = _mm256_max_pd(v, max);
+  }
+  alignas(32) double lanes[3][kWidth];
+  _mm256_store_pd(lanes[0], sum);
+  _mm256_store_pd(lanes[1], min);
+  _mm256_store_pd(lanes[2], max);
+  double total = 0;
+  double lo = x[0];
+  double hi = x[0];
+  for (std::size_t lane = 0; lane < kWidth; ++lane) {
+    total += lanes[0][lane];
+    lo = std::min(lo, lanes[1][lane]);
+    hi = std::max(hi, lanes[2][lane]);
+  }
+  for (std::size_t j = i; j < n; ++j) {
+    total += x[j];
+    lo = std::min(lo, x[j]);
+    hi = std::max(hi, x[j]);
+  }
+
+  double mean = total / n;
+  __m256d means = _mm256_set1_pd(mean);
+  __m256d m2 = _mm256_setzero_pd();
+  for (i = 0; i + kWidth <= n; i += kWidth) {
+    __m256d d = _mm256_sub_pd(_mm256_loadu_pd(x + i), means);
+    m2 = _mm256_add_pd(m2, _mm256_mul_pd(d, d));
+  }
+  _mm256_store_pd(lanes[0], m2);
+  double squares = lanes[0][0] + lanes[0][1] + lanes[0][2] + lanes[0][3];
+  for (std::size_t j = i; j < n; ++j) {
+    squares += (x[j] - mean) * (x[j] - mean);
+  }
+  *out = {total, lo, hi, squares};
+  // Compilers only insert this themselves when optimizing, and without it
+  // later SSE code (such as libm) runs much slower.
+  _mm256_zeroupper();
+}
+
+__attribute__((target("avx512f"))) void BlockMomentsAvx512(const double* x,
+                                                           std::size_t n,
+                                                           BlockMoments* out) {
+  constexpr std::size_t kWidth = 8;
+  __m512d sum = _mm512_setzero_pd();
+  __m512d min = _mm512_set1_pd(x[0]);
+  __m512d max = min;
+  std::size_t i = 0;
+  for (; i + kWidth <= n; i += kWidth) {
+    __m512d v = _mm512_loadu_pd(x + i);
+    sum = _mm512_add_pd(sum, v);
+    // Keeps the accumulator when either is NaN, as std::min and std::max do.
+    min = _mm512_min_pd(v, min);
+    max = _mm512_max_pd(v, max);
+  }
+  alignas(64) double lanes[3][kWidth];
+  _mm512_store_pd(lanes[0], sum);
+  _mm512_store_pd(lanes[1], min);
+  _mm512_store_pd(lanes[2], max);
+  double total = 0;
+  double lo = x[0];
+  double hi = x[0];
+  for (std::size_t lane = 0; lane < kWidth; ++lane) {
+    total += lanes[0][lane];
+    lo = std::min(lo, lanes[1][lane]);
+    hi = std::max(hi, lanes[2][lane]);
+  }
+  for (std::size_t j = i; j < n; ++j) {
+    total += x[j];
+    lo = std::min(lo, x[j]);
+    hi = std::max(hi, x[j]);
+  }
+
+  double mean = total / n;
+  __m512d means = _mm512_set1_pd(mean);
+  __m512d m2 = _mm512_setzero_pd();
+  for (i = 0; i + kWidth <= n; i += kWidth) {
+    __m512d d = _mm512_sub_pd(_mm512_loadu_pd(x + i), means);
+    m2 = _mm512_add_pd(m2, _mm512_mul_pd(d, d));
+  }
+  _mm512_store_pd(lanes[0], m2);
+  double squares = 0;
+  for (std::size_t lane = 0; lane < kWidth; ++lane) {
+    squares += lanes[0][lane];
+  }
+  for (std::size_t j = i; j < n; ++j) {
+    squares += (x[j] - mean) * (x[j] - mean);
+  }
+  *out = {total, lo, hi, squares};
+  // Compilers only insert this themselves when optimizing, and without it
+  // later SSE code (such as libm) runs much slower.
+  _mm256_zeroupper();
+}
+#endif  // MAKO_PGMATH_X86_DISPATCH
+
+typedef void (*BlockMomentsFunction)(const double*, std::size_t,
+                                     BlockMoments*);
+
+// Returns the fastest implementation the CPU supports.
+BlockMomentsFunction ChooseBlockMoments() {
+#ifdef MAKO_PGMATH_X86_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return BlockMomentsAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return BlockMomentsAvx2;
+  }
+#endif  // MAKO_PGMATH_X86_DISPATCH
+  return BlockMomentsScalar;
+}
+
+// Calculates the median absolute deviation from the given center of the given
+// sample, which must already be sorted. Absolute deviations increase walking
+// outward from the center in both directions, so they are merged in order
+// without re-sorting the sample.
+double SortedMadImpl(const std::deque<double>& sample, double center) {
+  // float index of the median deviation and floor/ceiling of it
+  double k = static_cast<double>(sample.size() - 1) * 0.5;
+  int f = static_cast<int>(std::floor(k));
+  int c = static_cast<int>(std::ceil(k));
+  int right = std::lower_bound(sample.begin(), sample.end(), center) -
+              sample.begin();
+  int left = right - 1;
+  double floor_deviation = 0;
+  double deviation = 0;
+  for (int i = 0; i <= c; ++i) {
+    if (right >= static_cast<int>(sample.size()) ||
+        (left >= 0 && center - sample[left] < sample[right] - center)) {
+      deviation = center - sample[left--];
+    } else {
+      deviation = sample[right++] - center;
+    }
+    if (i == f) {
+      floor_deviation = deviation;
+    }
+  }
+  if (f == c) {
+    return deviation;
+  }
+  // interpolate
+  return floor_deviation * (c - k) + deviation * (k - f);
+}
+
+// Compactor capacities shrink by this factor per level below the top.
+constexpr double kLevelCapacityRatio = 2.0 / 3.0;
+// Smallest capacity given to any level, so low levels still compact in
+// reasonably sized chunks.
+constexpr int kMinLevelCapacity = 8;
+
+// A value retained by a QuantileSketch, along with how many input values it
+// stands for.
+typedef std::pair<double, int64_t> WeightedValue;
+
+// Returns the value at the given position (in [0, total weight - 1]) within
+// weighted values that have been sorted by value.
+double ValueAtPosition(const std::vector<WeightedValue>& sorted,
+                       int64_t position) {
+  int64_t seen = 0;
+  for (const WeightedValue& wv : sorted) {
+    seen += wv.second;
+    if (position < seen) {
+      return wv.first;
+    }
+  }
+  return sorted.back().first;
+}
+
+// Calculates the given percentile from weighted values that have been sorted
+// by value. Interpolates the same way PercentileImpl does, treating a value
+// of weight w as w adjacent copies of that value.
+double WeightedPercentile(const std::vector<WeightedValue>& sorted,
+                          int64_t total_weight, double pct) {
+  double k = static_cast<double>(total_weight - 1) * pct;
+  double f = std::floor(k);
+  double c = std::ceil(k);
+  double low = ValueAtPosition(sorted, static_cast<int64_t>(f));
+  if (f == c) {
+    return low;
+  }
+  double high = ValueAtPosition(sorted, static_cast<int64_t>(c));
+  return low * (c - k) + high * (k - f);
+}
 }  // namespace
 
+QuantileSketch::QuantileSketch(int k)
+    : k_(std::max(k, kMinLevelCapacity)),
+      n_(0),
+      retained_(0),
+      capacity_(0),
+      random_state_(0x9E3779B97F4A7C15ULL) {}
+
+int QuantileSketch::LevelCapacity(int level) const {
+  int depth = static_cast<int>(levels_.size()) - level - 1;
+  int capacity = static_cast<int>(
+      std::ceil(k_ * std::pow(kLevelCapacityRatio, depth)));
+  return std::max(capacity, kMinLevelCapacity);
+}
+
+void QuantileSketch::AddLevel() {
+  levels_.emplace_back();
+  // Capacities depend on the number of levels, so recompute the total.
+  capacity_ = 0;
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    capacity_ += LevelCapacity(h);
+  }
+}
+
+bool QuantileSketch::RandomBit() {
+  // xorshift64
+  random_state_ ^= random_state_ << 13;
+  random_state_ ^= random_state_ >> 7;
+  random_state_ ^= random_state_ << 17;
+  return random_state_ & 1;
+}
+
+void QuantileSketch::Add(double x) {
+  if (levels_.empty()) {
+    AddLevel();
+  }
+  ++n_;
+  ++retained_;
+  levels_[0].push_back(x);
+  while (retained_ >= capacity_) {
+    Compress();
+  }
+}
+
+void QuantileSketch::Compress() {
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    if (levels_[h].size() < static_cast<std::size_t>(LevelCapacity(h))) {
+      continue;
+    }
+    if (h + 1 == levels_.size()) {
+      AddLevel();
+    }
+    std::vector<double>& level = levels_[h];
+    std::vector<double>& next = levels_[h + 1];
+    // With an odd count, one value stays behind so the compacted values pair
+    // up exactly and total weight is preserved.
+    double leftover = 0;
+    bool has_leftover = level.size() % 2 == 1;
+    if (has_leftover) {
+      leftover = level.back();
+      level.pop_back();
+    }
+    std::sort(level.begin(), level.end());
+    for (std::size_t i = RandomBit() ? 1 : 0; i < level.size(); i += 2) {
+      next.push_back(level[i]);
+    }
+    retained_ -= level.size() / 2;
+    level.clear();
+    if (has_leftover) {
+      level.push_back(leftover);
+    }
+    return;
+  }
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other) {
+  while (levels_.size() < other.levels_.size()) {
+    AddLevel();
+  }
+  for (std::size_t h = 0; h < other.levels_.size(); ++h) {
+    levels_[h].insert(levels_[h].end(), other.levels_[h].begin(),
+                      other.levels_[h].end());
+  }
+  n_ += other.n_;
+  retained_ += other.retained_;
+  while (retained_ >= capacity_) {
+    Compress();
+  }
+}
+
+double QuantileSketch::Quantile(double pct) const {
+  std::vector<double> quantiles;
+  Quantiles({pct}, &quantiles);
+  return quantiles[0];
+}
+
+void QuantileSketch::Quantiles(const std::vector<double>& pcts,
+                               std::vector<double>* quantiles) const {
+  std::vector<WeightedValue> values;
+  values.reserve(retained_);
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    for (double x : levels_[h]) {
+      values.emplace_back(x, int64_t{1} << h);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  quantiles->clear();
+  for (double pct : pcts) {
+    quantiles->push_back(WeightedPercentile(values, n_, pct));
+  }
+}
+
+double QuantileSketch::MedianAbsoluteDeviation(double center) const {
+  std::vector<WeightedValue> deviations;
+  deviations.reserve(retained_);
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    for (double x : levels_[h]) {
+      deviations.emplace_back(std::abs(x - center), int64_t{1} << h);
+    }
+  }
+  std::sort(deviations.begin(), deviations.end());
+  return WeightedPercentile(deviations, n_, 0.5);
+}
+
 Random::Random() {
   // std::random_device is a non-deterministic uniform random number generator,
   // although implementations are allowed to implement std::random_device using
@@ -72,10 +438,30 @@ int Random::ProduceInt(int a, int b) {
   return uniform_dist(engine_);
 }
 
+double Random::ProduceUniform() {
+  std::uniform_real_distribution<double> uniform_dist(0.0, 1.0);
+  double u;
+  do {
+    u = uniform_dist(engine_);
+  } while (u <= 0.0);
+  return u;
+}
+
+double Random::ProduceBeta(double a, double b) {
+  // The ratio of gamma variates is beta distributed.
+  double x = std::gamma_distribution<double>(a)(engine_);
+  double y = std::gamma_distribution<double>(b)(engine_);
+  return x / (x + y);
+}
+
 RunningStats::RunningStats(const RunningStats::Config& config)
     : n_(0),
       config_(config),
+      sketch_(config.sketch_k > 0 ? config.sketch_k
+                                  : QuantileSketch::kDefaultK),
       sorted_(false),
+      reservoir_w_(0.0),
+      next_replacement_(0),
       min_(0.0),
       max_(0.0),
       sum_(0.0),
@@ -84,7 +470,35 @@ RunningStats::RunningStats(const RunningStats::Config& config)
       old_s_(0.0),
       new_s_(0.0) {}
 
+const char* RunningStats::ErrorMessage(Error error) {
+  switch (error) {
+    case Error::kOk:
+      return "";
+    case Error::kNoData:
+      return "No data added";
+    case Error::kNoSampleData:
+      return "No sample data maintained";
+    case Error::kBadPercentile:
+      return "Bad pct arg";
+    case Error::kNoRandom:
+      return "RunningStats was not supplied a Random instance.";
+    case Error::kMergeSketchWithSample:
+      return "Cannot merge RunningStats with a sketch and with a sample.";
+    case Error::kMergeDifferentSampleSizes:
+      return "Cannot merge RunningStats with different max sample sizes.";
+    case Error::kMergeDifferentSketchSizes:
+      return "Cannot merge RunningStats with different sketch sizes.";
+    case Error::kMergeDifferentConfigs:
+      return "Cannot merge stats kept with different configs.";
+  }
+  return "Unknown RunningStats error";
+}
+
 std::string RunningStats::Add(double x) {
+  return ErrorMessage(TryAdd(x));
+}
+
+RunningStats::Error RunningStats::TryAdd(double x) {
   // Increment value count
   ++n_;
 
@@ -105,8 +519,20 @@ std::string RunningStats::Add(double x) {
     old_s_ = new_s_;
   }
 
-  // Add to sample
-  if (config_.max_sample_size < 0) {
+  Error err = AddToSample(x, n_);
+  if (err != Error::kOk) {
+    return err;
+  }
+
+  // Flag as not sorted, since we may have added/inserted a value
+  sorted_ = false;
+  return Error::kOk;
+}
+
+RunningStats::Error RunningStats::AddToSample(double x, int n) {
+  if (UseSketch()) {
+    sketch_.Add(x);
+  } else if (config_.max_sample_size < 0) {
     sample_.push_back(x);
   } else if (config_.max_sample_size > 0) {
     // Use reservoir sampling:
@@ -115,67 +541,214 @@ std::string RunningStats::Add(double x) {
       sample_.push_back(x);
     } else {
       // Randomly replace elements in the reservoir with a decreasing
-      // probability. Choose an integer between 0 and index (inclusive)
-      // of added value.
+      // probability, skipping ahead to each value that replaces one.
       if (!config_.random) {
-        return "RunningStats was not supplied a Random instance.""";
+        return Error::kNoRandom;
       }
-      int r = config_.random->ProduceInt(0, n_ - 1);
-      if (r < config_.max_sample_size) {
-        sample_[r] = x;
+      if (next_replacement_ == 0) {
+        ScheduleNextReplacement(n - 1);
+      }
+      if (n == next_replacement_) {
+        sample_[config_.random->ProduceInt(0, config_.max_sample_size - 1)] = x;
+        ScheduleNextReplacement(n);
       }
     }
   }
+  return Error::kOk;
+}
 
-  // Flag as not sorted, since we may have added/inserted a value
-  sorted_ = false;
-  return "";
+void RunningStats::ScheduleNextReplacement(int64_t n) {
+  const int k = config_.max_sample_size;
+  Random* random = config_.random;
+  if (next_replacement_ == 0) {
+    // reservoir_w_ is distributed as the largest of the k smallest of n
+    // uniform random keys, one per value seen, which is Beta(k, n - k + 1).
+    // This is also correct after a Merge, whose reservoir is uniform.
+    reservoir_w_ = n == k ? std::exp(std::log(random->ProduceUniform()) / k)
+                          : random->ProduceBeta(k, n - k + 1);
+  } else {
+    reservoir_w_ *= std::exp(std::log(random->ProduceUniform()) / k);
+  }
+  // The number of values skipped is geometrically distributed.
+  double skip = std::floor(std::log(random->ProduceUniform()) /
+                           std::log1p(-reservoir_w_));
+  next_replacement_ =
+      skip < static_cast<double>(std::numeric_limits<int64_t>::max() - n - 1)
+          ? n + static_cast<int64_t>(skip) + 1
+          : std::numeric_limits<int64_t>::max();
 }
 
 std::string RunningStats::AddVector(const std::vector<double>& values) {
-  std::string err;
-  for (double x : values) {
-    err = Add(x);
-    if (!err.empty()) {
-      return err;
+  return ErrorMessage(TryAddVector(values));
+}
+
+RunningStats::Error RunningStats::TryAddVector(
+    const std::vector<double>& values) {
+  // Update the sample first, since reservoir sampling needs the count at each
+  // value. On error, stop after the failing value as Add() does.
+  Error err = Error::kOk;
+  std::size_t count = values.size();
+  if (UseSketch()) {
+    for (double x : values) {
+      sketch_.Add(x);
+    }
+  } else if (config_.max_sample_size < 0) {
+    sample_.insert(sample_.end(), values.begin(), values.end());
+  } else if (config_.max_sample_size > 0) {
+    // Fill the reservoir, then jump straight to each replacement.
+    count = 0;
+    while (count < values.size() && err == Error::kOk &&
+           (next_replacement_ == 0 || !config_.random)) {
+      err = AddToSample(values[count], n_ + count + 1);
+      ++count;
+    }
+    if (err == Error::kOk && next_replacement_ > 0) {
+      const int64_t last = static_cast<int64_t>(n_) + values.size();
+      while (next_replacement_ <= last) {
+        sample_[config_.random->ProduceInt(0, config_.max_sample_size - 1)] =
+            values[next_replacement_ - n_ - 1];
+        ScheduleNextReplacement(next_replacement_);
+      }
+      count = values.size();
     }
   }
-  return "";
+  if (count > 0) {
+    sorted_ = false;
+  }
+
+  static const BlockMomentsFunction block_moments = ChooseBlockMoments();
+  for (std::size_t begin = 0; begin < count; begin += kMomentsBlockSize) {
+    std::size_t size = std::min(kMomentsBlockSize, count - begin);
+    BlockMoments moments;
+    block_moments(values.data() + begin, size, &moments);
+    MergeMoments(size, moments.sum, moments.min, moments.max,
+                 moments.sum / size, moments.m2);
+  }
+  return err;
+}
+
+std::string RunningStats::Merge(const RunningStats& other) {
+  return ErrorMessage(TryMerge(other));
+}
+
+RunningStats::Error RunningStats::TryMerge(const RunningStats& other) {
+  // preconditions
+  if (UseSketch() != other.UseSketch()) {
+    return Error::kMergeSketchWithSample;
+  }
+  if (!UseSketch() &&
+      config_.max_sample_size != other.config_.max_sample_size) {
+    return Error::kMergeDifferentSampleSizes;
+  }
+  if (UseSketch() && config_.sketch_k != other.config_.sketch_k) {
+    return Error::kMergeDifferentSketchSizes;
+  }
+  if (other.n_ == 0) {
+    return Error::kOk;
+  }
+
+  // Merge samples first, since the bounded case needs the old counts.
+  if (UseSketch()) {
+    sketch_.Merge(other.sketch_);
+  } else if (config_.max_sample_size < 0 ||
+             sample_.size() + other.sample_.size() <=
+                 static_cast<std::size_t>(config_.max_sample_size)) {
+    // Either there is no max, or neither reservoir has dropped any values.
+    sample_.insert(sample_.end(), other.sample_.begin(), other.sample_.end());
+  } else if (config_.max_sample_size > 0) {
+    // Each reservoir is a uniform sample of the values it saw. Draw the merged
+    // reservoir without replacement, choosing which side each value comes from
+    // in proportion to the values seen on that side that remain undrawn.
+    if (!config_.random) {
+      return Error::kNoRandom;
+    }
+    std::deque<double> ours;
+    ours.swap(sample_);
+    std::vector<double> theirs(other.sample_.begin(), other.sample_.end());
+    int our_size = ours.size();
+    int their_size = theirs.size();
+    int our_remaining = n_;
+    int their_remaining = other.n_;
+    while (sample_.size() < static_cast<std::size_t>(config_.max_sample_size)) {
+      bool from_ours = their_size == 0 ||
+                       (our_size > 0 &&
+                        config_.random->ProduceInt(
+                            0, our_remaining + their_remaining - 1) <
+                            our_remaining);
+      if (from_ours) {
+        int i = config_.random->ProduceInt(0, our_size - 1);
+        sample_.push_back(ours[i]);
+        ours[i] = ours[--our_size];
+        --our_remaining;
+      } else {
+        int i = config_.random->ProduceInt(0, their_size - 1);
+        sample_.push_back(theirs[i]);
+        theirs[i] = theirs[--their_size];
+        --their_remaining;
+      }
+    }
+  }
+  sorted_ = false;
+  // The count changes, so any scheduled replacement no longer applies.
+  next_replacement_ = 0;
+
+  MergeMoments(other.n_, other.sum_, other.min_, other.max_, other.new_m_,
+               other.new_s_);
+  return Error::kOk;
+}
+
+void RunningStats::MergeMoments(int n, double sum, double min, double max,
+                                double mean, double m2) {
+  if (n_ == 0) {
+    min_ = min;
+    max_ = max;
+  } else {
+    min_ = std::min(min_, min);
+    max_ = std::max(max_, max);
+  }
+  sum_ += sum;
+
+  // Chan et al.'s pairwise update of the mean and sum of squared differences:
+  // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+  double n_a = n_;
+  double n_b = n;
+  double total = n_a + n_b;
+  double delta = mean - new_m_;
+  new_m_ += delta * n_b / total;
+  new_s_ += m2 + delta * delta * n_a * n_b / total;
+  old_m_ = new_m_;
+  old_s_ = new_s_;
+  n_ += n;
 }
 
 RunningStats::Result RunningStats::Count() const {
-  Result r;
-  r.error = CheckCount();
-  r.value = n_;
-  return r;
+  double value = 0.0;
+  Error error = Count(&value);
+  return MakeResult(error, value);
 }
 
 RunningStats::Result RunningStats::Sum() const {
-  Result r;
-  r.error = CheckCount();
-  r.value = sum_;
-  return r;
+  double value = 0.0;
+  Error error = Sum(&value);
+  return MakeResult(error, value);
 }
 
 RunningStats::Result RunningStats::Min() const {
-  Result r;
-  r.error = CheckCount();
-  r.value = min_;
-  return r;
+  double value = 0.0;
+  Error error = Min(&value);
+  return MakeResult(error, value);
 }
 
 RunningStats::Result RunningStats::Max() const {
-  Result r;
-  r.error = CheckCount();
-  r.value = max_;
-  return r;
+  double value = 0.0;
+  Error error = Max(&value);
+  return MakeResult(error, value);
 }
 
 RunningStats::Result RunningStats::Mean() const {
-  Result r;
-  r.error = CheckCount();
-  r.value = new_m_;
-  return r;
+  double value = 0.0;
+  Error error = Mean(&value);
+  return MakeResult(error, value);
 }
 
 RunningStats::Result RunningStats::Median() {
@@ -183,63 +756,187 @@ RunningStats::Result RunningStats::Median() {
 }
 
 RunningStats::Result RunningStats::Variance() const {
-  Result r;
-  r.error = CheckCount();
+  double value = 0.0;
+  Error error = Variance(&value);
+  return MakeResult(error, value);
+}
+
+RunningStats::Result RunningStats::Stddev() const {
+  double value = 0.0;
+  Error error = Stddev(&value);
+  return MakeResult(error, value);
+}
+
+RunningStats::Result RunningStats::Mad() {
+  double value = 0.0;
+  Error error = Mad(&value);
+  return MakeResult(error, value);
+}
+
+RunningStats::Result RunningStats::Percentile(double pct) {
+  double value = 0.0;
+  Error error = Percentile(pct, &value);
+  if (error == Error::kBadPercentile) {
+    std::stringstream ss;
+    ss << ErrorMessage(error) << ": " << pct;
+    Result r;
+    r.error = ss.str();
+    return r;
+  }
+  return MakeResult(error, value);
+}
+
+RunningStats::Error RunningStats::Count(double* value) const {
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    *value = n_;
+  }
+  return error;
+}
+
+RunningStats::Error RunningStats::Sum(double* value) const {
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    *value = sum_;
+  }
+  return error;
+}
+
+RunningStats::Error RunningStats::Min(double* value) const {
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    *value = min_;
+  }
+  return error;
+}
+
+RunningStats::Error RunningStats::Max(double* value) const {
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    *value = max_;
+  }
+  return error;
+}
+
+RunningStats::Error RunningStats::Mean(double* value) const {
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    *value = new_m_;
+  }
+  return error;
+}
+
+RunningStats::Error RunningStats::Median(double* value) {
+  return Percentile(0.5, value);
+}
+
+RunningStats::Error RunningStats::Variance(double* value) const {
+  Error error = CheckCount();
+  if (error != Error::kOk) {
+    return error;
+  }
   if (n_ <= 1) {
     // For perf data, a single value has 0 variance
-    r.value = 0.0;
+    *value = 0.0;
   } else {
-    r.value = new_s_ / static_cast<double>(n_);
+    *value = new_s_ / static_cast<double>(n_);
   }
-  return r;
+  return Error::kOk;
 }
 
-RunningStats::Result RunningStats::Stddev() const {
-  Result r = Variance();
-  r.value = std::sqrt(r.value);
-  return r;
+RunningStats::Error RunningStats::Stddev(double* value) const {
+  Error error = Variance(value);
+  if (error == Error::kOk) {
+    *value = std::sqrt(*value);
+  }
+  return error;
 }
 
-RunningStats::Result RunningStats::Mad() {
-  Result median_result = Median();
-  if (!median_result.error.empty()) {
-    return median_result;
-  }
-  double median = median_result.value;
-  auto absolute_deviation = [median](double value) {
-    return std::abs(value - median);
-  };
-  // Sort the sample using each value's absolute deviation as the key for
-  // comparison rather than the original value.
-  // This allows us to calculate the MAD without destroying the sample or using
-  // any additional memory.
-  std::sort(sample_.begin(), sample_.end(),
-            [absolute_deviation](double a, double b) {
-              return absolute_deviation(a) < absolute_deviation(b);
-            });
-  sorted_ = false;
-  return PercentileImpl(sample_, 0.5, absolute_deviation);
+RunningStats::Error RunningStats::Mad(double* value) {
+  double median;
+  Error error = Median(&median);
+  if (error != Error::kOk) {
+    return error;
+  }
+  if (UseSketch()) {
+    *value = sketch_.MedianAbsoluteDeviation(median);
+  } else {
+    // Median() left the sample sorted.
+    *value = SortedMadImpl(sample_, median);
+  }
+  return Error::kOk;
 }
 
-RunningStats::Result RunningStats::Percentile(double pct) {
+RunningStats::Error RunningStats::Percentile(double pct, double* value) {
   // preconditions
-  Result r;
-  r.error = CheckCount();
-  if (!r.error.empty()) {
-    return r;
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    error = CheckSample();
   }
-  r.error = CheckSample();
-  if (!r.error.empty()) {
-    return r;
+  if (error == Error::kOk) {
+    error = CheckPercentile(pct);
   }
-  if (pct < 0.0 || pct > 1.0) {
-    std::stringstream ss;
-    ss << "Bad pct arg: " << pct;
-    r.error = ss.str();
-    return r;
+  if (error != Error::kOk) {
+    return error;
+  }
+  if (UseSketch()) {
+    *value = SketchPercentile(pct);
+    return Error::kOk;
   }
   SortSample();
-  return PercentileImpl(sample_, pct);
+  *value = PercentileImpl(sample_, pct);
+  return Error::kOk;
+}
+
+RunningStats::Error RunningStats::Summarize(const std::vector<double>& pcts,
+                                            Summary* summary) {
+  // preconditions
+  Error error = CheckCount();
+  if (error == Error::kOk) {
+    error = CheckSample();
+  }
+  for (std::size_t i = 0; error == Error::kOk && i < pcts.size(); ++i) {
+    error = CheckPercentile(pcts[i]);
+  }
+  if (error != Error::kOk) {
+    return error;
+  }
+  summary->percentiles.clear();
+  if (UseSketch()) {
+    // The median and percentiles are read from one sort of the sketch.
+    std::vector<double> sketch_pcts = {0.5};
+    sketch_pcts.insert(sketch_pcts.end(), pcts.begin(), pcts.end());
+    std::vector<double> estimates;
+    sketch_.Quantiles(sketch_pcts, &estimates);
+    summary->median = BoundSketchEstimate(0.5, estimates[0]);
+    summary->mad = sketch_.MedianAbsoluteDeviation(summary->median);
+    for (std::size_t i = 0; i < pcts.size(); ++i) {
+      summary->percentiles.push_back(
+          BoundSketchEstimate(pcts[i], estimates[i + 1]));
+    }
+    return Error::kOk;
+  }
+  SortSample();
+  summary->median = PercentileImpl(sample_, 0.5);
+  summary->mad = SortedMadImpl(sample_, summary->median);
+  for (double pct : pcts) {
+    summary->percentiles.push_back(PercentileImpl(sample_, pct));
+  }
+  return Error::kOk;
+}
+
+double RunningStats::SketchPercentile(double pct) const {
+  return BoundSketchEstimate(pct, sketch_.Quantile(pct));
+}
+
+double RunningStats::BoundSketchEstimate(double pct, double estimate) const {
+  // The extremes are known exactly, and no estimate can lie beyond them.
+  if (pct == 0.0) {
+    return min_;
+  } else if (pct == 1.0) {
+    return max_;
+  }
+  return std::min(std::max(estimate, min_), max_);
 }
 
 void RunningStats::SortSample() {
@@ -249,18 +946,18 @@ void RunningStats::SortSample() {
   }
 }
 
-std::string RunningStats::CheckCount() const {
+RunningStats::Error RunningStats::CheckCount() const {
   if (n_ <= 0) {
-    return "No data added";
+    return Error::kNoData;
   }
-  return "";
+  return Error::kOk;
 }
 
-std::string RunningStats::CheckSample() const {
-  if (sample_.empty()) {
-    return "No sample data maintained";
+RunningStats::Error RunningStats::CheckSample() const {
+  if (UseSketch() ? sketch_.count() == 0 : sample_.empty()) {
+    return Error::kNoSampleData;
   }
-  return "";
+  return Error::kOk;
 }
 
 }  // namespace internal
@@ -16,9 +16,11 @@
 #ifndef CXX_INTERNAL_PGMATH_H_
 #define CXX_INTERNAL_PGMATH_H_
 
+#include <cstdint>
+#include <deque>
 #include <random>
 #include <string>
-#include <deque>
+#include <vector>
 
 namespace mako {
 namespace internal {
@@ -35,22 +37,101 @@ class Random {
   // Produces a random integer in the interval [a, b].
   int ProduceInt(int a, int b);
 
+  // Produces a random double in the open interval (0, 1).
+  double ProduceUniform();
+
+  // Produces a random double from the Beta(a, b) distribution, for a, b > 0.
+  double ProduceBeta(double a, double b);
+
  private:
   // mersenne_twister_engine is a random number engine based on Mersenne Twister
   // algorithm. It produces high quality unsigned integer random numbers.
   std::mt19937 engine_;
 };
 
+// Mergeable streaming quantile sketch with bounded memory.
+//
+// This is the KLL sketch described in:
+// Optimal Quantile Approximation in Streams
+// Zohar Karnin, Kevin Lang and Edo Liberty
+// https://arxiv.org/abs/1603.05346
+//
+// Values are kept in a stack of compactors, where a value held at level h
+// stands for 2^h values of the input. When the sketch is full, the lowest full
+// compactor is sorted and every other value (starting at a random offset) is
+// promoted to the next level; the rest are discarded.
+//
+// Accuracy is controlled by k, the capacity of the top compactor. Lower
+// levels get geometrically smaller capacities, so roughly 3*k values are
+// retained no matter how many values are added. The error is randomized; the
+// paper bounds it with high probability, and the bound grows as 1/k. As an
+// empirical result rather than a guarantee, pgmath_test finds the rank of each
+// returned quantile within 1.7/k of the count of the requested rank, for k of
+// 50 to 1000 over a million values (0.85% at the default k of 200). While
+// fewer than k values have been added, results are exact.
+//
+// Sketches can be merged, and the merged sketch has the same error bound as
+// one that was fed every value directly, as long as both used the same k.
+class QuantileSketch {
+ public:
+  static constexpr int kDefaultK = 200;
+
+  explicit QuantileSketch(int k = kDefaultK);
+
+  // Adds a value.
+  void Add(double x);
+
+  // Adds all values represented by another sketch.
+  void Merge(const QuantileSketch& other);
+
+  // Count of values added (directly or through Merge).
+  int64_t count() const { return n_; }
+
+  // Count of values currently held in memory.
+  int retained() const { return retained_; }
+
+  // Returns the estimated value at percent (pct) in range [0.0, 1.0],
+  // interpolating between neighboring ranks like RunningStats::Percentile().
+  // The sketch must not be empty.
+  double Quantile(double pct) const;
+
+  // Sets quantiles to the estimated value at each percent in pcts, in the same
+  // order, as Quantile() would. The held values are sorted once for all of
+  // them. The sketch must not be empty.
+  void Quantiles(const std::vector<double>& pcts,
+                 std::vector<double>* quantiles) const;
+
+  // Returns the estimated median absolute deviation from the given center
+  // (normally the median). The sketch must not be empty.
+  double MedianAbsoluteDeviation(double center) const;
+
+ private:
+  int LevelCapacity(int level) const;
+  void AddLevel();
+  void Compress();
+  bool RandomBit();
+
+  // Accuracy parameter, see class comment.
+  int k_;
+  // Count of values added.
+  int64_t n_;
+  // Count of values held across all levels.
+  int retained_;
+  // Sum of all level capacities. Compress() runs when this is reached.
+  int capacity_;
+  // State for the xorshift generator that picks compaction offsets. A full
+  // Random is not worth its size here; one bit is needed per compaction.
+  uint64_t random_state_;
+  // levels_[h] holds values of weight 2^h.
+  std::vector<std::vector<double>> levels_;
+};
+
 // Efficiently maintains running stats for a numeric population.
 //
 // Caller can specify the max maintained sample size for estimating percentiles,
-// median, and MAD. All other values are exact or precise within the limits of
-// the chosen online algorithms.
-//
-// We may consider an upgrade for online percentiles:
-// A Fast Algorithm for Approximate Quantiles in High Speed Data Streams
-// Qi Zhang and Wei Wang
-// http://citeseerx.ist.psu.edu/viewdoc/download?doi=10.1.1.74.8534&rep=rep1&type=pdf
+// median, and MAD, or ask for those to be estimated with a QuantileSketch. All
+// other values are exact or precise within the limits of the chosen online
+// algorithms.
 class RunningStats {
  public:
   // Optional configuration for construction.
@@ -58,7 +139,16 @@ class RunningStats {
     Config() : Config(-1, nullptr) {}
     Config(int max_size, Random* rand) :
       max_sample_size(max_size),
-      random(rand) {}
+      random(rand),
+      sketch_k(0) {}
+
+    // Returns a config which estimates percentiles, median, and MAD with a
+    // QuantileSketch of accuracy k instead of maintaining a sample.
+    static Config Sketch(int k = QuantileSketch::kDefaultK) {
+      Config config(0, nullptr);
+      config.sketch_k = k;
+      return config;
+    }
 
     // The max sample size maintained for calculating
     // percentiles, median, and MAD. A negative value indicates
@@ -71,8 +161,33 @@ class RunningStats {
     // Many instances of RunningStats in a single thread should all share
     // the same Random instance.
     Random* random;
+
+    // If > 0, percentiles, median, and MAD are estimated from a QuantileSketch
+    // using this as its accuracy parameter, and max_sample_size and random are
+    // ignored. Memory use is then bounded by about 3 * sketch_k values. See
+    // QuantileSketch for error bounds.
+    int sketch_k;
   };
 
+  // Identifies the error reported by the allocation-free methods below. Only
+  // ErrorMessage() turns it into text, so callers on hot paths can test for
+  // errors without building or comparing strings.
+  enum class Error {
+    kOk = 0,
+    kNoData,
+    kNoSampleData,
+    kBadPercentile,
+    kNoRandom,
+    kMergeSketchWithSample,
+    kMergeDifferentSampleSizes,
+    kMergeDifferentSketchSizes,
+    kMergeDifferentConfigs,
+  };
+
+  // Returns the message for error, or "" for Error::kOk. Messages are static,
+  // so nothing is allocated.
+  static const char* ErrorMessage(Error error);
+
   // Returned from some functions to pair a value with a possible error.
   struct Result {
     Result() : value(0.0) {}
@@ -80,6 +195,15 @@ class RunningStats {
     double value;
   };
 
+  // Returned from Summarize() with the order statistics it computes.
+  struct Summary {
+    Summary() : median(0.0), mad(0.0) {}
+    double median;
+    double mad;
+    // One value per requested pct, in the same order.
+    std::vector<double> percentiles;
+  };
+
   // Default constructor
   RunningStats() : RunningStats(Config()) {}
 
@@ -92,6 +216,12 @@ class RunningStats {
   // Adds many values. Any errors will be returned.
   std::string AddVector(const std::vector<double>& values);
 
+  // Adds all values that were added to other, so that this becomes equivalent
+  // to a single RunningStats that saw both streams. Both must keep the same
+  // kind of sample: both sketches, or samples with the same max_sample_size.
+  // Merging bounded samples may require a Random. Any errors will be returned.
+  std::string Merge(const RunningStats& other);
+
   // Returns exact count.
   Result Count() const;
 
@@ -122,13 +252,53 @@ class RunningStats {
   // Returns given percentile for percent (pct) in range [0.0, 1.0].
   Result Percentile(double pct);
 
+  // Allocation-free forms of the above. Each stores its value in *value and
+  // returns Error::kOk, or returns the error and leaves *value unchanged.
+  Error TryAdd(double x);
+  Error TryAddVector(const std::vector<double>& values);
+  Error TryMerge(const RunningStats& other);
+  Error Count(double* value) const;
+  Error Sum(double* value) const;
+  Error Min(double* value) const;
+  Error Max(double* value) const;
+  Error Mean(double* value) const;
+  Error Median(double* value);
+  Error Variance(double* value) const;
+  Error Stddev(double* value) const;
+  Error Mad(double* value);
+  Error Percentile(double pct, double* value);
+
+  // Fills summary with the median, MAD, and the percentile for each pct in
+  // pcts (each in range [0.0, 1.0]). The sample is sorted at most once, so
+  // this is cheaper than calling Median(), Mad(), and Percentile() separately.
+  // The storage of summary->percentiles is reused, so a Summary may be passed
+  // again for each RunningStats in a loop.
+  Error Summarize(const std::vector<double>& pcts, Summary* summary);
+
   // Returns the current sample used for percentiles, median, and MAD.
+  // Always empty when a sketch is used (Config::sketch_k > 0).
   const std::deque<double>& sample() const {return sample_;}
 
+  // Returns the sketch used for percentiles, median, and MAD when
+  // Config::sketch_k > 0.
+  const QuantileSketch& sketch() const {return sketch_;}
+
  private:
+  bool UseSketch() const { return config_.sketch_k > 0; }
+  double SketchPercentile(double pct) const;
+  // Bounds the sketch's estimate of the value at pct by the exact extremes.
+  double BoundSketchEstimate(double pct, double estimate) const;
+  // Adds x, the nth value added, to the sample or sketch.
+  Error AddToSample(double x, int n);
+  // Computes when the full reservoir next replaces a value, given that n
+  // values have been added so far.
+  void ScheduleNextReplacement(int64_t n);
+  // Combines n values with the given moments into the running moments.
+  void MergeMoments(int n, double sum, double min, double max, double mean,
+                    double m2);
   void SortSample();
-  std::string CheckCount() const;
-  std::string CheckSample() const;
+  Error CheckCount() const;
+  Error CheckSample() const;
 
   // Count of values added
   int n_;
@@ -136,9 +306,19 @@ class RunningStats {
   Config config_;
   // Sample being maintained, may be capped by max_sample_size.
   std::deque<double> sample_;
+  // Sketch being maintained instead of sample_ when sketch_k > 0.
+  QuantileSketch sketch_;
   // True if sample is currently sorted. The sample is not maintained sorted,
   // because values may get swapped many times while adding.
   bool sorted_;
+  // Once a bounded sample is full, Li's Algorithm L skips directly to the next
+  // value that replaces one in the reservoir, so random numbers are only drawn
+  // per replacement: "Reservoir-Sampling Algorithms of Time Complexity
+  // O(n(1 + log(N/n)))", ACM TOMS 20(4), 1994.
+  // reservoir_w_ is the current acceptance threshold, and next_replacement_ is
+  // the count at which the next replacement happens, or 0 if not yet computed.
+  double reservoir_w_;
+  int64_t next_replacement_;
   // Exact min seen so far
   double min_;
   // Exact max seen so far
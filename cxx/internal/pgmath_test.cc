@@ -14,8 +14,11 @@
 #include "cxx/internal/pgmath.h"
 
 #include <algorithm>
-#include <string>
+#include <cmath>
 #include <deque>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "glog/logging.h"
 #include "benchmark/benchmark.h"
@@ -363,6 +366,408 @@ TEST(PgmathTest, SampleRestrictions) {
   }
 }
 
+// Returns 0, 1, ..., n-1 in a fixed pseudo-random order, so that the rank of
+// each value is the value itself.
+std::vector<double> ShuffledRange(int n) {
+  std::vector<double> values(n);
+  for (int i = 0; i < n; ++i) values[i] = i;
+  std::shuffle(values.begin(), values.end(), std::mt19937(1234));
+  return values;
+}
+
+TEST(PgmathTest, QuantileSketchExactBelowK) {
+  QuantileSketch sketch(200);
+  RunningStats exact;
+  for (double x : ShuffledRange(150)) {
+    sketch.Add(x);
+    exact.Add(x);
+  }
+  ASSERT_EQ(150, sketch.count());
+  ASSERT_EQ(150, sketch.retained());
+  for (double pct : {0.0, 0.01, 0.25, 0.5, 0.77, 0.99, 1.0}) {
+    ASSERT_NEAR(exact.Percentile(pct).value, sketch.Quantile(pct), 0.000001);
+  }
+  double median = exact.Median().value;
+  ASSERT_NEAR(exact.Mad().value, sketch.MedianAbsoluteDeviation(median),
+              0.000001);
+}
+
+TEST(PgmathTest, QuantileSketchRankError) {
+  const int n = 1000000;
+  for (int k : {50, 200, 1000}) {
+    LOG(INFO) << "k: " << k;
+    QuantileSketch sketch(k);
+    for (double x : ShuffledRange(n)) {
+      sketch.Add(x);
+    }
+    ASSERT_EQ(n, sketch.count());
+    // Memory stays bounded by roughly 3*k values.
+    ASSERT_LE(sketch.retained(), 3 * k + 100);
+    for (double pct : {0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999}) {
+      // The value is its own rank, so this is the normalized rank error.
+      double rank_error = std::abs(sketch.Quantile(pct) - pct * (n - 1)) / n;
+      ASSERT_LE(rank_error, 1.7 / k) << "pct: " << pct;
+    }
+  }
+}
+
+TEST(PgmathTest, QuantileSketchMerge) {
+  const int n = 400000;
+  const int k = 200;
+  std::vector<double> values = ShuffledRange(n);
+  std::vector<QuantileSketch> parts(4, QuantileSketch(k));
+  for (int i = 0; i < n; ++i) {
+    parts[i % parts.size()].Add(values[i]);
+  }
+  QuantileSketch merged(k);
+  for (const QuantileSketch& part : parts) {
+    merged.Merge(part);
+  }
+  ASSERT_EQ(n, merged.count());
+  ASSERT_LE(merged.retained(), 3 * k + 100);
+  for (double pct : {0.01, 0.5, 0.99}) {
+    double rank_error = std::abs(merged.Quantile(pct) - pct * (n - 1)) / n;
+    ASSERT_LE(rank_error, 1.7 / k) << "pct: " << pct;
+  }
+  std::vector<double> quantiles;
+  merged.Quantiles({0.99, 0, 0.5, 1}, &quantiles);
+  ASSERT_EQ(std::vector<double>({merged.Quantile(0.99), merged.Quantile(0),
+                                 merged.Quantile(0.5), merged.Quantile(1)}),
+            quantiles);
+}
+
+TEST(PgmathTest, SketchMode) {
+  const int n = 100000;
+  RunningStats exact;
+  RunningStats sketched(RunningStats::Config::Sketch());
+  for (double x : ShuffledRange(n)) {
+    exact.Add(x);
+    sketched.Add(x);
+  }
+  // No sample is kept.
+  ASSERT_TRUE(sketched.sample().empty());
+  ASSERT_EQ(n, sketched.sketch().count());
+  // Non-quantile stats are still exact.
+  ASSERT_EQ(exact.Count().value, sketched.Count().value);
+  ASSERT_EQ(exact.Mean().value, sketched.Mean().value);
+  ASSERT_EQ(exact.Stddev().value, sketched.Stddev().value);
+  // Extremes are exact.
+  ASSERT_EQ(0, sketched.Percentile(0).value);
+  ASSERT_EQ(n - 1, sketched.Percentile(1).value);
+  const double tolerance = n * 1.7 / QuantileSketch::kDefaultK;
+  for (double pct : {0.01, 0.5, 0.99}) {
+    auto got = sketched.Percentile(pct);
+    ASSERT_TRUE(got.error.empty());
+    ASSERT_NEAR(exact.Percentile(pct).value, got.value, tolerance);
+  }
+  auto median = sketched.Median();
+  ASSERT_TRUE(median.error.empty());
+  ASSERT_NEAR(exact.Median().value, median.value, tolerance);
+  auto mad = sketched.Mad();
+  ASSERT_TRUE(mad.error.empty());
+  ASSERT_NEAR(exact.Mad().value, mad.value, tolerance);
+
+  RunningStats empty(RunningStats::Config::Sketch());
+  ASSERT_FALSE(empty.Percentile(0.5).error.empty());
+  ASSERT_FALSE(empty.Mad().error.empty());
+}
+
+TEST(PgmathTest, Summarize) {
+  const std::vector<double> pcts = {0, 0.001, 0.01, 0.25, 0.5, 0.9, 0.999, 1};
+  std::mt19937 gen(42);
+  // Small integer ranges exercise ties around the median.
+  for (int range : {3, 10, 1000}) {
+    for (int n : {1, 2, 3, 4, 17, 1000}) {
+      std::uniform_int_distribution<int> dist(-range, range);
+      std::vector<double> values(n);
+      for (double& x : values) x = dist(gen);
+
+      // Expected values from the individual queries, on a fresh copy each
+      // time so that no query benefits from another's sorting.
+      RunningStats::Summary want;
+      {
+        RunningStats stats;
+        stats.AddVector(values);
+        want.median = stats.Median().value;
+      }
+      {
+        RunningStats stats;
+        stats.AddVector(values);
+        want.mad = stats.Mad().value;
+      }
+      for (double pct : pcts) {
+        RunningStats stats;
+        stats.AddVector(values);
+        want.percentiles.push_back(stats.Percentile(pct).value);
+      }
+
+      RunningStats stats;
+      stats.AddVector(values);
+      RunningStats::Summary got;
+      ASSERT_EQ(RunningStats::Error::kOk, stats.Summarize(pcts, &got));
+      ASSERT_EQ(want.median, got.median);
+      ASSERT_DOUBLE_EQ(want.mad, got.mad);
+      ASSERT_EQ(want.percentiles, got.percentiles);
+    }
+  }
+
+  RunningStats::Summary got;
+  RunningStats empty;
+  ASSERT_EQ(RunningStats::Error::kNoData, empty.Summarize(pcts, &got));
+  RunningStats no_sample(RunningStats::Config(0, nullptr));
+  no_sample.Add(1);
+  ASSERT_EQ(RunningStats::Error::kNoSampleData,
+            no_sample.Summarize(pcts, &got));
+  RunningStats stats;
+  stats.Add(1);
+  ASSERT_EQ(RunningStats::Error::kBadPercentile,
+            stats.Summarize({0.5, 1.5}, &got));
+  ASSERT_EQ(RunningStats::Error::kOk, stats.Summarize({}, &got));
+  ASSERT_EQ(1, got.median);
+  ASSERT_TRUE(got.percentiles.empty());
+
+  RunningStats sketched(RunningStats::Config::Sketch());
+  sketched.AddVector(ShuffledRange(100000));
+  ASSERT_EQ(RunningStats::Error::kOk, sketched.Summarize(pcts, &got));
+  ASSERT_EQ(sketched.Median().value, got.median);
+  ASSERT_EQ(sketched.Mad().value, got.mad);
+  for (int i = 0; i < pcts.size(); ++i) {
+    ASSERT_EQ(sketched.Percentile(pcts[i]).value, got.percentiles[i]);
+  }
+}
+
+TEST(PgmathTest, ErrorCodes) {
+  using Error = RunningStats::Error;
+  double value = -1;
+  RunningStats empty;
+  ASSERT_EQ(Error::kNoData, empty.Count(&value));
+  ASSERT_EQ(Error::kNoData, empty.Sum(&value));
+  ASSERT_EQ(Error::kNoData, empty.Min(&value));
+  ASSERT_EQ(Error::kNoData, empty.Max(&value));
+  ASSERT_EQ(Error::kNoData, empty.Mean(&value));
+  ASSERT_EQ(Error::kNoData, empty.Variance(&value));
+  ASSERT_EQ(Error::kNoData, empty.Stddev(&value));
+  ASSERT_EQ(Error::kNoData, empty.Median(&value));
+  ASSERT_EQ(Error::kNoData, empty.Mad(&value));
+  ASSERT_EQ(-1, value);
+  // The string forms carry the same messages.
+  ASSERT_EQ(RunningStats::ErrorMessage(Error::kNoData), empty.Mean().error);
+
+  RunningStats no_sample(RunningStats::Config(0, nullptr));
+  ASSERT_EQ(Error::kOk, no_sample.TryAddVector({1, 2, 3, 4}));
+  ASSERT_EQ(Error::kOk, no_sample.Sum(&value));
+  ASSERT_EQ(10, value);
+  ASSERT_EQ(Error::kNoSampleData, no_sample.Percentile(0.5, &value));
+  ASSERT_EQ(RunningStats::ErrorMessage(Error::kNoSampleData),
+            no_sample.Median().error);
+
+  RunningStats stats;
+  ASSERT_EQ(Error::kOk, stats.TryAdd(4));
+  ASSERT_EQ(Error::kOk, stats.TryAdd(2));
+  ASSERT_EQ(Error::kBadPercentile, stats.Percentile(-0.1, &value));
+  ASSERT_EQ("Bad pct arg: 1.5", stats.Percentile(1.5).error);
+  ASSERT_EQ(Error::kOk, stats.Percentile(1, &value));
+  ASSERT_EQ(4, value);
+  ASSERT_EQ(Error::kOk, stats.Median(&value));
+  ASSERT_EQ(3, value);
+  ASSERT_EQ(Error::kOk, stats.Stddev(&value));
+  ASSERT_EQ(1, value);
+
+  ASSERT_EQ(Error::kMergeSketchWithSample,
+            stats.TryMerge(RunningStats(RunningStats::Config::Sketch())));
+  ASSERT_EQ(Error::kMergeDifferentSampleSizes, stats.TryMerge(no_sample));
+  RunningStats sketch(RunningStats::Config::Sketch(64));
+  ASSERT_EQ(Error::kMergeDifferentSketchSizes,
+            sketch.TryMerge(RunningStats(RunningStats::Config::Sketch(128))));
+  ASSERT_EQ(Error::kOk,
+            sketch.TryMerge(RunningStats(RunningStats::Config::Sketch(64))));
+  RunningStats no_random(RunningStats::Config(1, nullptr));
+  ASSERT_EQ(Error::kOk, no_random.TryAdd(1));
+  ASSERT_EQ(Error::kNoRandom, no_random.TryAdd(2));
+  ASSERT_EQ("", RunningStats::ErrorMessage(Error::kOk));
+}
+
+TEST(PgmathTest, Merge) {
+  std::vector<double> values = ShuffledRange(10000);
+  for (double& x : values) x = x * 0.01 - 20;
+  // Uneven parts, including an empty one.
+  std::vector<std::vector<double>> parts = {
+      {values.begin(), values.begin() + 1},
+      {},
+      {values.begin() + 1, values.begin() + 3000},
+      {values.begin() + 3000, values.end()}};
+  RunningStats want;
+  want.AddVector(values);
+
+  RunningStats got;
+  RunningStats sketched(RunningStats::Config::Sketch());
+  for (const auto& part : parts) {
+    RunningStats stats;
+    ASSERT_EQ("", stats.AddVector(part));
+    ASSERT_EQ("", got.Merge(stats));
+    RunningStats sketched_part(RunningStats::Config::Sketch());
+    ASSERT_EQ("", sketched_part.AddVector(part));
+    ASSERT_EQ("", sketched.Merge(sketched_part));
+  }
+  for (RunningStats* stats : {&got, &sketched}) {
+    ASSERT_EQ(want.Count().value, stats->Count().value);
+    ASSERT_EQ(want.Min().value, stats->Min().value);
+    ASSERT_EQ(want.Max().value, stats->Max().value);
+    ASSERT_NEAR(want.Sum().value, stats->Sum().value, 1e-6);
+    ASSERT_NEAR(want.Mean().value, stats->Mean().value, 1e-9);
+    ASSERT_NEAR(want.Variance().value, stats->Variance().value, 1e-6);
+  }
+  // Unbounded samples are concatenated.
+  ASSERT_EQ(values.size(), got.sample().size());
+  for (double pct : {0.0, 0.1, 0.5, 0.99, 1.0}) {
+    ASSERT_EQ(want.Percentile(pct).value, got.Percentile(pct).value);
+  }
+  ASSERT_EQ(values.size(), sketched.sketch().count());
+  ASSERT_NEAR(want.Median().value, sketched.Median().value,
+              values.size() * 0.01 * 1.7 / QuantileSketch::kDefaultK);
+
+  // Mismatched configs.
+  Random random;
+  RunningStats bounded(RunningStats::Config(10, &random));
+  bounded.Add(1);
+  ASSERT_NE("", got.Merge(sketched));
+  ASSERT_NE("", sketched.Merge(got));
+  ASSERT_NE("", got.Merge(bounded));
+}
+
+TEST(PgmathTest, MergeBoundedSamples) {
+  // Merge a reservoir of 1000 zeros with one of 3000 ones. The merged
+  // reservoir should hold ones in proportion to the values seen, not to the
+  // sizes of the two reservoirs.
+  constexpr int kMaxSampleSize = 100;
+  constexpr int kTrials = 200;
+  Random random;
+  int ones = 0;
+  for (int trial = 0; trial < kTrials; ++trial) {
+    RunningStats zeros(RunningStats::Config(kMaxSampleSize, &random));
+    RunningStats more_ones(RunningStats::Config(kMaxSampleSize, &random));
+    ASSERT_EQ("", zeros.AddVector(std::vector<double>(1000, 0)));
+    ASSERT_EQ("", more_ones.AddVector(std::vector<double>(3000, 1)));
+    ASSERT_EQ("", zeros.Merge(more_ones));
+    ASSERT_EQ(kMaxSampleSize, zeros.sample().size());
+    ASSERT_EQ(4000, zeros.Count().value);
+    ASSERT_EQ(0.75, zeros.Mean().value);
+    for (double x : zeros.sample()) ones += x;
+  }
+  // Binomial stddev of the fraction is about 0.003, so this is a loose bound.
+  ASSERT_NEAR(0.75, static_cast<double>(ones) / (kTrials * kMaxSampleSize),
+              0.02);
+
+  // Reservoirs that have not dropped anything are concatenated.
+  RunningStats a(RunningStats::Config(kMaxSampleSize, nullptr));
+  RunningStats b(RunningStats::Config(kMaxSampleSize, nullptr));
+  ASSERT_EQ("", a.AddVector({1, 2, 3}));
+  ASSERT_EQ("", b.AddVector({4, 5}));
+  ASSERT_EQ("", a.Merge(b));
+  ASSERT_EQ(5, a.sample().size());
+  // Otherwise a Random is needed.
+  ASSERT_EQ("", b.AddVector(std::vector<double>(kMaxSampleSize - 2, 0)));
+  ASSERT_NE("", a.Merge(b));
+}
+
+TEST(PgmathTest, AddVectorMatchesAdd) {
+  std::mt19937 gen(7);
+  // A large offset makes naive variance formulas lose precision.
+  std::normal_distribution<double> dist(1e6, 10);
+  // Sizes around the SIMD widths and block size exercise the tails.
+  for (int n : {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 4095, 4096, 4097, 20000}) {
+    SCOPED_TRACE(n);
+    std::vector<double> values(n);
+    for (double& x : values) x = dist(gen);
+    // Start from a non-empty state, as buffered aggregation does.
+    RunningStats want;
+    RunningStats got;
+    ASSERT_EQ("", want.Add(-3));
+    ASSERT_EQ("", got.Add(-3));
+    for (double x : values) ASSERT_EQ("", want.Add(x));
+    ASSERT_EQ("", got.AddVector(values));
+
+    ASSERT_EQ(want.Count().value, got.Count().value);
+    ASSERT_EQ(want.Min().value, got.Min().value);
+    ASSERT_EQ(want.Max().value, got.Max().value);
+    ASSERT_NEAR(want.Sum().value, got.Sum().value, 1e-9 * n * 1e6);
+    ASSERT_NEAR(want.Mean().value, got.Mean().value, 1e-12 * 1e6);
+    ASSERT_NEAR(want.Variance().value, got.Variance().value,
+                1e-6 * want.Variance().value + 1e-9);
+    ASSERT_EQ(want.sample(), got.sample());
+  }
+
+  // Like Add, AddVector fails at the first value that cannot be sampled, but
+  // still counts it.
+  RunningStats stats(RunningStats::Config(2, nullptr));
+  ASSERT_NE("", stats.AddVector({1, 2, 3, 4}));
+  ASSERT_EQ(3, stats.Count().value);
+  ASSERT_EQ(6, stats.Sum().value);
+  ASSERT_EQ(2, stats.sample().size());
+}
+
+// Returns the chi-squared statistic of the counts against a uniform
+// expectation.
+double ChiSquared(const std::vector<int>& counts) {
+  double total = 0;
+  for (int count : counts) total += count;
+  double expected = total / counts.size();
+  double chi_squared = 0;
+  for (int count : counts) {
+    chi_squared += (count - expected) * (count - expected) / expected;
+  }
+  return chi_squared;
+}
+
+TEST(PgmathTest, ReservoirSampleIsUniform) {
+  // Every value must be equally likely to end up in the sample, whether
+  // values are added one at a time, in vectors, or merged part way through.
+  constexpr int kMaxSampleSize = 10;
+  constexpr int kNumValues = 1000;
+  constexpr int kTrials = 10000;
+  Random random;
+  std::vector<double> values(kNumValues);
+  for (int i = 0; i < kNumValues; ++i) values[i] = i;
+  // With 999 degrees of freedom, the statistic has mean 999 and stddev ~45.
+  const double max_chi_squared = 999 + 6 * 45;
+
+  std::vector<int> counts(kNumValues);
+  for (int trial = 0; trial < kTrials; ++trial) {
+    RunningStats stats(RunningStats::Config(kMaxSampleSize, &random));
+    for (double x : values) ASSERT_EQ("", stats.Add(x));
+    ASSERT_EQ(kMaxSampleSize, stats.sample().size());
+    for (double x : stats.sample()) ++counts[x];
+  }
+  EXPECT_LT(ChiSquared(counts), max_chi_squared);
+
+  std::fill(counts.begin(), counts.end(), 0);
+  for (int trial = 0; trial < kTrials; ++trial) {
+    RunningStats stats(RunningStats::Config(kMaxSampleSize, &random));
+    // Uneven vectors, some ending exactly as the reservoir fills.
+    ASSERT_EQ("", stats.AddVector({values.begin(), values.begin() + 10}));
+    ASSERT_EQ("", stats.AddVector({values.begin() + 10, values.begin() + 17}));
+    ASSERT_EQ("", stats.Add(values[17]));
+    ASSERT_EQ("", stats.AddVector({values.begin() + 18, values.end()}));
+    ASSERT_EQ(kMaxSampleSize, stats.sample().size());
+    for (double x : stats.sample()) ++counts[x];
+  }
+  EXPECT_LT(ChiSquared(counts), max_chi_squared);
+
+  std::fill(counts.begin(), counts.end(), 0);
+  for (int trial = 0; trial < kTrials; ++trial) {
+    RunningStats stats(RunningStats::Config(kMaxSampleSize, &random));
+    RunningStats other(RunningStats::Config(kMaxSampleSize, &random));
+    ASSERT_EQ("", stats.AddVector({values.begin(), values.begin() + 300}));
+    ASSERT_EQ("", other.AddVector({values.begin() + 300,
+                                   values.begin() + 500}));
+    ASSERT_EQ("", stats.Merge(other));
+    ASSERT_EQ("", stats.AddVector({values.begin() + 500, values.end()}));
+    ASSERT_EQ(kMaxSampleSize, stats.sample().size());
+    for (double x : stats.sample()) ++counts[x];
+  }
+  EXPECT_LT(ChiSquared(counts), max_chi_squared);
+}
+
 static void BM_Add(benchmark::State& state) {
   RunningStats stats(RunningStats::Config{});
   for (auto _ : state) {
@@ -380,6 +785,29 @@ static void BM_AddSampled(benchmark::State& state) {
 }
 BENCHMARK(BM_AddSampled);
 
+// Adds values to a reservoir of the given size, far more values than fit.
+static void BM_AddVectorSampled(benchmark::State& state) {
+  std::vector<double> vals(1 << 20);
+  for (int i = 0; i < vals.size(); ++i) vals[i] = 0.3*i;
+  mako::internal::Random rand;
+  for (auto _ : state) {
+    RunningStats stats(RunningStats::Config(state.range(0), &rand));
+    CHECK_EQ("", stats.AddVector(vals));
+  }
+  state.SetItemsProcessed(state.iterations() * vals.size());
+}
+BENCHMARK(BM_AddVectorSampled)->Range(1, 1<<16);
+
+static void BM_AddSketch(benchmark::State& state) {
+  RunningStats stats(RunningStats::Config::Sketch());
+  double x = 0;
+  for (auto _ : state) {
+    CHECK_EQ("", stats.Add(x));
+    x += 0.3;
+  }
+}
+BENCHMARK(BM_AddSketch);
+
 static void BM_AddVector(benchmark::State& state) {
   std::vector<double> vals(state.range(0));
   for (int i = 0; i < state.range(0); ++i) vals[i] = 0.3*i;
@@ -388,9 +816,34 @@ static void BM_AddVector(benchmark::State& state) {
     RunningStats stats(RunningStats::Config{});
     CHECK_EQ("", stats.AddVector(vals));
   }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 BENCHMARK(BM_AddVector)->Range(1, 1<<24);
 
+// Throughput of the moments alone (no sample), one value at a time versus in
+// blocks, reported as items per second on one core.
+static void BM_AddMomentsOneByOne(benchmark::State& state) {
+  std::vector<double> vals(state.range(0));
+  for (int i = 0; i < state.range(0); ++i) vals[i] = 0.3*i;
+  RunningStats stats(RunningStats::Config(0, nullptr));
+  for (auto _ : state) {
+    for (double x : vals) CHECK_EQ("", stats.Add(x));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddMomentsOneByOne)->Range(8, 1<<16);
+
+static void BM_AddMomentsVector(benchmark::State& state) {
+  std::vector<double> vals(state.range(0));
+  for (int i = 0; i < state.range(0); ++i) vals[i] = 0.3*i;
+  RunningStats stats(RunningStats::Config(0, nullptr));
+  for (auto _ : state) {
+    CHECK_EQ("", stats.AddVector(vals));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddMomentsVector)->Range(8, 1<<16);
+
 static void BM_Mad(benchmark::State& state) {
   RunningStats stats;
   for (int i = 0; i < state.range(0); ++i) CHECK_EQ("", stats.Add(0.3 * i));
@@ -399,5 +852,43 @@ static void BM_Mad(benchmark::State& state) {
   }
 }
 BENCHMARK(BM_Mad)->Range(1, 1<<24);
+
+static void BM_SketchMad(benchmark::State& state) {
+  RunningStats stats(RunningStats::Config::Sketch());
+  for (int i = 0; i < state.range(0); ++i) CHECK_EQ("", stats.Add(0.3 * i));
+  for (auto _ : state) {
+    CHECK_EQ("", stats.Mad().error);
+  }
+}
+BENCHMARK(BM_SketchMad)->Range(1, 1<<24);
+
+// Median, MAD, and 8 percentiles from a freshly filled (unsorted) sample, as
+// done once per metric when aggregating.
+static void BM_Summarize(benchmark::State& state) {
+  const std::vector<double> pcts = {0.001, 0.01, 0.05, 0.1,
+                                    0.9,   0.95, 0.99, 0.999};
+  std::vector<double> vals = ShuffledRange(state.range(0));
+  RunningStats::Summary summary;
+  for (auto _ : state) {
+    state.PauseTiming();
+    RunningStats stats;
+    CHECK_EQ("", stats.AddVector(vals));
+    state.ResumeTiming();
+    CHECK(stats.Summarize(pcts, &summary) == RunningStats::Error::kOk);
+  }
+}
+BENCHMARK(BM_Summarize)->Range(1, 1<<20);
+
+static void BM_SketchSummarize(benchmark::State& state) {
+  const std::vector<double> pcts = {0.001, 0.01, 0.05, 0.1,
+                                    0.9,   0.95, 0.99, 0.999};
+  RunningStats stats(RunningStats::Config::Sketch());
+  CHECK_EQ("", stats.AddVector(ShuffledRange(state.range(0))));
+  RunningStats::Summary summary;
+  for (auto _ : state) {
+    CHECK(stats.Summarize(pcts, &summary) == RunningStats::Error::kOk);
+  }
+}
+BENCHMARK(BM_SketchSummarize)->Range(1, 1<<20);
 }  // namespace internal
 }  // namespace mako
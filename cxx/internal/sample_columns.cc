@@ -0,0 +1,445 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/sample_columns.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace mako {
+namespace internal {
+namespace {
+
+// Starts every encoded block. Field number 0 is not valid in a protocol
+// buffer, so no serialized SampleRecord starts with a zero byte.
+constexpr absl::string_view kMagic("\0MC\1", 4);
+
+void PutVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+bool GetVarint(absl::string_view* data, uint64_t* value) {
+  *value = 0;
+  for (int shift = 0; shift < 64 && !data->empty(); shift += 7) {
+    const unsigned char byte = data->front();
+    data->remove_prefix(1);
+    *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reads a varint that counts items taking at least a byte each in data, so
+// that a corrupted count cannot make the caller allocate more than data.
+bool GetCount(absl::string_view* data, std::size_t* count) {
+  uint64_t value;
+  if (!GetVarint(data, &value) || value > data->size()) {
+    return false;
+  }
+  *count = value;
+  return true;
+}
+
+// Appends each value XORed with the one before it, the first with zero. A
+// value equal to the one before it takes a zero byte. Any other takes a byte
+// with the number of leading zero bytes of the XOR in its high nibble and the
+// number of bytes from there to the last nonzero byte in its low nibble,
+// followed by those bytes, least significant first. This is the XOR encoding
+// of Gorilla, aligned to bytes so that decoding does not shift bits.
+void EncodeDoubles(absl::Span<const double> values, std::string* out) {
+  uint64_t previous = 0;
+  for (double value : values) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint64_t x = bits ^ previous;
+    previous = bits;
+    if (x == 0) {
+      out->push_back(0);
+      continue;
+    }
+    int leading = 0;
+    while ((x >> (56 - 8 * leading) & 0xff) == 0) {
+      ++leading;
+    }
+    int trailing = 0;
+    while ((x >> (8 * trailing) & 0xff) == 0) {
+      ++trailing;
+    }
+    const int size = 8 - leading - trailing;
+    out->push_back(static_cast<char>(leading << 4 | size));
+    for (int i = 0; i < size; ++i) {
+      out->push_back(static_cast<char>(x >> (8 * (trailing + i))));
+    }
+  }
+}
+
+// Appends count values encoded by EncodeDoubles() from the front of data to
+// values.
+bool DecodeDoubles(absl::string_view* data, std::size_t count,
+                   std::vector<double>* values) {
+  // Each value takes at least a byte.
+  if (count > data->size()) {
+    return false;
+  }
+  values->reserve(values->size() + count);
+  const unsigned char* p =
+      reinterpret_cast<const unsigned char*>(data->data());
+  const unsigned char* const end = p + data->size();
+  uint64_t previous = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (p == end) {
+      return false;
+    }
+    const int header = *p++;
+    if (header != 0) {
+      const int leading = header >> 4;
+      const int size = header & 0xf;
+      if (size == 0 || leading + size > 8 || end - p < size) {
+        return false;
+      }
+      const int trailing = 8 - leading - size;
+      uint64_t x = 0;
+      for (int k = 0; k < size; ++k) {
+        x |= static_cast<uint64_t>(p[k]) << (8 * (trailing + k));
+      }
+      p += size;
+      previous ^= x;
+    }
+    double value;
+    std::memcpy(&value, &previous, sizeof(value));
+    values->push_back(value);
+  }
+  data->remove_prefix(p - reinterpret_cast<const unsigned char*>(data->data()));
+  return true;
+}
+
+// Returns whether the record can be stored by column and converted back
+// without loss.
+bool StoredByColumn(const mako::SampleRecord& record) {
+  if (!record.has_sample_point() || record.has_sample_error() ||
+      !record.unknown_fields().empty()) {
+    return false;
+  }
+  const mako::SamplePoint& point = record.sample_point();
+  if (!point.has_input_value() || point.sample_annotations_list_size() > 0 ||
+      !point.aux_data().empty() || !point.unknown_fields().empty()) {
+    return false;
+  }
+  for (const mako::KeyedValue& metric_value : point.metric_value_list()) {
+    if (!metric_value.has_value_key() || !metric_value.has_value() ||
+        !metric_value.unknown_fields().empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+constexpr int SampleColumns::kOtherRecords;
+constexpr int SampleFileReader::kReadBatchSize;
+constexpr int SampleColumnsWriter::kDefaultRecordsPerBlock;
+
+// static
+bool SampleColumns::IsEncoded(absl::string_view data) {
+  return data.substr(0, kMagic.size()) == kMagic;
+}
+
+void SampleColumns::Add(const mako::SampleRecord& record) {
+  if (!StoredByColumn(record)) {
+    other_records_.push_back(record);
+    AddRun(kOtherRecords, 1);
+    return;
+  }
+  const mako::SamplePoint& point = record.sample_point();
+  const double input_value = point.input_value();
+  sequence_.clear();
+  for (const mako::KeyedValue& metric_value : point.metric_value_list()) {
+    const int key_id = keys_.Intern(metric_value.value_key());
+    if (static_cast<std::size_t>(key_id) >= columns_.size()) {
+      columns_.resize(key_id + 1);
+    }
+    columns_[key_id].values.push_back(metric_value.value());
+    columns_[key_id].inputs.push_back(input_value);
+    sequence_.push_back(key_id);
+  }
+  auto it = sequence_ids_.find(sequence_);
+  if (it == sequence_ids_.end()) {
+    it = sequence_ids_.emplace(sequence_, sequences_.size()).first;
+    sequences_.push_back(sequence_);
+  }
+  input_values_.push_back(input_value);
+  AddRun(it->second, 1);
+}
+
+void SampleColumns::AddRun(int sequence, int length) {
+  if (!runs_.empty() && runs_.back().sequence == sequence) {
+    runs_.back().length += length;
+  } else {
+    runs_.push_back({sequence, length});
+  }
+  num_records_ += length;
+}
+
+void SampleColumns::Clear() {
+  num_records_ = 0;
+  keys_ = MetricKeyDictionary();
+  sequences_.clear();
+  sequence_ids_.clear();
+  runs_.clear();
+  input_values_.clear();
+  for (Column& column : columns_) {
+    column.values.clear();
+    column.inputs.clear();
+  }
+  other_records_.clear();
+}
+
+void SampleColumns::Encode(std::string* out) const {
+  out->append(kMagic.data(), kMagic.size());
+  PutVarint(keys_.size(), out);
+  for (int key_id = 0; key_id < keys_.size(); ++key_id) {
+    const std::string& key = keys_.key(key_id);
+    PutVarint(key.size(), out);
+    out->append(key);
+  }
+  PutVarint(sequences_.size(), out);
+  for (const std::vector<int>& sequence : sequences_) {
+    PutVarint(sequence.size(), out);
+    for (int key_id : sequence) {
+      PutVarint(key_id, out);
+    }
+  }
+  PutVarint(runs_.size(), out);
+  for (const Run& run : runs_) {
+    PutVarint(run.sequence + 1, out);
+    PutVarint(run.length, out);
+  }
+  std::string record;
+  for (const mako::SampleRecord& other_record : other_records_) {
+    other_record.SerializeToString(&record);
+    PutVarint(record.size(), out);
+    out->append(record);
+  }
+  EncodeDoubles(input_values_, out);
+  for (int key_id = 0; key_id < keys_.size(); ++key_id) {
+    EncodeDoubles(columns_[key_id].values, out);
+  }
+}
+
+std::string SampleColumns::Decode(absl::string_view data) {
+  Clear();
+  const std::string corrupted = "Corrupted block of sample records.";
+  if (!IsEncoded(data)) {
+    return corrupted;
+  }
+  data.remove_prefix(kMagic.size());
+  std::size_t num_keys;
+  if (!GetCount(&data, &num_keys)) {
+    return corrupted;
+  }
+  for (std::size_t i = 0; i < num_keys; ++i) {
+    std::size_t size;
+    if (!GetCount(&data, &size) ||
+        keys_.Intern(data.substr(0, size)) != static_cast<int>(i)) {
+      return corrupted;
+    }
+    data.remove_prefix(size);
+  }
+  if (columns_.size() < num_keys) {
+    columns_.resize(num_keys);
+  }
+  std::size_t num_sequences;
+  if (!GetCount(&data, &num_sequences)) {
+    return corrupted;
+  }
+  sequences_.resize(num_sequences);
+  for (std::vector<int>& sequence : sequences_) {
+    std::size_t size;
+    if (!GetCount(&data, &size)) {
+      return corrupted;
+    }
+    sequence.resize(size);
+    for (int& key_id : sequence) {
+      uint64_t value;
+      if (!GetVarint(&data, &value) || value >= num_keys) {
+        return corrupted;
+      }
+      key_id = value;
+    }
+  }
+  std::size_t num_runs;
+  if (!GetCount(&data, &num_runs)) {
+    return corrupted;
+  }
+  // The number of values of each column, and of other records.
+  std::vector<std::size_t> column_sizes(num_keys, 0);
+  std::size_t num_other_records = 0;
+  runs_.resize(num_runs);
+  for (Run& run : runs_) {
+    uint64_t sequence;
+    uint64_t length;
+    if (!GetVarint(&data, &sequence) || sequence > num_sequences ||
+        !GetVarint(&data, &length) || length == 0 || length > (1 << 30)) {
+      return corrupted;
+    }
+    run.sequence = static_cast<int>(sequence) - 1;
+    run.length = length;
+    num_records_ += run.length;
+    if (run.sequence == kOtherRecords) {
+      num_other_records += run.length;
+    } else {
+      for (int key_id : sequences_[run.sequence]) {
+        column_sizes[key_id] += run.length;
+      }
+    }
+  }
+  for (std::size_t i = 0; i < num_other_records; ++i) {
+    std::size_t size;
+    other_records_.emplace_back();
+    if (!GetCount(&data, &size) ||
+        !other_records_.back().ParseFromArray(data.data(), size)) {
+      return corrupted;
+    }
+    data.remove_prefix(size);
+  }
+  if (!DecodeDoubles(&data, num_records_ - num_other_records,
+                     &input_values_)) {
+    return corrupted;
+  }
+  for (std::size_t key_id = 0; key_id < num_keys; ++key_id) {
+    if (!DecodeDoubles(&data, column_sizes[key_id],
+                       &columns_[key_id].values)) {
+      return corrupted;
+    }
+    columns_[key_id].inputs.reserve(column_sizes[key_id]);
+  }
+  if (!data.empty()) {
+    return corrupted;
+  }
+  auto input_value = input_values_.begin();
+  for (const Run& run : runs_) {
+    if (run.sequence == kOtherRecords) {
+      continue;
+    }
+    for (int i = 0; i < run.length; ++i, ++input_value) {
+      for (int key_id : sequences_[run.sequence]) {
+        columns_[key_id].inputs.push_back(*input_value);
+      }
+    }
+  }
+  for (std::size_t i = 0; i < num_sequences; ++i) {
+    sequence_ids_.emplace(sequences_[i], i);
+  }
+  return "";
+}
+
+void SampleColumns::ToRecords(std::vector<mako::SampleRecord>* records) const {
+  records->reserve(records->size() + num_records_);
+  // The next value of each column, and the next input value and other record.
+  std::vector<std::size_t> next_values(keys_.size(), 0);
+  auto input_value = input_values_.begin();
+  auto other_record = other_records_.begin();
+  for (const Run& run : runs_) {
+    for (int i = 0; i < run.length; ++i) {
+      if (run.sequence == kOtherRecords) {
+        records->push_back(*other_record++);
+        continue;
+      }
+      records->emplace_back();
+      mako::SamplePoint* point = records->back().mutable_sample_point();
+      point->set_input_value(*input_value++);
+      for (int key_id : sequences_[run.sequence]) {
+        mako::KeyedValue* metric_value = point->add_metric_value_list();
+        metric_value->set_value_key(keys_.key(key_id));
+        metric_value->set_value(columns_[key_id].values[next_values[key_id]++]);
+      }
+    }
+  }
+}
+
+std::string DecodeSampleFileRecord(absl::string_view data,
+                                   SampleColumns* columns,
+                                   mako::SampleRecord* record,
+                                   bool* has_columns) {
+  *has_columns = SampleColumns::IsEncoded(data);
+  if (*has_columns) {
+    return columns->Decode(data);
+  }
+  if (!record->ParseFromArray(data.data(), data.size())) {
+    return "Failed to parse SampleRecord from sample file.";
+  }
+  return "";
+}
+
+bool SampleFileReader::Next() {
+  error_.clear();
+  has_columns_ = false;
+  if (next_in_batch_ == batch_.size()) {
+    next_in_batch_ = 0;
+    if (!file_io_->ReadBatch(kReadBatchSize, &batch_)) {
+      batch_.clear();
+      if (!file_io_->ReadEOF()) {
+        error_ = file_io_->Error();
+        if (error_.empty()) {
+          error_ = "Could not read from sample file.";
+        }
+      }
+      return false;
+    }
+  }
+  error_ = DecodeSampleFileRecord(batch_[next_in_batch_++], &columns_, &record_,
+                                  &has_columns_);
+  return error_.empty();
+}
+
+bool SampleFileReader::Read(mako::SampleRecord* record) {
+  while (next_record_ == block_records_.size()) {
+    block_records_.clear();
+    next_record_ = 0;
+    if (!Next()) {
+      return false;
+    }
+    if (!has_columns_) {
+      record->Swap(&record_);
+      return true;
+    }
+    columns_.ToRecords(&block_records_);
+  }
+  record->Swap(&block_records_[next_record_++]);
+  return true;
+}
+
+bool SampleColumnsWriter::Write(const mako::SampleRecord& record) {
+  columns_.Add(record);
+  return columns_.num_records() < records_per_block_ || Flush();
+}
+
+bool SampleColumnsWriter::Flush() {
+  if (columns_.num_records() == 0) {
+    return true;
+  }
+  data_.clear();
+  columns_.Encode(&data_);
+  columns_.Clear();
+  return file_io_->Write(data_);
+}
+
+}  // namespace internal
+}  // namespace mako
@@ -0,0 +1,223 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+
+// Stores blocks of SampleRecords by column in sample files.
+#ifndef CXX_INTERNAL_SAMPLE_COLUMNS_H_
+#define CXX_INTERNAL_SAMPLE_COLUMNS_H_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "cxx/internal/metric_key_dictionary.h"
+#include "cxx/spec/fileio.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+
+// A block of SampleRecords stored by column, so that the values of a metric
+// can be handed on as a span rather than gathered from every record, and the
+// keys of the metrics are stored once per block rather than once per value.
+//
+// Records that have just a SamplePoint, with an input value and metric values
+// that have both a key and a value, are stored by column: the input value of
+// each, and for each metric key, its values in record order. The other
+// records, such as those with a SampleError, annotations or aux data, are kept
+// as they are. Converting back to records is lossless.
+//
+// Encode() stores the keys in a table, the sequence of metric keys of each
+// record as an index into a table of the sequences in the block, and each
+// column of doubles XOR-encoded against the previous value, in the style of
+// Gorilla (http://www.vldb.org/pvldb/vol8/p1816-teller.pdf), so that repeated
+// and slowly changing values take few bytes. An encoded block starts with a
+// zero byte, which no serialized SampleRecord does, so blocks and records can
+// be mixed in a sample file.
+//
+// Not thread-safe.
+class SampleColumns {
+ public:
+  // Returns whether data is a block encoded by Encode(), rather than a
+  // serialized SampleRecord.
+  static bool IsEncoded(absl::string_view data);
+
+  // Adds a record to the end of the block.
+  void Add(const mako::SampleRecord& record);
+
+  // Removes all records, keeping allocated memory for reuse.
+  void Clear();
+
+  // Appends the block to out.
+  void Encode(std::string* out) const;
+
+  // Replaces the records of the block with those encoded in data. Returns an
+  // error message, or the empty string on success.
+  std::string Decode(absl::string_view data);
+
+  // Appends the records of the block to records, in the order they were added.
+  void ToRecords(std::vector<mako::SampleRecord>* records) const;
+
+  // Returns the number of records in the block.
+  int num_records() const { return num_records_; }
+
+  // Returns the number of metric keys in the block; each key id is less than
+  // this.
+  int num_keys() const { return keys_.size(); }
+
+  // Returns the metric key with the given id.
+  const std::string& key(int key_id) const { return keys_.key(key_id); }
+
+  // Returns the input values of the records stored by column, in order.
+  absl::Span<const double> input_values() const { return input_values_; }
+
+  // Returns the values of the metric with the given key id, in record order.
+  absl::Span<const double> values(int key_id) const {
+    return columns_[key_id].values;
+  }
+
+  // Returns the input value of the record of each of values(key_id).
+  absl::Span<const double> value_inputs(int key_id) const {
+    return columns_[key_id].inputs;
+  }
+
+  // Returns the records that are not stored by column, in order.
+  const std::vector<mako::SampleRecord>& other_records() const {
+    return other_records_;
+  }
+
+ private:
+  // A run of consecutive records with the same sequence of metric keys, or
+  // of records that are not stored by column.
+  struct Run {
+    // Index into sequences_, or kOtherRecords.
+    int sequence;
+    int length;
+  };
+  static constexpr int kOtherRecords = -1;
+
+  struct Column {
+    std::vector<double> values;
+    std::vector<double> inputs;
+  };
+
+  // Appends a run of length records with the given sequence.
+  void AddRun(int sequence, int length);
+
+  int num_records_ = 0;
+  MetricKeyDictionary keys_;
+  // The distinct sequences of key ids of the records stored by column.
+  std::vector<std::vector<int>> sequences_;
+  absl::flat_hash_map<std::vector<int>, int> sequence_ids_;
+  std::vector<Run> runs_;
+  std::vector<double> input_values_;
+  // By key id. Columns past num_keys() are spare.
+  std::vector<Column> columns_;
+  std::vector<mako::SampleRecord> other_records_;
+  // Reused by Add().
+  std::vector<int> sequence_;
+};
+
+// Decodes data, a FileIO record of a sample file: a SampleColumns block into
+// columns, setting *has_columns, or else a SampleRecord into record. Returns an
+// error message, or the empty string on success.
+std::string DecodeSampleFileRecord(absl::string_view data,
+                                   SampleColumns* columns,
+                                   mako::SampleRecord* record,
+                                   bool* has_columns);
+
+// Reads a sample file whose FileIO records are each a serialized SampleRecord
+// or a SampleColumns block, kReadBatchSize of them per call to the FileIO.
+//
+// Not thread-safe.
+class SampleFileReader {
+ public:
+  // The number of FileIO records read at a time.
+  static constexpr int kReadBatchSize = 64;
+
+  // file_io must stay open for reading while this is used.
+  explicit SampleFileReader(mako::FileIO* file_io) : file_io_(file_io) {}
+
+  // Reads the next SampleRecord or block of the file. Returns false at the
+  // end of the file, or on error, in which case error() is not empty.
+  bool Next();
+
+  // Whether the last call to Next() read a block rather than a record.
+  bool has_columns() const { return has_columns_; }
+
+  // The record read by the last call to Next(), if it did not read a block.
+  const mako::SampleRecord& record() const { return record_; }
+  mako::SampleRecord* mutable_record() { return &record_; }
+
+  // The block read by the last call to Next(), if it read one.
+  const SampleColumns& columns() const { return columns_; }
+  SampleColumns* mutable_columns() { return &columns_; }
+
+  // Reads the next record of the file, taking them from blocks in turn.
+  // Returns false at the end of the file, or on error, in which case error()
+  // is not empty.
+  bool Read(mako::SampleRecord* record);
+
+  // Returns the error of the last call, or the empty string.
+  const std::string& error() const { return error_; }
+
+ private:
+  mako::FileIO* file_io_;
+  bool has_columns_ = false;
+  mako::SampleRecord record_;
+  SampleColumns columns_;
+  // The records of the block being read by Read(), from next_record_ on.
+  std::vector<mako::SampleRecord> block_records_;
+  std::size_t next_record_ = 0;
+  // The FileIO records read, from next_in_batch_ on.
+  std::vector<std::string> batch_;
+  std::size_t next_in_batch_ = 0;
+  std::string error_;
+};
+
+// Writes SampleRecords to a sample file in SampleColumns blocks.
+//
+// Not thread-safe.
+class SampleColumnsWriter {
+ public:
+  // The number of records in each block by default.
+  static constexpr int kDefaultRecordsPerBlock = 4096;
+
+  // file_io must stay open for writing while this is used.
+  explicit SampleColumnsWriter(mako::FileIO* file_io,
+                               int records_per_block = kDefaultRecordsPerBlock)
+      : file_io_(file_io), records_per_block_(records_per_block) {}
+
+  // Adds the record to the current block, writing the block once it is full.
+  // Returns false if the block cannot be written; see file_io->Error().
+  bool Write(const mako::SampleRecord& record);
+
+  // Writes the current block if it has any records. Must be called before the
+  // file is closed. Returns false if the block cannot be written.
+  bool Flush();
+
+ private:
+  mako::FileIO* file_io_;
+  const int records_per_block_;
+  SampleColumns columns_;
+  std::string data_;
+};
+
+}  // namespace internal
+}  // namespace mako
+
+#endif  // CXX_INTERNAL_SAMPLE_COLUMNS_H_
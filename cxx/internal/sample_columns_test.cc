@@ -0,0 +1,363 @@
+// Copyright 2019 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// see the license for the specific language governing permissions and
+// limitations under the license.
+#include "cxx/internal/sample_columns.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "glog/logging.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "cxx/clients/fileio/memory_fileio.h"
+#include "spec/proto/mako.pb.h"
+
+namespace mako {
+namespace internal {
+namespace {
+
+using ::testing::ElementsAre;
+
+mako::SampleRecord Point(
+    double input_value,
+    const std::vector<std::pair<std::string, double>>& metric_values) {
+  mako::SampleRecord record;
+  mako::SamplePoint* point = record.mutable_sample_point();
+  point->set_input_value(input_value);
+  for (const auto& metric_value : metric_values) {
+    mako::KeyedValue* keyed_value = point->add_metric_value_list();
+    keyed_value->set_value_key(metric_value.first);
+    keyed_value->set_value(metric_value.second);
+  }
+  return record;
+}
+
+mako::SampleRecord Error(double input_value) {
+  mako::SampleRecord record;
+  record.mutable_sample_error()->set_input_value(input_value);
+  record.mutable_sample_error()->set_sampler_name("sampler");
+  record.mutable_sample_error()->set_error_message("failed");
+  return record;
+}
+
+// Records that cover what SampleColumns stores by column, and what it does
+// not.
+std::vector<mako::SampleRecord> MixedRecords() {
+  std::vector<mako::SampleRecord> records;
+  records.push_back(Point(1, {{"m1", 1.5}, {"m2", 2}}));
+  records.push_back(Point(2, {{"m1", 1.5}, {"m2", -3}}));
+  records.push_back(Point(3, {{"m2", 0.1}}));
+  records.push_back(Error(3.5));
+  records.push_back(Point(4, {{"m1", -0.0}, {"m1", 7}, {"m3", 1e300}}));
+  records.push_back(Point(5, {}));
+  records.push_back(
+      Point(6, {{"m1", std::numeric_limits<double>::quiet_NaN()},
+                {"m2", std::numeric_limits<double>::infinity()},
+                {"m3", std::numeric_limits<double>::denorm_min()}}));
+  mako::SampleRecord annotated = Point(7, {{"m1", 1}});
+  annotated.mutable_sample_point()->add_sample_annotations_list()->set_text(
+      "note");
+  records.push_back(annotated);
+  mako::SampleRecord aux = Point(8, {{"m1", 1}});
+  (*aux.mutable_sample_point()->mutable_aux_data())["key"] = "data";
+  records.push_back(aux);
+  mako::SampleRecord no_value = Point(9, {{"m1", 1}});
+  no_value.mutable_sample_point()->add_metric_value_list()->set_value_key("m2");
+  records.push_back(no_value);
+  mako::SampleRecord no_input_value;
+  no_input_value.mutable_sample_point()->add_metric_value_list()->set_value(3);
+  records.push_back(no_input_value);
+  mako::SampleRecord both = Point(10, {{"m1", 1}});
+  *both.mutable_sample_error() = Error(10).sample_error();
+  records.push_back(both);
+  records.push_back(mako::SampleRecord());
+  records.push_back(Point(11, {{"m1", 2}, {"m2", 4}}));
+  return records;
+}
+
+// Expects the records to serialize to the same bytes, so that values such as
+// NaN and -0 must be kept exactly.
+void ExpectSameRecords(const std::vector<mako::SampleRecord>& actual,
+                       const std::vector<mako::SampleRecord>& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_EQ(actual[i].SerializeAsString(), expected[i].SerializeAsString())
+        << "record " << i << ": " << actual[i].ShortDebugString() << " vs "
+        << expected[i].ShortDebugString();
+  }
+}
+
+TEST(SampleColumnsTest, ToRecordsIsLossless) {
+  SampleColumns columns;
+  const std::vector<mako::SampleRecord> records = MixedRecords();
+  for (const auto& record : records) {
+    columns.Add(record);
+  }
+  EXPECT_EQ(columns.num_records(), records.size());
+  std::vector<mako::SampleRecord> converted;
+  columns.ToRecords(&converted);
+  ExpectSameRecords(converted, records);
+}
+
+TEST(SampleColumnsTest, EncodeDecodeIsLossless) {
+  SampleColumns columns;
+  const std::vector<mako::SampleRecord> records = MixedRecords();
+  for (const auto& record : records) {
+    columns.Add(record);
+  }
+  std::string data;
+  columns.Encode(&data);
+  EXPECT_TRUE(SampleColumns::IsEncoded(data));
+
+  SampleColumns decoded;
+  ASSERT_EQ(decoded.Decode(data), "");
+  EXPECT_EQ(decoded.num_records(), records.size());
+  std::vector<mako::SampleRecord> converted;
+  decoded.ToRecords(&converted);
+  ExpectSameRecords(converted, records);
+
+  // Encoding the decoded block gives the same bytes.
+  std::string reencoded;
+  decoded.Encode(&reencoded);
+  EXPECT_EQ(reencoded, data);
+}
+
+TEST(SampleColumnsTest, Columns) {
+  SampleColumns columns;
+  columns.Add(Point(1, {{"m1", 10}, {"m2", 20}}));
+  columns.Add(Error(1.5));
+  columns.Add(Point(2, {{"m2", 21}}));
+  columns.Add(Point(3, {{"m1", 12}, {"m2", 22}, {"m1", 13}}));
+  std::string data;
+  columns.Encode(&data);
+  SampleColumns decoded;
+  ASSERT_EQ(decoded.Decode(data), "");
+
+  for (const SampleColumns* c : {&columns, &decoded}) {
+    ASSERT_EQ(c->num_keys(), 2);
+    EXPECT_EQ(c->key(0), "m1");
+    EXPECT_EQ(c->key(1), "m2");
+    EXPECT_THAT(c->input_values(), ElementsAre(1, 2, 3));
+    EXPECT_THAT(c->values(0), ElementsAre(10, 12, 13));
+    EXPECT_THAT(c->value_inputs(0), ElementsAre(1, 3, 3));
+    EXPECT_THAT(c->values(1), ElementsAre(20, 21, 22));
+    EXPECT_THAT(c->value_inputs(1), ElementsAre(1, 2, 3));
+    ASSERT_EQ(c->other_records().size(), 1);
+    EXPECT_TRUE(c->other_records()[0].has_sample_error());
+  }
+}
+
+TEST(SampleColumnsTest, ClearAndReuse) {
+  SampleColumns columns;
+  columns.Add(Point(1, {{"m1", 10}, {"m2", 20}}));
+  columns.Add(Error(2));
+  columns.Clear();
+  EXPECT_EQ(columns.num_records(), 0);
+  columns.Add(Point(3, {{"m2", 30}}));
+  ASSERT_EQ(columns.num_keys(), 1);
+  EXPECT_EQ(columns.key(0), "m2");
+  EXPECT_THAT(columns.values(0), ElementsAre(30));
+  EXPECT_TRUE(columns.other_records().empty());
+  std::vector<mako::SampleRecord> converted;
+  columns.ToRecords(&converted);
+  ExpectSameRecords(converted, {Point(3, {{"m2", 30}})});
+}
+
+TEST(SampleColumnsTest, SerializedRecordIsNotEncoded) {
+  for (const auto& record : MixedRecords()) {
+    EXPECT_FALSE(SampleColumns::IsEncoded(record.SerializeAsString()));
+  }
+}
+
+TEST(SampleColumnsTest, RepeatedValuesEncodeSmall) {
+  SampleColumns columns;
+  for (int i = 0; i < 1000; ++i) {
+    columns.Add(Point(i, {{"m1", 5}, {"m2", 6}}));
+  }
+  std::string data;
+  columns.Encode(&data);
+  // Two bytes or fewer per value, rather than nine in a SampleRecord.
+  EXPECT_LT(data.size(), 1000 * 3 * 2);
+}
+
+TEST(SampleColumnsTest, DecodeCorrupted) {
+  SampleColumns columns;
+  for (const auto& record : MixedRecords()) {
+    columns.Add(record);
+  }
+  std::string data;
+  columns.Encode(&data);
+
+  SampleColumns decoded;
+  for (std::size_t size = 0; size < data.size(); ++size) {
+    EXPECT_NE(decoded.Decode(data.substr(0, size)), "") << size;
+  }
+  EXPECT_NE(decoded.Decode(data + "x"), "");
+  EXPECT_EQ(decoded.Decode(data), "");
+}
+
+TEST(SampleFileReaderTest, ReadsBlocksAndRecords) {
+  mako::memory_fileio::FileIO fileio;
+  const std::vector<mako::SampleRecord> records = MixedRecords();
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kWrite));
+  SampleColumnsWriter writer(&fileio, /*records_per_block=*/4);
+  for (const auto& record : records) {
+    ASSERT_TRUE(writer.Write(record));
+  }
+  ASSERT_TRUE(writer.Flush());
+  // Records may follow blocks in the same file.
+  ASSERT_TRUE(fileio.Write(records[0]));
+  ASSERT_TRUE(fileio.Close());
+
+  std::vector<mako::SampleRecord> expected = records;
+  expected.push_back(records[0]);
+
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kRead));
+  SampleFileReader reader(&fileio);
+  std::vector<mako::SampleRecord> read;
+  int num_blocks = 0;
+  while (reader.Next()) {
+    if (reader.has_columns()) {
+      ++num_blocks;
+      reader.columns().ToRecords(&read);
+    } else {
+      read.push_back(reader.record());
+    }
+  }
+  EXPECT_EQ(reader.error(), "");
+  EXPECT_EQ(num_blocks, (records.size() + 3) / 4);
+  ExpectSameRecords(read, expected);
+  ASSERT_TRUE(fileio.Close());
+
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kRead));
+  SampleFileReader record_reader(&fileio);
+  read.clear();
+  mako::SampleRecord record;
+  while (record_reader.Read(&record)) {
+    read.push_back(record);
+  }
+  EXPECT_EQ(record_reader.error(), "");
+  ExpectSameRecords(read, expected);
+  ASSERT_TRUE(fileio.Close());
+}
+
+TEST(SampleFileReaderTest, ReadsRecordFiles) {
+  mako::memory_fileio::FileIO fileio;
+  const std::vector<mako::SampleRecord> records = MixedRecords();
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kWrite));
+  for (const auto& record : records) {
+    ASSERT_TRUE(fileio.Write(record));
+  }
+  ASSERT_TRUE(fileio.Close());
+
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kRead));
+  SampleFileReader reader(&fileio);
+  std::vector<mako::SampleRecord> read;
+  mako::SampleRecord record;
+  while (reader.Read(&record)) {
+    read.push_back(record);
+  }
+  EXPECT_EQ(reader.error(), "");
+  ExpectSameRecords(read, records);
+}
+
+TEST(SampleFileReaderTest, CorruptedRecord) {
+  mako::memory_fileio::FileIO fileio;
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kWrite));
+  ASSERT_TRUE(fileio.Write(std::string("\0MC\1garbage", 11)));
+  ASSERT_TRUE(fileio.Write("\xff"));
+  ASSERT_TRUE(fileio.Close());
+
+  ASSERT_TRUE(fileio.Open("file", mako::FileIO::AccessMode::kRead));
+  SampleFileReader reader(&fileio);
+  EXPECT_FALSE(reader.Next());
+  EXPECT_THAT(reader.error(), ::testing::HasSubstr("Corrupted"));
+  EXPECT_FALSE(reader.Next());
+  EXPECT_THAT(reader.error(), ::testing::HasSubstr("parse"));
+}
+
+// Returns sample records with three metrics each.
+const std::vector<mako::SampleRecord>& BenchmarkRecords() {
+  static const auto* const records = [] {
+    auto* records = new std::vector<mako::SampleRecord>;
+    for (int i = 0; i < SampleColumnsWriter::kDefaultRecordsPerBlock; ++i) {
+      records->push_back(
+          Point(1000 + i * 10, {{"latency", 100 + i % 7 * 0.25},
+                                {"throughput", 5000 + i % 13},
+                                {"cpu", std::sin(i) * 50}}));
+    }
+    return records;
+  }();
+  return *records;
+}
+
+// Parses a block's worth of serialized SampleRecords and gathers the values of
+// each metric, as the aggregator does for files of records.
+static void BM_ParseRecords(benchmark::State& state) {
+  std::vector<std::string> serialized;
+  int64_t bytes = 0;
+  for (const auto& record : BenchmarkRecords()) {
+    serialized.push_back(record.SerializeAsString());
+    bytes += serialized.back().size();
+  }
+  MetricKeyDictionary keys;
+  std::vector<std::vector<double>> values;
+  mako::SampleRecord record;
+  for (auto _ : state) {
+    for (const std::string& data : serialized) {
+      CHECK(record.ParseFromString(data));
+      for (const auto& metric_value : record.sample_point().metric_value_list()) {
+        const int id = keys.Intern(metric_value.value_key());
+        if (static_cast<std::size_t>(id) >= values.size()) {
+          values.resize(id + 1);
+        }
+        values[id].push_back(metric_value.value());
+      }
+    }
+    for (auto& metric_values : values) {
+      benchmark::DoNotOptimize(metric_values.data());
+      metric_values.clear();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * serialized.size());
+  state.counters["bytes_per_record"] =
+      static_cast<double>(bytes) / serialized.size();
+}
+BENCHMARK(BM_ParseRecords);
+
+// Decodes the same records from a block and takes the span of each metric.
+static void BM_DecodeColumns(benchmark::State& state) {
+  SampleColumns columns;
+  for (const auto& record : BenchmarkRecords()) {
+    columns.Add(record);
+  }
+  std::string data;
+  columns.Encode(&data);
+  for (auto _ : state) {
+    CHECK_EQ(columns.Decode(data), "");
+    for (int key_id = 0; key_id < columns.num_keys(); ++key_id) {
+      benchmark::DoNotOptimize(columns.values(key_id).data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * columns.num_records());
+  state.counters["bytes_per_record"] =
+      static_cast<double>(data.size()) / columns.num_records();
+}
+BENCHMARK(BM_DecodeColumns);
+
+}  // namespace
+}  // namespace internal
+}  // namespace mako
@@ -17,6 +17,7 @@
 // vector to the data and delete as we write to disk.
 #include "cxx/quickstore/internal/store.h"
 
+#include <algorithm>
 #include <functional>
 #include <list>
 #include <map>
@@ -40,11 +41,13 @@
 #include "cxx/clients/analyzers/utest_analyzer.h"
 #include "cxx/clients/analyzers/window_deviation.h"
 #include "cxx/clients/downsampler/standard_downsampler.h"
+#include "cxx/clients/fileio/disk_fileio.h"
 #include "cxx/clients/fileio/memory_fileio.h"
 #include "cxx/clients/storage/mako_client.h" // NOLINT
 #include "cxx/helpers/rolling_window_reducer/rolling_window_reducer_internal.h"
 #include "cxx/helpers/status/status.h"
 #include "cxx/internal/load/common/run_analyzers.h"
+#include "cxx/internal/sample_columns.h"
 #include "cxx/spec/analyzer.h"
 #include "proto/clients/analyzers/threshold_analyzer.pb.h"
 #include "proto/clients/analyzers/utest_analyzer.pb.h"
@@ -61,6 +64,9 @@ using ::mako::quickstore::QuickstoreOutput;
 
 constexpr char kNoError[] = "";
 
+// The number of records passed to each FileIO::WriteBatch().
+constexpr std::size_t kWriteBatchSize = 1024;
+
 QuickstoreOutput Fail(const std::string& msg) {
   QuickstoreOutput output;
   output.set_summary_output(msg);
@@ -329,31 +335,66 @@ std::string InternalQuickstore::WriteSampleFile() {
     LOG(ERROR) << err;
     return err;
   }
+  // Records are passed to the FileIO kWriteBatchSize at a time, or, for
+  // columnar sample files, a SampleColumns block at a time. write_record
+  // buffers a record and flush writes the pending ones; both return an error
+  // message if writing fails.
+  const bool columnar = input_.columnar_sample_files();
+  mako::internal::SampleColumnsWriter columns_writer(fileio_.get());
+  std::vector<std::string> batch;
+  const auto write_error = [this](absl::string_view what) {
+    fileio_->Close();
+    std::string err = absl::StrCat("Could not write ", what, " to path: ",
+                                   file_path_, ". Error: ", fileio_->Error());
+    LOG(ERROR) << err;
+    return err;
+  };
+  const auto flush = [this, columnar, &columns_writer, &batch,
+                      &write_error](absl::string_view what) {
+    if (columnar ? columns_writer.Flush() : fileio_->WriteBatch(batch)) {
+      batch.clear();
+      return std::string(kNoError);
+    }
+    return write_error(what);
+  };
+  const auto write_record = [columnar, &columns_writer, &batch, &flush,
+                             &write_error](
+                                const mako::SampleRecord& sample_record,
+                                absl::string_view what) {
+    if (columnar) {
+      return columns_writer.Write(sample_record) ? std::string(kNoError)
+                                                 : write_error(what);
+    }
+    batch.push_back(sample_record.SerializeAsString());
+    return batch.size() < kWriteBatchSize ? std::string(kNoError) : flush(what);
+  };
   for (const auto& point : points_) {
     mako::SampleRecord sample_record;
     *sample_record.mutable_sample_point() = point;
-    if (!fileio_->Write(sample_record)) {
-      fileio_->Close();
-      err = absl::StrCat("Could not write point to path: ", file_path_,
-                         ". Error: ", fileio_->Error());
-      LOG(ERROR) << err;
+    err = write_record(sample_record, "point");
+    if (!err.empty()) {
       return err;
     }
   }
+  err = flush("point");
+  if (!err.empty()) {
+    return err;
+  }
   for (const auto& error : errors_) {
     mako::SampleRecord sample_record;
     *sample_record.mutable_sample_error() = error;
     if (!sample_record.sample_error().has_sampler_name()) {
       sample_record.mutable_sample_error()->set_sampler_name("quickstore");
     }
-    if (!fileio_->Write(sample_record)) {
-      fileio_->Close();
-      err = absl::StrCat("Could not write error to path: ", file_path_,
-                         ". Error: ", fileio_->Error());
-      LOG(ERROR) << err;
+    err = write_record(sample_record, "error");
+    if (!err.empty()) {
       return err;
     }
   }
+  err = flush("error");
+  if (!err.empty()) {
+    return err;
+  }
 
   // Close to flush the buffer.
   if (!fileio_->Close()) {
@@ -368,9 +409,22 @@ std::string InternalQuickstore::Reduce() {
   if (input_.rwr_configs_size() == 0) {
     return kNoError;
   }
+  // WriteSampleFile writes the points and then the errors, so when each is in
+  // order of input value the reducer can finalize windows as it reads them.
+  const bool input_ordered =
+      std::is_sorted(
+          points_.begin(), points_.end(),
+          [](const mako::SamplePoint& a, const mako::SamplePoint& b) {
+            return a.input_value() < b.input_value();
+          }) &&
+      std::is_sorted(
+          errors_.begin(), errors_.end(),
+          [](const mako::SampleError& a, const mako::SampleError& b) {
+            return a.input_value() < b.input_value();
+          });
   auto status = mako::helpers::Reduce(
       file_path_, {input_.rwr_configs().begin(), input_.rwr_configs().end()},
-      fileio_.get());
+      fileio_.get(), input_ordered, /*max_threads=*/0);
   if (status.ok()) {
     return kNoError;
   }
@@ -590,9 +644,17 @@ QuickstoreOutput SaveWithStorage(
     const std::vector<std::string>& aggregate_value_keys,
     const std::vector<std::string>& aggregate_types,
     const std::vector<double>& aggregate_values) {
+  // Sample files are kept in memory unless the user provides a directory for
+  // them, in which case they are stored on disk so that runs may be larger
+  // than the available memory.
+  std::unique_ptr<mako::FileIO> fileio;
+  if (input.has_temp_dir()) {
+    fileio = absl::make_unique<mako::disk_fileio::FileIO>();
+  } else {
+    fileio = absl::make_unique<mako::memory_fileio::FileIO>();
+  }
   InternalQuickstore quick(
-      storage,
-          absl::make_unique<mako::memory_fileio::FileIO>(),
+      storage, std::move(fileio),
       absl::make_unique<mako::aggregator::Aggregator>(),
       absl::make_unique<mako::downsampler::Downsampler>(), input, points,
       errors, run_aggregates, aggregate_value_keys, aggregate_types,
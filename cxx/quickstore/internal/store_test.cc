@@ -21,10 +21,13 @@
 #include "gtest/gtest.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
 #include "cxx/clients/aggregator/standard_aggregator.h"
 #include "cxx/clients/downsampler/standard_downsampler.h"
+#include "cxx/clients/fileio/disk_fileio.h"
 #include "cxx/clients/fileio/memory_fileio.h"
 #include "cxx/clients/storage/fake_google3_storage.h"
+#include "cxx/internal/sample_columns.h"
 #include "cxx/spec/fileio.h"
 #include "cxx/testing/protocol-buffer-matchers.h"
 #include "proto/clients/analyzers/threshold_analyzer.pb.h"
@@ -155,6 +158,24 @@ class StoreTest : public ::testing::Test {
     return runs[0];
   }
 
+  // Collects the points and errors of all sample batches of the run.
+  void GetSamples(const std::string& run_key,
+                  std::vector<mako::SamplePoint>* points,
+                  std::vector<mako::SampleError>* errors) {
+    mako::fake_google3_storage::Storage s;
+    mako::SampleBatchQuery q;
+    q.set_benchmark_key(benchmark_key_);
+    q.set_run_key(run_key);
+    mako::SampleBatchQueryResponse r;
+    CHECK(s.QuerySampleBatch(q, &r)) << r.status().fail_message();
+    for (const auto& batch : r.sample_batch_list()) {
+      points->insert(points->end(), batch.sample_point_list().begin(),
+                     batch.sample_point_list().end());
+      errors->insert(errors->end(), batch.sample_error_list().begin(),
+                     batch.sample_error_list().end());
+    }
+  }
+
   std::string benchmark_key_;
   std::vector<mako::SamplePoint> points_;
   std::vector<mako::SampleError> errors_;
@@ -234,6 +255,110 @@ TEST_F(StoreTest, PointsAndRWR) {
   EXPECT_TRUE(metrics.contains(kRwrOutputKey));
 }
 
+TEST_F(StoreTest, TempDirStoresSampleFileOnDisk) {
+  input_.set_temp_dir(absl::StrCat(::testing::TempDir(), "/store_test"));
+  input_.set_delete_sample_files(false);
+  auto* rwr_config = input_.add_rwr_configs();
+  rwr_config->add_input_metric_keys(kM1);
+  rwr_config->set_output_metric_key(kRwrOutputKey);
+  rwr_config->set_steps_per_window(1);
+  rwr_config->set_window_size(100);
+  rwr_config->set_window_operation(mako::helpers::RWRConfig::COUNT);
+  rwr_config->set_zero_for_empty_window(true);
+
+  QuickstoreOutput output = Call(input_, points_, errors_, {}, {}, {}, {});
+  ASSERT_EQ(QuickstoreOutput::SUCCESS, output.status())
+      << output.summary_output();
+  ASSERT_THAT(output.generated_sample_files(), testing::SizeIs(Eq(1)));
+
+  // The sample file holds the points, errors and reduced points.
+  mako::disk_fileio::FileIO fileio;
+  ASSERT_TRUE(fileio.Open(output.generated_sample_files(0),
+                          mako::FileIO::AccessMode::kRead))
+      << fileio.Error();
+  std::size_t num_records = 0;
+  mako::SampleRecord record;
+  while (fileio.Read(&record)) {
+    ++num_records;
+  }
+  EXPECT_TRUE(fileio.ReadEOF()) << fileio.Error();
+  EXPECT_GT(num_records, points_.size() + errors_.size());
+  ASSERT_TRUE(fileio.Close());
+  EXPECT_TRUE(fileio.Delete(output.generated_sample_files(0)));
+}
+
+TEST_F(StoreTest, ColumnarSampleFilesMatchRecords) {
+  input_.set_temp_dir(absl::StrCat(::testing::TempDir(), "/store_test"));
+  input_.set_delete_sample_files(false);
+  auto* rwr_config = input_.add_rwr_configs();
+  rwr_config->add_input_metric_keys(kM1);
+  rwr_config->set_output_metric_key(kRwrOutputKey);
+  rwr_config->set_steps_per_window(1);
+  rwr_config->set_window_size(100);
+  rwr_config->set_window_operation(mako::helpers::RWRConfig::COUNT);
+  rwr_config->set_zero_for_empty_window(true);
+
+  // Runs the whole pipeline and sets the run it stored and the records of
+  // its sample file, noting whether the file held any blocks.
+  const auto save = [this](const QuickstoreInput& input, mako::RunInfo* run,
+                           std::vector<mako::SampleRecord>* records,
+                           bool* has_columns) {
+    QuickstoreOutput output = Call(input, points_, errors_, {}, {}, {}, {});
+    ASSERT_EQ(QuickstoreOutput::SUCCESS, output.status())
+        << output.summary_output();
+    *run = FindRun(output.run_key());
+    ASSERT_THAT(output.generated_sample_files(), testing::SizeIs(Eq(1)));
+
+    mako::disk_fileio::FileIO fileio;
+    ASSERT_TRUE(fileio.Open(output.generated_sample_files(0),
+                            mako::FileIO::AccessMode::kRead))
+        << fileio.Error();
+    mako::internal::SampleFileReader reader(&fileio);
+    *has_columns = false;
+    while (reader.Next()) {
+      if (reader.has_columns()) {
+        *has_columns = true;
+        std::vector<mako::SampleRecord> block_records;
+        reader.columns().ToRecords(&block_records);
+        records->insert(records->end(), block_records.begin(),
+                        block_records.end());
+      } else {
+        records->push_back(reader.record());
+      }
+    }
+    EXPECT_EQ("", reader.error());
+    ASSERT_TRUE(fileio.Close());
+    EXPECT_TRUE(fileio.Delete(output.generated_sample_files(0)));
+  };
+  mako::RunInfo run;
+  std::vector<mako::SampleRecord> records;
+  bool has_columns;
+  save(input_, &run, &records, &has_columns);
+  EXPECT_FALSE(has_columns);
+
+  input_.set_columnar_sample_files(true);
+  mako::RunInfo columnar_run;
+  std::vector<mako::SampleRecord> columnar_records;
+  bool columnar_has_columns;
+  save(input_, &columnar_run, &columnar_records, &columnar_has_columns);
+  EXPECT_TRUE(columnar_has_columns);
+
+  // The aggregator, downsampler and reducer read both files the same way.
+  EXPECT_THAT(columnar_records, UnorderedPointwise(EqualsProto(), records));
+  EXPECT_THAT(columnar_run.aggregate().run_aggregate(),
+              EqualsProto(run.aggregate().run_aggregate()));
+  EXPECT_THAT(columnar_run.aggregate().metric_aggregate_list(),
+              UnorderedPointwise(EqualsProto(),
+                                 run.aggregate().metric_aggregate_list()));
+  std::vector<mako::SamplePoint> points, columnar_points;
+  std::vector<mako::SampleError> errors, columnar_errors;
+  GetSamples(run.run_key(), &points, &errors);
+  GetSamples(columnar_run.run_key(), &columnar_points, &columnar_errors);
+  EXPECT_THAT(points, testing::Not(IsEmpty()));
+  EXPECT_THAT(columnar_points, UnorderedPointwise(EqualsProto(), points));
+  EXPECT_THAT(columnar_errors, UnorderedPointwise(EqualsProto(), errors));
+}
+
 TEST_F(StoreTest, ErrorsOnly) {
   QuickstoreOutput output = Call(input_, {}, errors_, {}, {}, {}, {});
   ASSERT_EQ(QuickstoreOutput::SUCCESS, output.status());
@@ -17,6 +17,7 @@
 #include <stddef.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "src/google/protobuf/message.h"
 #include "absl/strings/string_view.h"
@@ -78,6 +79,23 @@ class FileIO {
   // Overload exposed for CLIF and SWIG.
   virtual bool Write(absl::string_view serialized_record) = 0;
 
+  // WriteBatch appends the given records to the opened file, in order.
+  //
+  // This instance must be writable when calling WriteBatch(). The default
+  // implementation calls Write() for each record; implementations may override
+  // it to take locks or copy data once per batch rather than once per record.
+  //
+  // Returns true for success. If false is returned, call Error() to get the
+  // error message; the records before the failed one may have been written.
+  virtual bool WriteBatch(const std::vector<std::string>& serialized_records) {
+    for (const std::string& serialized_record : serialized_records) {
+      if (!Write(serialized_record)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   // Read reads the next record in the opened file.
   //
   // This instance must be readable mode when calling Read().
@@ -100,7 +118,42 @@ class FileIO {
   // Overload exposed for CLIF and SWIG.
   virtual bool Read(std::string* serialized_record) = 0;
 
-  // Returns true if last call to Read() returned false and reached EOF.
+  // ReadBatch reads the next records in the opened file, up to max_records of
+  // them, into serialized_records, replacing its contents. The strings of
+  // serialized_records are reused, so passing the same vector each time saves
+  // allocations.
+  //
+  // This instance must be readable when calling ReadBatch(). The default
+  // implementation calls Read() for each record; implementations may override
+  // it to take locks or copy data once per batch rather than once per record.
+  //
+  // Returns true if any records were read; fewer than max_records are read only
+  // at the end of the file. If false is returned, it could be due to EOF or
+  // error, as for Read():
+  //   std::vector<std::string> batch;
+  //   while (rrw.ReadBatch(100, &batch)) {
+  //     // handle batch
+  //   }
+  //   if (!rrw.ReadEOF()) {
+  //     log << rrw.Error();
+  //     // handle error
+  //   }
+  virtual bool ReadBatch(int max_records,
+                         std::vector<std::string>* serialized_records) {
+    serialized_records->resize(max_records);
+    int count = 0;
+    while (count < max_records && Read(&(*serialized_records)[count])) {
+      ++count;
+    }
+    if (count < max_records && !ReadEOF()) {
+      count = 0;
+    }
+    serialized_records->resize(count);
+    return count > 0;
+  }
+
+  // Returns true if last call to Read() or ReadBatch() returned false and
+  // reached EOF.
   virtual bool ReadEOF() = 0;
 
   // Returns the error message for the most recent failed call.
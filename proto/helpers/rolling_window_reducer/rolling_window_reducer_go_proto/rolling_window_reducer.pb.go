@@ -85,6 +85,7 @@ type RWRConfig struct {
 	PercentileMilli            *int32                     `protobuf:"varint,7,opt,name=percentile_milli,json=percentileMilli" json:"percentile_milli,omitempty"`
 	OutputScalingFactor        *float64                   `protobuf:"fixed64,12,opt,name=output_scaling_factor,json=outputScalingFactor,def=1" json:"output_scaling_factor,omitempty"`
 	MaxSampleSize              *int32                     `protobuf:"varint,8,opt,name=max_sample_size,json=maxSampleSize,def=-1" json:"max_sample_size,omitempty"`
+	QuantileSketchK            *int32                     `protobuf:"varint,13,opt,name=quantile_sketch_k,json=quantileSketchK" json:"quantile_sketch_k,omitempty"`
 	ErrorMatcher               *string                    `protobuf:"bytes,11,opt,name=error_matcher,json=errorMatcher" json:"error_matcher,omitempty"`
 	XXX_NoUnkeyedLiteral       struct{}                   `json:"-"`
 	XXX_unrecognized           []byte                     `json:"-"`
@@ -197,6 +198,13 @@ func (m *RWRConfig) GetMaxSampleSize() int32 {
 	return Default_RWRConfig_MaxSampleSize
 }
 
+func (m *RWRConfig) GetQuantileSketchK() int32 {
+	if m != nil && m.QuantileSketchK != nil {
+		return *m.QuantileSketchK
+	}
+	return 0
+}
+
 func (m *RWRConfig) GetErrorMatcher() string {
 	if m != nil && m.ErrorMatcher != nil {
 		return *m.ErrorMatcher
@@ -302,43 +310,44 @@ func init() {
 }
 
 var fileDescriptor_dffccf54472da3d3 = []byte{
-	// 607 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x94, 0x53, 0x5b, 0x4f, 0xdb, 0x3e,
-	0x14, 0x57, 0x5a, 0x0a, 0xf4, 0x14, 0x68, 0xf0, 0x5f, 0xfc, 0x15, 0x90, 0xa6, 0x55, 0xdd, 0xc3,
-	0x3a, 0xd0, 0xc2, 0x40, 0xda, 0xc3, 0xf6, 0x56, 0xaa, 0xa0, 0xa1, 0xd1, 0x8b, 0x5c, 0x10, 0x8f,
-	0x56, 0x94, 0x9e, 0x16, 0x8b, 0x38, 0x8e, 0x6c, 0xa3, 0x02, 0x1f, 0x71, 0x9f, 0x6a, 0xb2, 0x1d,
-	0x18, 0x17, 0xed, 0x61, 0x6f, 0xc9, 0xef, 0x76, 0x7c, 0xce, 0xb1, 0xa1, 0x5f, 0x2a, 0x69, 0xe4,
-	0xe1, 0x35, 0xe6, 0x25, 0x2a, 0x7d, 0xa8, 0x64, 0x9e, 0xf3, 0x62, 0xc1, 0x96, 0xbc, 0x98, 0xc9,
-	0x25, 0x53, 0x38, 0xbb, 0xcd, 0x50, 0xfd, 0x05, 0x8e, 0x9d, 0x97, 0x6c, 0x88, 0xf4, 0x46, 0xc6,
-	0x55, 0xc2, 0xde, 0x8e, 0x2e, 0x31, 0x3b, 0xf4, 0xa9, 0x8e, 0x70, 0x9f, 0xdd, 0x5f, 0x0d, 0x68,
-	0xd2, 0x2b, 0x3a, 0x90, 0xc5, 0x9c, 0x2f, 0xc8, 0x3e, 0x6c, 0xf3, 0xa2, 0xbc, 0x35, 0x4c, 0xa0,
-	0x51, 0x3c, 0x63, 0x37, 0x78, 0xaf, 0xa3, 0xa0, 0x53, 0xef, 0x35, 0x69, 0xdb, 0x11, 0x43, 0x87,
-	0xff, 0xc4, 0x7b, 0x4d, 0xfa, 0xf0, 0x6e, 0x86, 0x85, 0x14, 0xbc, 0x48, 0x8d, 0x54, 0xec, 0xad,
-	0xaf, 0xe9, 0x7c, 0x7b, 0xcf, 0x44, 0x67, 0xaf, 0x22, 0xbe, 0xc1, 0x2e, 0x2a, 0x25, 0x15, 0xd3,
-	0xa9, 0x28, 0x73, 0x54, 0xac, 0x48, 0x05, 0xfa, 0x24, 0x1d, 0x81, 0xb3, 0xff, 0xef, 0x04, 0x53,
-	0xcf, 0x8f, 0x52, 0x81, 0x2e, 0x43, 0xdb, 0x93, 0xca, 0x5b, 0xf3, 0xb2, 0x64, 0x54, 0xeb, 0x04,
-	0xf6, 0xa4, 0x9e, 0x78, 0xaa, 0x43, 0x28, 0x84, 0xd5, 0x80, 0x64, 0x89, 0x2a, 0x35, 0x5c, 0x16,
-	0x51, 0xbd, 0x13, 0xf4, 0xb6, 0x8e, 0x3f, 0xc6, 0xcf, 0x67, 0x14, 0x3f, 0x0d, 0x22, 0xbe, 0x72,
-	0xfa, 0xf1, 0xa3, 0x9c, 0xb6, 0x97, 0x2f, 0x01, 0xf2, 0x1e, 0x5a, 0x55, 0xa6, 0xe6, 0x0f, 0x18,
-	0xad, 0x74, 0x82, 0x5e, 0x40, 0xc1, 0x43, 0x53, 0xfe, 0x80, 0xe4, 0x00, 0x42, 0x6d, 0xb0, 0xd4,
-	0xac, 0x44, 0x55, 0xed, 0x27, 0x6a, 0x74, 0x82, 0x5e, 0xe3, 0x7b, 0x70, 0x44, 0xb7, 0x1c, 0x35,
-	0x41, 0xe5, 0xeb, 0x90, 0x23, 0xd8, 0x79, 0x40, 0x25, 0xd9, 0x5c, 0x2a, 0x86, 0xa2, 0x34, 0xf7,
-	0x8f, 0x8e, 0xd5, 0x4e, 0xd0, 0x5b, 0xa7, 0xc4, 0x92, 0xa7, 0x52, 0x25, 0x96, 0xaa, 0x2c, 0x9f,
-	0x20, 0x2c, 0x51, 0x65, 0x58, 0x18, 0x9e, 0x23, 0x13, 0x3c, 0xcf, 0x79, 0xb4, 0x66, 0xf3, 0x69,
-	0xfb, 0x0f, 0x3e, 0xb4, 0x30, 0xf9, 0x0a, 0x3b, 0xd5, 0xac, 0x74, 0x96, 0xba, 0xfb, 0x32, 0x4f,
-	0x33, 0x23, 0x55, 0xb4, 0x61, 0x4f, 0x6d, 0xcf, 0xf3, 0x9f, 0xe7, 0xa7, 0x9e, 0x3e, 0x75, 0x2c,
-	0xd9, 0x87, 0xb6, 0x48, 0xef, 0xaa, 0xdd, 0xf8, 0x36, 0xd7, 0x5d, 0x03, 0xb5, 0xcf, 0x47, 0x74,
-	0x53, 0xa4, 0x77, 0x7e, 0x2b, 0xae, 0xdb, 0x0f, 0xb0, 0xe9, 0x37, 0x29, 0x52, 0x93, 0x5d, 0xa3,
-	0x8a, 0x5a, 0x6e, 0x15, 0x1b, 0x0e, 0x1c, 0x7a, 0xac, 0xcb, 0xa0, 0xfd, 0x6a, 0xae, 0xa4, 0x09,
-	0x8d, 0xc1, 0xf8, 0x72, 0x74, 0x11, 0x06, 0x64, 0x0d, 0xea, 0xd3, 0xcb, 0x61, 0x58, 0x23, 0xeb,
-	0xb0, 0x32, 0x4c, 0xfa, 0xa3, 0xb0, 0x4e, 0xb6, 0x00, 0x26, 0x09, 0x1d, 0x24, 0xa3, 0x8b, 0xb3,
-	0xf3, 0x24, 0x5c, 0x21, 0x9b, 0xd0, 0xa4, 0xfd, 0x8b, 0xb3, 0x31, 0xb3, 0xc2, 0x06, 0x69, 0x43,
-	0x2b, 0xa1, 0x74, 0x4c, 0x99, 0x8f, 0x58, 0xed, 0x2e, 0x61, 0x9b, 0x5e, 0xd1, 0xfe, 0x6c, 0x36,
-	0x91, 0xbc, 0x30, 0xda, 0x5d, 0x15, 0xf2, 0x05, 0xa0, 0xb4, 0xbf, 0x2c, 0xe7, 0xda, 0xb8, 0xcb,
-	0xdc, 0x3a, 0xde, 0xf6, 0x7b, 0xf7, 0x0d, 0x38, 0x31, 0x6d, 0x3a, 0xd1, 0x39, 0xd7, 0xce, 0xe1,
-	0x9b, 0x71, 0x8e, 0xda, 0x5b, 0x47, 0x62, 0x59, 0xda, 0x74, 0x22, 0xeb, 0xe8, 0x26, 0xae, 0xf0,
-	0x40, 0x5a, 0xd2, 0xe0, 0xd8, 0x0d, 0xf3, 0xdf, 0x0b, 0x9f, 0xfc, 0x80, 0x83, 0x4c, 0x8a, 0x78,
-	0x21, 0xe5, 0x22, 0xc7, 0xd8, 0xa0, 0x36, 0xbc, 0x58, 0xc4, 0x25, 0xaa, 0xb9, 0x54, 0x22, 0x2d,
-	0x32, 0x7c, 0x71, 0x5d, 0x4f, 0x76, 0xa9, 0x7f, 0xfe, 0x7e, 0xa8, 0xd4, 0x3f, 0xfe, 0x89, 0x7d,
-	0xd6, 0xbf, 0x03, 0x00, 0x00, 0xff, 0xff, 0x31, 0x84, 0x17, 0xfd, 0x3f, 0x04, 0x00, 0x00,
+	// 615 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x54, 0xcb, 0x4f, 0xdb, 0x30,
+	0x18, 0x57, 0x5f, 0x40, 0xbf, 0x52, 0x1a, 0x3c, 0x31, 0x05, 0xa4, 0x69, 0xa8, 0x3b, 0xec, 0x81,
+	0x16, 0x56, 0xa4, 0x1d, 0xb6, 0x5b, 0xa9, 0x82, 0x86, 0xa0, 0x0f, 0xb9, 0x20, 0x8e, 0x56, 0x94,
+	0x9a, 0x12, 0x35, 0x89, 0x33, 0xdb, 0x55, 0x07, 0x7f, 0xf8, 0xce, 0xb3, 0x3f, 0x07, 0xc6, 0x43,
+	0x3b, 0xec, 0x96, 0xfc, 0x1e, 0xdf, 0x5b, 0x86, 0x7e, 0x21, 0x85, 0x16, 0x87, 0x37, 0x3c, 0x2d,
+	0xb8, 0x54, 0x87, 0x52, 0xa4, 0x69, 0x92, 0xcf, 0xd9, 0x2a, 0xc9, 0x67, 0x62, 0xc5, 0x24, 0x9f,
+	0x2d, 0x63, 0x2e, 0xff, 0x01, 0x07, 0xe8, 0x25, 0x9b, 0x59, 0xb4, 0x10, 0x41, 0x19, 0x61, 0x6f,
+	0x47, 0x15, 0x3c, 0x3e, 0x74, 0x51, 0x91, 0xc0, 0xcf, 0xee, 0xef, 0x06, 0x34, 0xe9, 0x15, 0x1d,
+	0x88, 0xfc, 0x3a, 0x99, 0x93, 0x4f, 0xb0, 0x9d, 0xe4, 0xc5, 0x52, 0xb3, 0x8c, 0x6b, 0x99, 0xc4,
+	0x6c, 0xc1, 0x6f, 0x95, 0x5f, 0xd9, 0xaf, 0x7d, 0x68, 0xd2, 0x0e, 0x12, 0x43, 0xc4, 0xcf, 0x0c,
+	0x4c, 0xfa, 0xf0, 0x66, 0xc6, 0x73, 0x91, 0x25, 0x79, 0xa4, 0x85, 0x64, 0x2f, 0x7d, 0x4d, 0xf4,
+	0xed, 0x3d, 0x12, 0x9d, 0x3e, 0x0b, 0xf1, 0x0d, 0x76, 0xb9, 0x94, 0xc6, 0xac, 0xa2, 0xac, 0x48,
+	0xb9, 0x64, 0x79, 0x94, 0x71, 0x17, 0x49, 0xf9, 0x80, 0xf6, 0xd7, 0x28, 0x98, 0x3a, 0x7e, 0x64,
+	0x68, 0x8c, 0xa1, 0x6c, 0xa5, 0x62, 0xa9, 0x9f, 0xa6, 0xf4, 0xab, 0xfb, 0x15, 0x5b, 0xa9, 0x23,
+	0x1e, 0xf2, 0x10, 0x0a, 0x5e, 0x39, 0x20, 0x61, 0x46, 0x11, 0xe9, 0x44, 0xe4, 0x7e, 0xcd, 0x48,
+	0xb7, 0x8e, 0xde, 0x07, 0x8f, 0x67, 0x14, 0x3c, 0x0c, 0x22, 0xb8, 0x42, 0xfd, 0xf8, 0x5e, 0x4e,
+	0x3b, 0xab, 0xa7, 0x00, 0x79, 0x0b, 0xad, 0x32, 0xa6, 0x4a, 0xee, 0xb8, 0x5f, 0x37, 0xe1, 0x2a,
+	0x14, 0x1c, 0x34, 0x35, 0x08, 0x39, 0x00, 0x4f, 0x69, 0x5e, 0x28, 0x66, 0x2c, 0xe5, 0x7e, 0xfc,
+	0x86, 0x51, 0x35, 0xbe, 0x57, 0x7a, 0x74, 0x0b, 0xa9, 0x09, 0x97, 0x2e, 0x0f, 0xe9, 0xc1, 0xce,
+	0x1d, 0x97, 0x82, 0x5d, 0x9b, 0x59, 0xf0, 0xac, 0xd0, 0xb7, 0xf7, 0x8e, 0x35, 0xe3, 0xd8, 0xa0,
+	0xc4, 0x92, 0x27, 0x42, 0x86, 0x96, 0x2a, 0x2d, 0x1f, 0xc1, 0x33, 0x91, 0x63, 0x9e, 0xeb, 0x24,
+	0xe5, 0x2c, 0x4b, 0xcc, 0x21, 0xf8, 0xeb, 0x36, 0x3e, 0xed, 0xfc, 0xc5, 0x87, 0x16, 0x26, 0x5f,
+	0x61, 0xa7, 0x9c, 0x95, 0x8a, 0x23, 0xbc, 0x97, 0xeb, 0x28, 0x36, 0xeb, 0xf0, 0x37, 0x6d, 0xd5,
+	0xb6, 0x9e, 0x57, 0x8e, 0x9f, 0x3a, 0xfa, 0x04, 0x59, 0x33, 0xe2, 0x4e, 0x16, 0xfd, 0x2a, 0x77,
+	0xe3, 0xda, 0xdc, 0xc0, 0x06, 0xaa, 0x9f, 0x7b, 0xb4, 0x6d, 0x28, 0xb7, 0x15, 0xec, 0xd6, 0xac,
+	0xe3, 0xe7, 0x32, 0x72, 0xb5, 0xa8, 0x05, 0xd7, 0xf1, 0x0d, 0x5b, 0xf8, 0x6d, 0x57, 0xce, 0x3d,
+	0x31, 0x45, 0xfc, 0x8c, 0xbc, 0x83, 0xb6, 0xdb, 0x7a, 0x16, 0x99, 0x7f, 0x2e, 0xfd, 0x16, 0xae,
+	0x6d, 0x13, 0xc1, 0xa1, 0xc3, 0xba, 0x0c, 0x3a, 0xcf, 0x76, 0x40, 0x9a, 0xd0, 0x18, 0x8c, 0x2f,
+	0x47, 0x17, 0x5e, 0x85, 0xac, 0x43, 0x6d, 0x7a, 0x39, 0xf4, 0xaa, 0x64, 0x03, 0xea, 0xc3, 0xb0,
+	0x3f, 0xf2, 0x6a, 0x64, 0x0b, 0x60, 0x12, 0xd2, 0x41, 0x38, 0xba, 0x38, 0x3d, 0x0f, 0xbd, 0x3a,
+	0x69, 0x9b, 0xbb, 0xee, 0x5f, 0x9c, 0x8e, 0x99, 0x15, 0x36, 0x48, 0x07, 0x5a, 0x21, 0xa5, 0x63,
+	0xca, 0x5c, 0x88, 0xb5, 0xee, 0x0a, 0xb6, 0xcd, 0xba, 0xfb, 0xb3, 0xd9, 0x44, 0x24, 0xb9, 0x56,
+	0x78, 0x56, 0xe4, 0x0b, 0x40, 0x61, 0x7f, 0x59, 0x9a, 0x28, 0x8d, 0x87, 0xdf, 0x3a, 0xda, 0x76,
+	0x37, 0xe2, 0x9a, 0x45, 0x31, 0x6d, 0xa2, 0xe8, 0xdc, 0x68, 0xac, 0xc3, 0x35, 0x83, 0x8e, 0xea,
+	0x4b, 0x47, 0x68, 0x59, 0xda, 0x44, 0x91, 0x75, 0x74, 0x43, 0x4c, 0x3c, 0x10, 0x96, 0xd4, 0x7c,
+	0x8c, 0x83, 0xff, 0xff, 0xc4, 0xc7, 0x3f, 0xe0, 0x20, 0x16, 0x59, 0x30, 0x17, 0x62, 0x9e, 0xf2,
+	0x40, 0x73, 0xa5, 0xcd, 0xe6, 0x02, 0x33, 0x2c, 0x73, 0x43, 0x59, 0x94, 0xc7, 0xfc, 0xc9, 0x69,
+	0x1f, 0xef, 0x52, 0xf7, 0x54, 0xb8, 0xa1, 0x52, 0xf7, 0x50, 0x4c, 0xec, 0x13, 0xf0, 0x07, 0x75,
+	0x44, 0x69, 0x69, 0x6b, 0x04, 0x00, 0x00,
 }
@@ -84,6 +84,7 @@ type QuickstoreInput struct {
 	IgnoreRangeList       []*mako_go_proto.LabeledRange                         `protobuf:"bytes,9,rep,name=ignore_range_list,json=ignoreRangeList" json:"ignore_range_list,omitempty"`
 	TempDir               *string                                               `protobuf:"bytes,21,opt,name=temp_dir,json=tempDir" json:"temp_dir,omitempty"`
 	DeleteSampleFiles     *bool                                                 `protobuf:"varint,22,opt,name=delete_sample_files,json=deleteSampleFiles,def=1" json:"delete_sample_files,omitempty"`
+	ColumnarSampleFiles   *bool                                                 `protobuf:"varint,25,opt,name=columnar_sample_files,json=columnarSampleFiles" json:"columnar_sample_files,omitempty"`
 	AnalysisPass          *QuickstoreInput_ConditionalFields                    `protobuf:"bytes,10,opt,name=analysis_pass,json=analysisPass" json:"analysis_pass,omitempty"`
 	AnalysisFail          *QuickstoreInput_ConditionalFields                    `protobuf:"bytes,11,opt,name=analysis_fail,json=analysisFail" json:"analysis_fail,omitempty"`
 	RwrConfigs            []*rolling_window_reducer_go_proto.RWRConfig          `protobuf:"bytes,23,rep,name=rwr_configs,json=rwrConfigs" json:"rwr_configs,omitempty"`
@@ -227,6 +228,13 @@ func (m *QuickstoreInput) GetDeleteSampleFiles() bool {
 	return Default_QuickstoreInput_DeleteSampleFiles
 }
 
+func (m *QuickstoreInput) GetColumnarSampleFiles() bool {
+	if m != nil && m.ColumnarSampleFiles != nil {
+		return *m.ColumnarSampleFiles
+	}
+	return false
+}
+
 func (m *QuickstoreInput) GetAnalysisPass() *QuickstoreInput_ConditionalFields {
 	if m != nil {
 		return m.AnalysisPass
@@ -397,65 +405,65 @@ func init() {
 func init() { proto.RegisterFile("proto/quickstore/quickstore.proto", fileDescriptor_1383215e6ee55b1f) }
 
 var fileDescriptor_1383215e6ee55b1f = []byte{
-	// 948 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa4, 0x54, 0x6d, 0x6f, 0xdb, 0x36,
-	0x17, 0x85, 0x13, 0xc7, 0x2f, 0xf4, 0x9b, 0xc2, 0x24, 0x8d, 0x1a, 0xe0, 0x01, 0xdc, 0x3c, 0x1b,
-	0x6a, 0xac, 0x9b, 0x32, 0x64, 0x45, 0xb1, 0x0d, 0xc3, 0x30, 0xcf, 0x69, 0x80, 0x64, 0x69, 0xbb,
-	0xd1, 0x2e, 0x82, 0x7d, 0x12, 0x18, 0x91, 0xb1, 0x09, 0x4b, 0x94, 0x46, 0x52, 0x75, 0xbc, 0xff,
-	0xb3, 0x9f, 0xb7, 0xff, 0x30, 0xf0, 0x52, 0x96, 0xe3, 0xb4, 0xd9, 0x97, 0x7d, 0x23, 0xcf, 0x3d,
-	0xe7, 0x90, 0xf7, 0x92, 0xf7, 0xa2, 0x67, 0x99, 0x4a, 0x4d, 0x7a, 0xf2, 0x47, 0x2e, 0xa2, 0xb9,
-	0x36, 0xa9, 0xe2, 0xf7, 0x96, 0x01, 0xc4, 0x70, 0x2f, 0xa1, 0xf3, 0x34, 0x58, 0xc3, 0x47, 0x5f,
-	0x3b, 0x4d, 0x14, 0x0b, 0x2e, 0x8d, 0x3e, 0xa1, 0x92, 0xc6, 0xcb, 0x3f, 0xb9, 0xd2, 0x27, 0x66,
-	0xa6, 0xb8, 0x9e, 0xa5, 0x31, 0x0b, 0x57, 0x98, 0xb3, 0x38, 0xfa, 0xf2, 0x31, 0x45, 0x6e, 0xb8,
-	0x36, 0x0f, 0xd9, 0xc1, 0x63, 0xec, 0x85, 0x90, 0x2c, 0x5d, 0x84, 0x8c, 0x7f, 0x10, 0xd4, 0x88,
-	0x54, 0x16, 0xfc, 0xa1, 0xe3, 0xcf, 0x78, 0x9c, 0x59, 0x96, 0x4a, 0xe3, 0x58, 0xc8, 0x69, 0x58,
-	0xb0, 0x15, 0x67, 0x79, 0xc4, 0xd5, 0x23, 0x70, 0x61, 0x71, 0xa0, 0x33, 0x1e, 0x9d, 0x38, 0x1f,
-	0x48, 0x17, 0x96, 0xc7, 0x7f, 0x35, 0x51, 0xef, 0xb7, 0x32, 0xf1, 0x0b, 0x99, 0xe5, 0x06, 0xff,
-	0x1f, 0x75, 0x6e, 0xb8, 0x8c, 0x66, 0x09, 0x55, 0xf3, 0x70, 0xce, 0x97, 0x7e, 0xa5, 0x5f, 0x19,
-	0x34, 0x49, 0xbb, 0x04, 0x7f, 0xe1, 0x4b, 0xfc, 0x0c, 0xb5, 0x8d, 0x48, 0xb8, 0x36, 0x34, 0xc9,
-	0xc2, 0x44, 0xfb, 0x5b, 0xfd, 0xca, 0xa0, 0x42, 0x5a, 0x25, 0xf6, 0x46, 0xe3, 0xa7, 0xa8, 0x71,
-	0x93, 0x8b, 0x98, 0x85, 0x82, 0xf9, 0xfb, 0xfd, 0xca, 0x60, 0x9b, 0xd4, 0x61, 0x7f, 0xc1, 0xf0,
-	0x00, 0x79, 0x2c, 0x57, 0x90, 0x62, 0x68, 0x25, 0xd6, 0x61, 0x1b, 0x1c, 0xba, 0x2b, 0x7c, 0x22,
-	0x12, 0xfe, 0x46, 0x63, 0x8c, 0xaa, 0x86, 0x4e, 0xb5, 0x5f, 0xed, 0x6f, 0x0f, 0x9a, 0x04, 0xd6,
-	0xf8, 0x15, 0x3a, 0x9c, 0x09, 0x7b, 0x61, 0x11, 0xd1, 0x38, 0x8c, 0x52, 0x69, 0xf8, 0x9d, 0x09,
-	0x81, 0xe6, 0x03, 0xed, 0x60, 0x1d, 0x1e, 0xb9, 0xe8, 0xc4, 0xea, 0xfe, 0x87, 0xd0, 0x2c, 0xfd,
-	0xc0, 0x55, 0x68, 0x11, 0xbf, 0x0b, 0x59, 0x35, 0x01, 0x99, 0xf0, 0x3b, 0x83, 0xfb, 0xa8, 0xc5,
-	0xb8, 0x8e, 0x94, 0xc8, 0xec, 0xf9, 0x7e, 0x0d, 0xe2, 0xf7, 0x21, 0xdc, 0x47, 0x6d, 0x78, 0xce,
-	0x8c, 0x6a, 0x6d, 0xb3, 0xc2, 0x40, 0x41, 0x16, 0xfb, 0x95, 0x6a, 0x7d, 0xc1, 0xf0, 0x0f, 0xa8,
-	0x47, 0xa5, 0x4c, 0x8d, 0x4b, 0x2d, 0x16, 0xda, 0xf8, 0xf5, 0xfe, 0xf6, 0xa0, 0x75, 0xba, 0x17,
-	0x40, 0xd5, 0x49, 0x2e, 0x87, 0x65, 0x9c, 0x74, 0xd7, 0xdc, 0x2b, 0xa1, 0x0d, 0x7e, 0x85, 0xba,
-	0xb3, 0x65, 0xc6, 0x55, 0x2c, 0xe4, 0xdc, 0x89, 0x1b, 0x20, 0xee, 0x39, 0xf1, 0x5b, 0x9a, 0x70,
-	0x76, 0x46, 0x0d, 0x25, 0x9d, 0x92, 0x06, 0xba, 0x2f, 0x50, 0x83, 0xe6, 0x77, 0x21, 0xa3, 0x86,
-	0xfa, 0xbb, 0x9f, 0x56, 0xd4, 0x69, 0x7e, 0x67, 0x17, 0xf8, 0x47, 0xb4, 0x2b, 0xa6, 0x32, 0x55,
-	0x3c, 0x54, 0x54, 0x4e, 0xb9, 0x3b, 0xa6, 0x09, 0x22, 0xec, 0x44, 0x57, 0xf4, 0x86, 0xc7, 0x9c,
-	0x11, 0x1b, 0x26, 0x3d, 0x47, 0x86, 0x0d, 0x9c, 0xf5, 0x14, 0x35, 0x0c, 0x4f, 0xb2, 0x90, 0x09,
-	0xe5, 0x1f, 0x40, 0xfe, 0x75, 0xbb, 0x3f, 0x13, 0x0a, 0xbf, 0x44, 0x7b, 0x8c, 0xc7, 0xdc, 0xf0,
-	0x50, 0xd3, 0x24, 0x8b, 0x79, 0x78, 0x2b, 0x62, 0xae, 0xfd, 0x27, 0xfd, 0xca, 0xa0, 0xf1, 0x7d,
-	0xd5, 0xa8, 0x9c, 0x93, 0x5d, 0x47, 0x18, 0x43, 0xfc, 0xdc, 0x86, 0xf1, 0x35, 0xea, 0x40, 0x03,
-	0x68, 0xa1, 0xa1, 0xb0, 0x3e, 0xea, 0x57, 0x06, 0xad, 0xd3, 0xd3, 0xe0, 0x41, 0x57, 0x06, 0x0f,
-	0xfe, 0x69, 0x30, 0x4a, 0x25, 0x13, 0xb6, 0x76, 0x34, 0x3e, 0x17, 0x3c, 0x66, 0x9a, 0xb4, 0x57,
-	0x46, 0xf6, 0x35, 0x36, 0x8c, 0x6f, 0xa9, 0x88, 0xfd, 0xd6, 0x7f, 0x37, 0x3e, 0xa7, 0x22, 0xc6,
-	0xdf, 0xa2, 0x96, 0x5a, 0x28, 0xfb, 0xf1, 0x6e, 0xc5, 0x54, 0xfb, 0x87, 0x50, 0xbc, 0x43, 0x67,
-	0x5b, 0xf4, 0x68, 0x40, 0xae, 0xc9, 0x08, 0xe2, 0x04, 0xa9, 0x85, 0x72, 0x4b, 0x8d, 0x19, 0xf2,
-	0xd6, 0x23, 0x44, 0xd8, 0xc3, 0xb4, 0xdf, 0x06, 0xf9, 0x77, 0x4e, 0x5e, 0x8e, 0x82, 0xe0, 0x13,
-	0xa3, 0x66, 0xb2, 0x82, 0x86, 0x05, 0x02, 0xd7, 0x25, 0xbd, 0x92, 0x0a, 0x7b, 0x8d, 0x2f, 0x11,
-	0x5a, 0x30, 0xba, 0xf2, 0xef, 0x80, 0xff, 0x0b, 0xe7, 0xff, 0xd1, 0x80, 0xb9, 0x06, 0xe0, 0x6c,
-	0xb5, 0x77, 0x8e, 0xcd, 0x05, 0xa3, 0xa5, 0x57, 0xdb, 0x8d, 0xb0, 0xc2, 0xcd, 0x03, 0xb7, 0xe7,
-	0xce, 0xed, 0xc1, 0x70, 0x7b, 0x3f, 0xe1, 0xda, 0x6c, 0xde, 0xad, 0x05, 0x14, 0xe7, 0x75, 0xf4,
-	0x1c, 0xed, 0x7e, 0x54, 0xda, 0xb2, 0xc1, 0x2b, 0xeb, 0x06, 0xbf, 0xac, 0x36, 0x7a, 0x9e, 0x77,
-	0x59, 0x6d, 0xec, 0x79, 0xfb, 0x97, 0xd5, 0xc6, 0x8e, 0x57, 0x3b, 0xfe, 0x7b, 0x0b, 0x79, 0xeb,
-	0x67, 0x7a, 0x97, 0x1b, 0x3b, 0xa8, 0x7e, 0x42, 0x35, 0x6d, 0xa8, 0xc9, 0x35, 0x4c, 0xa8, 0xee,
-	0xe9, 0xe0, 0x5f, 0x5e, 0xd6, 0x49, 0x82, 0x31, 0xf0, 0x49, 0xa1, 0xc3, 0xe7, 0x68, 0x7f, 0x75,
-	0xfb, 0x30, 0x05, 0x86, 0xeb, 0x87, 0x2d, 0xc8, 0x72, 0xdf, 0xf9, 0xad, 0x32, 0x72, 0x16, 0x04,
-	0xd3, 0x8d, 0x3d, 0x34, 0xc5, 0xe7, 0xa8, 0xab, 0xf3, 0x24, 0xa1, 0x6a, 0x59, 0xd8, 0xc0, 0x34,
-	0x6b, 0x92, 0x4e, 0x81, 0x16, 0x17, 0xfe, 0x0c, 0x75, 0x55, 0x2e, 0xc3, 0x68, 0x46, 0x95, 0x3d,
-	0x48, 0xce, 0xfd, 0xaa, 0x1b, 0xad, 0x2a, 0x97, 0x23, 0x0b, 0x5e, 0x09, 0x39, 0xc7, 0x87, 0xa8,
-	0x6e, 0x59, 0x76, 0xf2, 0xee, 0x40, 0xb8, 0xa6, 0x72, 0x69, 0x67, 0xee, 0x4b, 0xf4, 0x64, 0xca,
-	0x25, 0x57, 0xd4, 0x70, 0xb6, 0xd9, 0x62, 0x35, 0x28, 0xde, 0x7e, 0x19, 0xbd, 0xd7, 0x5f, 0xc7,
-	0xdf, 0xa0, 0x9a, 0xcb, 0x1a, 0xb7, 0x50, 0x7d, 0xfc, 0x7e, 0x34, 0x7a, 0x3d, 0x1e, 0x7b, 0x15,
-	0xdc, 0x44, 0x3b, 0xaf, 0x09, 0x79, 0x47, 0xbc, 0x2d, 0xbc, 0x8b, 0x3a, 0xc3, 0xb7, 0xc3, 0xab,
-	0xdf, 0xc7, 0x17, 0xe3, 0xf0, 0x7c, 0x78, 0x71, 0xe5, 0x55, 0x7f, 0xfe, 0x0a, 0xbd, 0x88, 0xd2,
-	0x24, 0x98, 0xa6, 0xe9, 0x34, 0xe6, 0x81, 0x7d, 0x43, 0x21, 0xa7, 0x41, 0xc6, 0xd5, 0x6d, 0xaa,
-	0x12, 0x2a, 0x23, 0xbe, 0xf1, 0xdb, 0xff, 0x09, 0x00, 0x00, 0xff, 0xff, 0xca, 0x40, 0x77, 0xc2,
-	0x65, 0x07, 0x00, 0x00,
+	// 949 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa5, 0x55, 0xdb, 0x6e, 0x1b, 0x37,
+	0x10, 0x85, 0x6c, 0x59, 0x17, 0xea, 0xb6, 0xa2, 0xe5, 0x78, 0x63, 0xa0, 0x80, 0xe3, 0xa6, 0x88,
+	0xd1, 0xb4, 0xeb, 0x42, 0x0d, 0x8a, 0xb6, 0x28, 0x8a, 0xaa, 0x72, 0x04, 0x38, 0x75, 0x93, 0x96,
+	0x52, 0x60, 0xf4, 0x69, 0x41, 0xef, 0xd2, 0x12, 0xa1, 0xbd, 0xa8, 0xe4, 0x6e, 0x1c, 0xf5, 0x4f,
+	0xfb, 0x11, 0xfd, 0x87, 0x0e, 0x87, 0x2b, 0xc9, 0x72, 0xe2, 0xbe, 0xf4, 0x65, 0x41, 0x9e, 0x39,
+	0xe7, 0x90, 0xc3, 0x21, 0x67, 0xc9, 0x93, 0x85, 0x4a, 0xb3, 0xf4, 0xec, 0xcf, 0x5c, 0x06, 0x73,
+	0x9d, 0xa5, 0x4a, 0xdc, 0x19, 0x7a, 0x18, 0xa3, 0x9d, 0x98, 0xcf, 0x53, 0x6f, 0x03, 0x1f, 0x7d,
+	0x65, 0x35, 0x41, 0x24, 0x45, 0x92, 0xe9, 0x33, 0x9e, 0xf0, 0x68, 0xf9, 0x97, 0x50, 0xfa, 0x2c,
+	0x9b, 0x29, 0xa1, 0x67, 0x69, 0x14, 0xfa, 0x2b, 0xcc, 0x5a, 0x1c, 0x7d, 0xf1, 0x90, 0x22, 0xcf,
+	0x84, 0xce, 0xee, 0xb3, 0xbd, 0x87, 0xd8, 0xb7, 0x32, 0x09, 0xd3, 0x5b, 0x3f, 0x14, 0xef, 0x24,
+	0xcf, 0x64, 0x9a, 0x14, 0xfc, 0x81, 0xe5, 0xcf, 0x44, 0xb4, 0x30, 0x2c, 0x95, 0x46, 0x91, 0x4c,
+	0xa6, 0x7e, 0xc1, 0x56, 0x22, 0xcc, 0x03, 0xa1, 0x1e, 0x80, 0x0b, 0x8b, 0x03, 0xbd, 0x10, 0xc1,
+	0x99, 0xf5, 0xc1, 0x74, 0x71, 0x78, 0xf2, 0x77, 0x9d, 0x74, 0x7e, 0x5f, 0x27, 0x7e, 0x91, 0x2c,
+	0xf2, 0x8c, 0x7e, 0x4a, 0x5a, 0xd7, 0x22, 0x09, 0x66, 0x31, 0x57, 0x73, 0x7f, 0x2e, 0x96, 0x6e,
+	0xe9, 0xb8, 0x74, 0x5a, 0x67, 0xcd, 0x35, 0xf8, 0x8b, 0x58, 0xd2, 0x27, 0xa4, 0x99, 0xc9, 0x18,
+	0x72, 0xe3, 0xf1, 0xc2, 0x8f, 0xb5, 0xbb, 0x03, 0x9c, 0x12, 0x6b, 0xac, 0xb1, 0x5f, 0x35, 0x7d,
+	0x4c, 0x6a, 0xd7, 0xb9, 0x84, 0xb3, 0x92, 0xa1, 0xdb, 0x83, 0xf0, 0x2e, 0xab, 0xe2, 0xfc, 0x22,
+	0xa4, 0xa7, 0xc4, 0x09, 0x73, 0x85, 0x29, 0xfa, 0x46, 0x62, 0x1c, 0x76, 0xd1, 0xa1, 0xbd, 0xc2,
+	0x27, 0x00, 0x83, 0x09, 0x25, 0xe5, 0x8c, 0x4f, 0xb5, 0x5b, 0x3e, 0xde, 0x85, 0x3d, 0xe0, 0x98,
+	0x7e, 0x43, 0x0e, 0x67, 0xd2, 0x6c, 0x58, 0x06, 0x3c, 0xf2, 0x83, 0x34, 0xc9, 0xc4, 0xfb, 0xcc,
+	0x47, 0x9a, 0x8b, 0xb4, 0x83, 0x4d, 0x78, 0x68, 0xa3, 0x13, 0xa3, 0xfb, 0x84, 0x90, 0x59, 0xfa,
+	0x4e, 0x28, 0xdf, 0x20, 0x6e, 0x1b, 0xb3, 0xaa, 0x23, 0x32, 0x01, 0x80, 0x1e, 0x93, 0x46, 0x28,
+	0x74, 0xa0, 0xe4, 0xc2, 0xac, 0xef, 0x56, 0x30, 0x7e, 0x17, 0x02, 0x46, 0x13, 0xcb, 0xb9, 0xe0,
+	0x5a, 0x9b, 0xac, 0x28, 0x52, 0x88, 0xc1, 0x7e, 0x03, 0x08, 0x12, 0xfb, 0x81, 0x74, 0x78, 0x92,
+	0xa4, 0x99, 0x4d, 0x2d, 0x82, 0x6d, 0xb8, 0x55, 0xd8, 0x52, 0xa3, 0xbf, 0xef, 0xe1, 0xa9, 0xb3,
+	0x3c, 0x19, 0xac, 0xe3, 0xac, 0xbd, 0xe1, 0x5e, 0x02, 0x15, 0x12, 0x6b, 0xcf, 0x96, 0x50, 0x62,
+	0x28, 0xe3, 0xdc, 0x8a, 0x6b, 0x28, 0xee, 0x58, 0xf1, 0x6b, 0x1e, 0x8b, 0xf0, 0x9c, 0x67, 0x9c,
+	0xb5, 0xd6, 0x34, 0xd4, 0x7d, 0x4e, 0x6a, 0x3c, 0x7f, 0xef, 0x87, 0x10, 0x72, 0xbb, 0x1f, 0x57,
+	0x54, 0x81, 0x60, 0x06, 0xf4, 0x47, 0xd2, 0x95, 0xd3, 0x04, 0x8a, 0xed, 0x2b, 0x9e, 0x4c, 0x85,
+	0x5d, 0xa6, 0x8e, 0x22, 0x6a, 0x45, 0x97, 0xfc, 0x5a, 0x44, 0x22, 0x64, 0x26, 0xcc, 0x3a, 0x96,
+	0x8c, 0x13, 0x5c, 0x0b, 0xaa, 0x9a, 0x09, 0xa8, 0x79, 0x28, 0x95, 0x7b, 0x80, 0xf9, 0x57, 0xcd,
+	0xfc, 0x5c, 0x2a, 0xfa, 0x82, 0xec, 0x87, 0xa0, 0xcc, 0x84, 0xaf, 0xe1, 0x06, 0x44, 0xc2, 0xbf,
+	0x91, 0x91, 0xd0, 0xee, 0x23, 0x60, 0xd5, 0xbe, 0x2f, 0x67, 0x2a, 0x17, 0xac, 0x6b, 0x09, 0x63,
+	0x8c, 0x8f, 0x4c, 0x98, 0xf6, 0xc9, 0x41, 0x90, 0x46, 0x79, 0x9c, 0x70, 0xb5, 0xad, 0x7b, 0x6c,
+	0x74, 0x6c, 0x7f, 0x15, 0xbc, 0xab, 0xb9, 0x22, 0x2d, 0x7c, 0x34, 0x5a, 0x6a, 0x2c, 0x86, 0x4b,
+	0x80, 0xdb, 0xe8, 0xf7, 0xbd, 0x7b, 0x2f, 0xd9, 0xbb, 0x77, 0xb7, 0x3d, 0xb8, 0x0e, 0xa1, 0x34,
+	0xe7, 0xcd, 0xa3, 0x91, 0x14, 0x51, 0xa8, 0x59, 0x73, 0x65, 0x64, 0x2a, 0xb8, 0x65, 0x7c, 0xc3,
+	0x65, 0xe4, 0x36, 0xfe, 0xbf, 0xf1, 0x08, 0x7c, 0xe8, 0xb7, 0xa4, 0xa1, 0x6e, 0x95, 0xb9, 0xac,
+	0x37, 0x12, 0xee, 0xe9, 0x21, 0x1e, 0xf8, 0xa1, 0xb5, 0x2d, 0xde, 0xb5, 0xc7, 0xae, 0xd8, 0x10,
+	0xe3, 0x8c, 0x00, 0xd7, 0x0e, 0x35, 0x0d, 0x89, 0xb3, 0x69, 0x3b, 0xd2, 0x2c, 0xa6, 0xdd, 0x26,
+	0xca, 0xbf, 0xb3, 0xf2, 0x75, 0xfb, 0xf0, 0x3e, 0xd2, 0x9e, 0x26, 0x2b, 0x68, 0x50, 0x20, 0xb8,
+	0x5d, 0xd6, 0x59, 0x53, 0x71, 0xae, 0xe9, 0x2b, 0x42, 0x6e, 0x43, 0xbe, 0xf2, 0x6f, 0xa1, 0xff,
+	0x73, 0xeb, 0xff, 0x41, 0x53, 0xba, 0x42, 0xe0, 0x7c, 0x35, 0xb7, 0x8e, 0x75, 0x90, 0xaf, 0xbd,
+	0x9a, 0xb6, 0xed, 0x15, 0x6e, 0x0e, 0xba, 0x3d, 0xb3, 0x6e, 0xf7, 0x1a, 0xe2, 0xdb, 0x09, 0x4c,
+	0xb7, 0xf7, 0xd6, 0x40, 0x8a, 0xf5, 0x3a, 0x7a, 0x46, 0xba, 0x1f, 0x1c, 0xed, 0xba, 0x29, 0x94,
+	0x36, 0x4d, 0xe1, 0x55, 0xb9, 0xd6, 0x71, 0x1c, 0xf8, 0xee, 0x3b, 0x3d, 0xf8, 0xee, 0x39, 0x95,
+	0x93, 0x7f, 0x76, 0x88, 0xb3, 0x29, 0xd3, 0x9b, 0x3c, 0x33, 0xcd, 0xed, 0x27, 0x52, 0x81, 0xfe,
+	0x94, 0xe5, 0x1a, 0xbb, 0x5a, 0xbb, 0x7f, 0xfa, 0x1f, 0x95, 0xb5, 0x12, 0x6f, 0x8c, 0x7c, 0x56,
+	0xe8, 0xe8, 0x88, 0xf4, 0x56, 0xbb, 0xf7, 0x53, 0x64, 0xd8, 0x37, 0xb4, 0x83, 0x59, 0xf6, 0xac,
+	0xdf, 0x2a, 0x23, 0x6b, 0xc1, 0x28, 0xdf, 0x9a, 0xe3, 0x43, 0xfa, 0x8c, 0xb4, 0x75, 0x1e, 0x43,
+	0x3f, 0x5d, 0x16, 0x36, 0xd8, 0x01, 0xeb, 0xac, 0x55, 0xa0, 0xc5, 0x86, 0x9f, 0x92, 0xb6, 0xca,
+	0x13, 0x3f, 0x98, 0x71, 0x65, 0x16, 0x4a, 0xe6, 0xd0, 0x0a, 0xb1, 0x1d, 0x03, 0x3a, 0x34, 0xe0,
+	0x25, 0x60, 0xf4, 0x90, 0x54, 0x0d, 0xcb, 0x74, 0xeb, 0x3d, 0x0c, 0x57, 0x60, 0x6a, 0xfa, 0xf4,
+	0x0b, 0xf2, 0x68, 0x2a, 0x12, 0x01, 0x3d, 0x55, 0x84, 0xdb, 0xcf, 0xab, 0x82, 0x87, 0xd7, 0x5b,
+	0x47, 0xef, 0xbc, 0xaf, 0x93, 0xaf, 0x49, 0xc5, 0x66, 0x4d, 0x1b, 0xa4, 0x3a, 0x7e, 0x3b, 0x1c,
+	0xbe, 0x1c, 0x8f, 0x9d, 0x12, 0xad, 0x93, 0xbd, 0x97, 0x8c, 0xbd, 0x61, 0xce, 0x0e, 0xed, 0x92,
+	0xd6, 0xe0, 0xf5, 0xe0, 0xf2, 0x8f, 0xf1, 0xc5, 0xd8, 0x1f, 0x0d, 0x2e, 0x2e, 0x9d, 0xf2, 0xcf,
+	0x5f, 0x92, 0xe7, 0x41, 0x1a, 0x7b, 0xd3, 0x34, 0x9d, 0x46, 0xc2, 0x33, 0x35, 0x84, 0xbf, 0x91,
+	0x07, 0x37, 0xfb, 0x26, 0x55, 0x31, 0x4f, 0x02, 0xb1, 0x75, 0xdb, 0xff, 0x05, 0xb7, 0xf8, 0x13,
+	0xd1, 0x99, 0x07, 0x00, 0x00,
 }
@@ -309,6 +309,92 @@ func (AnalysisTriageInfo_EnvironmentType) EnumDescriptor() ([]byte, []int) {
 	return fileDescriptor_b174f87a83ddb952, []int{42, 1}
 }
 
+type StandardDownsamplerOptions_BatchPackingOption int32
+
+const (
+	StandardDownsamplerOptions_BATCH_PACKING_UNSPECIFIED StandardDownsamplerOptions_BatchPackingOption = 0
+	StandardDownsamplerOptions_INPUT_VALUE_ORDER         StandardDownsamplerOptions_BatchPackingOption = 1
+	StandardDownsamplerOptions_FEWEST_BATCHES            StandardDownsamplerOptions_BatchPackingOption = 2
+)
+
+var StandardDownsamplerOptions_BatchPackingOption_name = map[int32]string{
+	0: "BATCH_PACKING_UNSPECIFIED",
+	1: "INPUT_VALUE_ORDER",
+	2: "FEWEST_BATCHES",
+}
+
+var StandardDownsamplerOptions_BatchPackingOption_value = map[string]int32{
+	"BATCH_PACKING_UNSPECIFIED": 0,
+	"INPUT_VALUE_ORDER":         1,
+	"FEWEST_BATCHES":            2,
+}
+
+func (x StandardDownsamplerOptions_BatchPackingOption) Enum() *StandardDownsamplerOptions_BatchPackingOption {
+	p := new(StandardDownsamplerOptions_BatchPackingOption)
+	*p = x
+	return p
+}
+
+func (x StandardDownsamplerOptions_BatchPackingOption) String() string {
+	return proto.EnumName(StandardDownsamplerOptions_BatchPackingOption_name, int32(x))
+}
+
+func (x *StandardDownsamplerOptions_BatchPackingOption) UnmarshalJSON(data []byte) error {
+	value, err := proto.UnmarshalJSONEnum(StandardDownsamplerOptions_BatchPackingOption_value, data, "StandardDownsamplerOptions_BatchPackingOption")
+	if err != nil {
+		return err
+	}
+	*x = StandardDownsamplerOptions_BatchPackingOption(value)
+	return nil
+}
+
+func (StandardDownsamplerOptions_BatchPackingOption) EnumDescriptor() ([]byte, []int) {
+	return fileDescriptor_b174f87a83ddb952, []int{50, 0}
+}
+
+type StandardDownsamplerOptions_SamplingOption int32
+
+const (
+	StandardDownsamplerOptions_SAMPLING_UNSPECIFIED           StandardDownsamplerOptions_SamplingOption = 0
+	StandardDownsamplerOptions_UNIFORM                        StandardDownsamplerOptions_SamplingOption = 1
+	StandardDownsamplerOptions_LARGEST_TRIANGLE_THREE_BUCKETS StandardDownsamplerOptions_SamplingOption = 2
+)
+
+var StandardDownsamplerOptions_SamplingOption_name = map[int32]string{
+	0: "SAMPLING_UNSPECIFIED",
+	1: "UNIFORM",
+	2: "LARGEST_TRIANGLE_THREE_BUCKETS",
+}
+
+var StandardDownsamplerOptions_SamplingOption_value = map[string]int32{
+	"SAMPLING_UNSPECIFIED":           0,
+	"UNIFORM":                        1,
+	"LARGEST_TRIANGLE_THREE_BUCKETS": 2,
+}
+
+func (x StandardDownsamplerOptions_SamplingOption) Enum() *StandardDownsamplerOptions_SamplingOption {
+	p := new(StandardDownsamplerOptions_SamplingOption)
+	*p = x
+	return p
+}
+
+func (x StandardDownsamplerOptions_SamplingOption) String() string {
+	return proto.EnumName(StandardDownsamplerOptions_SamplingOption_name, int32(x))
+}
+
+func (x *StandardDownsamplerOptions_SamplingOption) UnmarshalJSON(data []byte) error {
+	value, err := proto.UnmarshalJSONEnum(StandardDownsamplerOptions_SamplingOption_value, data, "StandardDownsamplerOptions_SamplingOption")
+	if err != nil {
+		return err
+	}
+	*x = StandardDownsamplerOptions_SamplingOption(value)
+	return nil
+}
+
+func (StandardDownsamplerOptions_SamplingOption) EnumDescriptor() ([]byte, []int) {
+	return fileDescriptor_b174f87a83ddb952, []int{50, 1}
+}
+
 type StandardAggregatorOptions_ErrorsInIgnoreRangeOption int32
 
 const (
@@ -2923,6 +3009,7 @@ func (m *DownsamplerInput) GetStandardDownsamplerOptions() *StandardDownsamplerO
 
 type DownsamplerOutput struct {
 	SampleBatchList      []*SampleBatch `protobuf:"bytes,1,rep,name=sample_batch_list,json=sampleBatchList" json:"sample_batch_list,omitempty"`
+	BatchUtilization     *float64       `protobuf:"fixed64,2,opt,name=batch_utilization,json=batchUtilization" json:"batch_utilization,omitempty"`
 	XXX_NoUnkeyedLiteral struct{}       `json:"-"`
 	XXX_unrecognized     []byte         `json:"-"`
 	XXX_sizecache        int32          `json:"-"`
@@ -2960,6 +3047,13 @@ func (m *DownsamplerOutput) GetSampleBatchList() []*SampleBatch {
 	return nil
 }
 
+func (m *DownsamplerOutput) GetBatchUtilization() float64 {
+	if m != nil && m.BatchUtilization != nil {
+		return *m.BatchUtilization
+	}
+	return 0
+}
+
 type AnalyzerHistoricQueryInput struct {
 	BenchmarkInfo        *BenchmarkInfo `protobuf:"bytes,1,opt,name=benchmark_info,json=benchmarkInfo" json:"benchmark_info,omitempty"`
 	RunInfo              *RunInfo       `protobuf:"bytes,2,opt,name=run_info,json=runInfo" json:"run_info,omitempty"`
@@ -3999,9 +4093,11 @@ func (m *TestInput) GetInternalTestOptions() map[string]string {
 }
 
 type StandardDownsamplerOptions struct {
-	XXX_NoUnkeyedLiteral struct{} `json:"-"`
-	XXX_unrecognized     []byte   `json:"-"`
-	XXX_sizecache        int32    `json:"-"`
+	BatchPacking         *StandardDownsamplerOptions_BatchPackingOption `protobuf:"varint,1,opt,name=batch_packing,json=batchPacking,enum=mako.StandardDownsamplerOptions_BatchPackingOption,def=0" json:"batch_packing,omitempty"`
+	Sampling             *StandardDownsamplerOptions_SamplingOption     `protobuf:"varint,2,opt,name=sampling,enum=mako.StandardDownsamplerOptions_SamplingOption,def=0" json:"sampling,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}                                       `json:"-"`
+	XXX_unrecognized     []byte                                         `json:"-"`
+	XXX_sizecache        int32                                          `json:"-"`
 }
 
 func (m *StandardDownsamplerOptions) Reset()         { *m = StandardDownsamplerOptions{} }
@@ -4029,8 +4125,26 @@ func (m *StandardDownsamplerOptions) XXX_DiscardUnknown() {
 
 var xxx_messageInfo_StandardDownsamplerOptions proto.InternalMessageInfo
 
+const Default_StandardDownsamplerOptions_BatchPacking StandardDownsamplerOptions_BatchPackingOption = StandardDownsamplerOptions_BATCH_PACKING_UNSPECIFIED
+const Default_StandardDownsamplerOptions_Sampling StandardDownsamplerOptions_SamplingOption = StandardDownsamplerOptions_SAMPLING_UNSPECIFIED
+
+func (m *StandardDownsamplerOptions) GetBatchPacking() StandardDownsamplerOptions_BatchPackingOption {
+	if m != nil && m.BatchPacking != nil {
+		return *m.BatchPacking
+	}
+	return Default_StandardDownsamplerOptions_BatchPacking
+}
+
+func (m *StandardDownsamplerOptions) GetSampling() StandardDownsamplerOptions_SamplingOption {
+	if m != nil && m.Sampling != nil {
+		return *m.Sampling
+	}
+	return Default_StandardDownsamplerOptions_Sampling
+}
+
 type StandardAggregatorOptions struct {
 	ErrorsInIgnoreRangeBehavior *StandardAggregatorOptions_ErrorsInIgnoreRangeOption `protobuf:"varint,1,opt,name=errors_in_ignore_range_behavior,json=errorsInIgnoreRangeBehavior,enum=mako.StandardAggregatorOptions_ErrorsInIgnoreRangeOption,def=0" json:"errors_in_ignore_range_behavior,omitempty"`
+	HistogramMetricList         []*StandardAggregatorOptions_HistogramMetric         `protobuf:"bytes,2,rep,name=histogram_metric_list,json=histogramMetricList" json:"histogram_metric_list,omitempty"`
 	XXX_NoUnkeyedLiteral        struct{}                                             `json:"-"`
 	XXX_unrecognized            []byte                                               `json:"-"`
 	XXX_sizecache               int32                                                `json:"-"`
@@ -4070,6 +4184,83 @@ func (m *StandardAggregatorOptions) GetErrorsInIgnoreRangeBehavior() StandardAgg
 	return Default_StandardAggregatorOptions_ErrorsInIgnoreRangeBehavior
 }
 
+func (m *StandardAggregatorOptions) GetHistogramMetricList() []*StandardAggregatorOptions_HistogramMetric {
+	if m != nil {
+		return m.HistogramMetricList
+	}
+	return nil
+}
+
+type StandardAggregatorOptions_HistogramMetric struct {
+	ValueKey               *string  `protobuf:"bytes,1,opt,name=value_key,json=valueKey" json:"value_key,omitempty"`
+	LowestDiscernibleValue *float64 `protobuf:"fixed64,2,opt,name=lowest_discernible_value,json=lowestDiscernibleValue,def=1" json:"lowest_discernible_value,omitempty"`
+	HighestTrackableValue  *float64 `protobuf:"fixed64,3,opt,name=highest_trackable_value,json=highestTrackableValue" json:"highest_trackable_value,omitempty"`
+	SignificantDigits      *int32   `protobuf:"varint,4,opt,name=significant_digits,json=significantDigits,def=3" json:"significant_digits,omitempty"`
+	XXX_NoUnkeyedLiteral   struct{} `json:"-"`
+	XXX_unrecognized       []byte   `json:"-"`
+	XXX_sizecache          int32    `json:"-"`
+}
+
+func (m *StandardAggregatorOptions_HistogramMetric) Reset() {
+	*m = StandardAggregatorOptions_HistogramMetric{}
+}
+func (m *StandardAggregatorOptions_HistogramMetric) String() string {
+	return proto.CompactTextString(m)
+}
+func (*StandardAggregatorOptions_HistogramMetric) ProtoMessage() {}
+func (*StandardAggregatorOptions_HistogramMetric) Descriptor() ([]byte, []int) {
+	return fileDescriptor_b174f87a83ddb952, []int{51, 0}
+}
+
+func (m *StandardAggregatorOptions_HistogramMetric) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_StandardAggregatorOptions_HistogramMetric.Unmarshal(m, b)
+}
+func (m *StandardAggregatorOptions_HistogramMetric) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_StandardAggregatorOptions_HistogramMetric.Marshal(b, m, deterministic)
+}
+func (m *StandardAggregatorOptions_HistogramMetric) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_StandardAggregatorOptions_HistogramMetric.Merge(m, src)
+}
+func (m *StandardAggregatorOptions_HistogramMetric) XXX_Size() int {
+	return xxx_messageInfo_StandardAggregatorOptions_HistogramMetric.Size(m)
+}
+func (m *StandardAggregatorOptions_HistogramMetric) XXX_DiscardUnknown() {
+	xxx_messageInfo_StandardAggregatorOptions_HistogramMetric.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_StandardAggregatorOptions_HistogramMetric proto.InternalMessageInfo
+
+const Default_StandardAggregatorOptions_HistogramMetric_LowestDiscernibleValue float64 = 1
+const Default_StandardAggregatorOptions_HistogramMetric_SignificantDigits int32 = 3
+
+func (m *StandardAggregatorOptions_HistogramMetric) GetValueKey() string {
+	if m != nil && m.ValueKey != nil {
+		return *m.ValueKey
+	}
+	return ""
+}
+
+func (m *StandardAggregatorOptions_HistogramMetric) GetLowestDiscernibleValue() float64 {
+	if m != nil && m.LowestDiscernibleValue != nil {
+		return *m.LowestDiscernibleValue
+	}
+	return Default_StandardAggregatorOptions_HistogramMetric_LowestDiscernibleValue
+}
+
+func (m *StandardAggregatorOptions_HistogramMetric) GetHighestTrackableValue() float64 {
+	if m != nil && m.HighestTrackableValue != nil {
+		return *m.HighestTrackableValue
+	}
+	return 0
+}
+
+func (m *StandardAggregatorOptions_HistogramMetric) GetSignificantDigits() int32 {
+	if m != nil && m.SignificantDigits != nil {
+		return *m.SignificantDigits
+	}
+	return Default_StandardAggregatorOptions_HistogramMetric_SignificantDigits
+}
+
 type TestOutput struct {
 	TestStatus           *TestOutput_TestStatus           `protobuf:"varint,1,opt,name=test_status,json=testStatus,enum=mako.TestOutput_TestStatus" json:"test_status,omitempty"`
 	AnalyzerOutputList   []*AnalyzerOutput                `protobuf:"bytes,2,rep,name=analyzer_output_list,json=analyzerOutputList" json:"analyzer_output_list,omitempty"`
@@ -4250,6 +4441,8 @@ func init() {
 	proto.RegisterEnum("mako.DataFilter_DataType", DataFilter_DataType_name, DataFilter_DataType_value)
 	proto.RegisterEnum("mako.AnalysisTriageInfo_AnalysisTriageType", AnalysisTriageInfo_AnalysisTriageType_name, AnalysisTriageInfo_AnalysisTriageType_value)
 	proto.RegisterEnum("mako.AnalysisTriageInfo_EnvironmentType", AnalysisTriageInfo_EnvironmentType_name, AnalysisTriageInfo_EnvironmentType_value)
+	proto.RegisterEnum("mako.StandardDownsamplerOptions_BatchPackingOption", StandardDownsamplerOptions_BatchPackingOption_name, StandardDownsamplerOptions_BatchPackingOption_value)
+	proto.RegisterEnum("mako.StandardDownsamplerOptions_SamplingOption", StandardDownsamplerOptions_SamplingOption_name, StandardDownsamplerOptions_SamplingOption_value)
 	proto.RegisterEnum("mako.StandardAggregatorOptions_ErrorsInIgnoreRangeOption", StandardAggregatorOptions_ErrorsInIgnoreRangeOption_name, StandardAggregatorOptions_ErrorsInIgnoreRangeOption_value)
 	proto.RegisterEnum("mako.TestOutput_TestStatus", TestOutput_TestStatus_name, TestOutput_TestStatus_value)
 	proto.RegisterEnum("mako.TestOutput_RetryableFailureType", TestOutput_RetryableFailureType_name, TestOutput_RetryableFailureType_value)
@@ -4313,6 +4506,7 @@ func init() {
 	proto.RegisterMapType((map[string]string)(nil), "mako.TestInput.InternalTestOptionsEntry")
 	proto.RegisterType((*StandardDownsamplerOptions)(nil), "mako.StandardDownsamplerOptions")
 	proto.RegisterType((*StandardAggregatorOptions)(nil), "mako.StandardAggregatorOptions")
+	proto.RegisterType((*StandardAggregatorOptions_HistogramMetric)(nil), "mako.StandardAggregatorOptions.HistogramMetric")
 	proto.RegisterType((*TestOutput)(nil), "mako.TestOutput")
 	proto.RegisterType((*SampleRecord)(nil), "mako.SampleRecord")
 	proto.RegisterType((*SampleFile)(nil), "mako.SampleFile")
@@ -4321,532 +4515,287 @@ func init() {
 func init() { proto.RegisterFile("spec/proto/mako.proto", fileDescriptor_b174f87a83ddb952) }
 
 var fileDescriptor_b174f87a83ddb952 = []byte{
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0x7b, 0xcd, 0x6f, 0x23, 0x47,
-	0x76, 0xb8, 0x9b, 0x1f, 0x12, 0xf9, 0x48, 0x91, 0xad, 0xd2, 0xc7, 0x50, 0x92, 0xed, 0x91, 0xdb,
-	0x3b, 0xbf, 0xd5, 0xda, 0x58, 0x8d, 0xad, 0x35, 0xe6, 0xb7, 0x96, 0x9d, 0x2c, 0x28, 0x8a, 0x9a,
-	0xe1, 0x8c, 0x48, 0x69, 0x8a, 0x94, 0x1d, 0x63, 0x13, 0x34, 0x5a, 0x64, 0x89, 0xea, 0x1d, 0xb2,
-	0x9b, 0xe9, 0x6a, 0x8e, 0xa5, 0x39, 0xe6, 0x12, 0x04, 0x48, 0x6e, 0x41, 0x72, 0xd8, 0xc3, 0x1e,
-	0x16, 0xb9, 0xe4, 0x90, 0x4b, 0x90, 0x43, 0x82, 0x00, 0xc9, 0x21, 0x40, 0x2e, 0xf9, 0x17, 0x72,
-	0x0b, 0x72, 0xca, 0x5f, 0x10, 0x24, 0x40, 0x50, 0xaf, 0xaa, 0xbb, 0x8b, 0x1f, 0x1a, 0x69, 0x76,
-	0xc7, 0xbe, 0xb1, 0x5e, 0xbd, 0xf7, 0xaa, 0xea, 0xbd, 0x57, 0xef, 0xab, 0x8b, 0xb0, 0xc6, 0x47,
-	0xac, 0xfb, 0x70, 0x14, 0xf8, 0xa1, 0xff, 0x70, 0xe8, 0xbc, 0xf0, 0x77, 0xf1, 0x27, 0xc9, 0x88,
-	0xdf, 0xd6, 0xdf, 0x1b, 0xb0, 0xd0, 0x0e, 0x9d, 0x70, 0xcc, 0xc9, 0x03, 0xc8, 0x74, 0xfd, 0x1e,
-	0xab, 0x18, 0xdb, 0xc6, 0x4e, 0x69, 0x6f, 0x79, 0x17, 0x71, 0xe5, 0xdc, 0x6e, 0xcd, 0xef, 0x31,
-	0x8a, 0xd3, 0xe4, 0x03, 0x28, 0x5e, 0x38, 0xee, 0xc0, 0x1e, 0x32, 0xce, 0x9d, 0x3e, 0xab, 0xa4,
-	0xb6, 0x8d, 0x9d, 0x3c, 0x2d, 0x08, 0x58, 0x53, 0x82, 0xc8, 0x16, 0x64, 0x03, 0x16, 0x06, 0xd7,
-	0x95, 0xf4, 0xb6, 0xb1, 0x93, 0xdb, 0xcf, 0x5e, 0x38, 0x03, 0xce, 0xa8, 0x84, 0x91, 0x1f, 0x81,
-	0xf9, 0xad, 0x13, 0x78, 0xae, 0xd7, 0x8f, 0x58, 0xf0, 0x4a, 0x66, 0x3b, 0xbd, 0x93, 0xa7, 0x65,
-	0x05, 0x57, 0x6c, 0xb8, 0xf5, 0x1e, 0x64, 0xc4, 0xc2, 0xa4, 0x00, 0x8b, 0xed, 0xb3, 0x5a, 0xad,
-	0xde, 0x6e, 0x9b, 0xef, 0x90, 0x1c, 0x64, 0x8e, 0xaa, 0x8d, 0x63, 0xd3, 0xb0, 0xfe, 0xc6, 0x80,
-	0xfc, 0x57, 0xce, 0x60, 0xcc, 0x1a, 0xde, 0x85, 0x4f, 0xb6, 0x20, 0xff, 0x52, 0x0c, 0xec, 0x17,
-	0xec, 0x1a, 0xcf, 0x90, 0xa7, 0x39, 0x04, 0x3c, 0x63, 0xd7, 0x64, 0x15, 0xb2, 0x03, 0xe7, 0x9c,
-	0x0d, 0xd4, 0x6e, 0xe5, 0x80, 0x6c, 0x43, 0xa1, 0xc7, 0x78, 0x37, 0x70, 0x47, 0xa1, 0xeb, 0x7b,
-	0x95, 0x8c, 0x3c, 0x89, 0x06, 0x22, 0x3b, 0x90, 0x09, 0xaf, 0x47, 0x0c, 0x0f, 0x52, 0xda, 0x5b,
-	0x95, 0x32, 0x89, 0xd7, 0xdc, 0xed, 0x5c, 0x8f, 0x18, 0x45, 0x0c, 0xcb, 0x82, 0x8c, 0x18, 0x89,
-	0xbd, 0xb6, 0xce, 0x9a, 0x75, 0xda, 0xa8, 0x99, 0x06, 0x59, 0x82, 0x7c, 0xa7, 0xd1, 0xac, 0xb7,
-	0x3b, 0xd5, 0xe6, 0xa9, 0x99, 0xb2, 0x7e, 0x06, 0xf0, 0x8c, 0x5d, 0xb3, 0x1e, 0x32, 0xb8, 0x75,
-	0xc3, 0xf8, 0x1b, 0x37, 0x6c, 0x50, 0x39, 0xb0, 0x7e, 0x02, 0xf9, 0x96, 0x33, 0x64, 0xbd, 0x43,
-	0x27, 0x74, 0x08, 0x81, 0x8c, 0xe7, 0x0c, 0x99, 0x22, 0xc5, 0xdf, 0x02, 0xd6, 0x73, 0x42, 0x47,
-	0x1d, 0x13, 0x7f, 0x5b, 0x0f, 0x21, 0x4b, 0x1d, 0xaf, 0xcf, 0x04, 0x4f, 0x1e, 0x3a, 0x41, 0x88,
-	0x14, 0x06, 0x95, 0x03, 0x62, 0x42, 0x9a, 0x79, 0x3d, 0xb5, 0x8e, 0xf8, 0x69, 0x3d, 0x86, 0xe2,
-	0xb1, 0x90, 0x0f, 0xeb, 0xc5, 0x74, 0x52, 0x78, 0x86, 0x2e, 0xbc, 0x0f, 0x20, 0x1b, 0x88, 0x69,
-	0xa4, 0x2c, 0xec, 0x15, 0xa4, 0x6c, 0x90, 0x82, 0xca, 0x19, 0xeb, 0xd7, 0x19, 0x00, 0xb1, 0xd5,
-	0x23, 0x77, 0x10, 0xb2, 0x80, 0x3c, 0x82, 0xbc, 0xd8, 0x90, 0x8d, 0x12, 0x95, 0x56, 0xb6, 0x21,
-	0xa9, 0x12, 0x24, 0xfc, 0x89, 0x62, 0xcd, 0xf5, 0xd4, 0xaf, 0x49, 0x41, 0xa5, 0x6e, 0xd2, 0x6c,
-	0x56, 0xdf, 0xdc, 0x1e, 0xac, 0x8d, 0x58, 0xd0, 0x65, 0x5e, 0xe8, 0x0e, 0x98, 0x3d, 0x74, 0x07,
-	0x03, 0xd7, 0x0e, 0x1c, 0xef, 0x05, 0x2a, 0x32, 0x4b, 0x57, 0x92, 0xc9, 0xa6, 0x98, 0xa3, 0x8e,
-	0xf7, 0x82, 0x7c, 0x06, 0x2b, 0x6e, 0xdf, 0xf3, 0x03, 0x81, 0xcf, 0xb9, 0xb0, 0x4f, 0x14, 0x65,
-	0x06, 0x6d, 0x38, 0x13, 0x06, 0x63, 0x46, 0x97, 0x25, 0x42, 0x53, 0xce, 0x8b, 0xad, 0x5a, 0xff,
-	0x94, 0x82, 0x5c, 0xb4, 0x67, 0xb2, 0x09, 0xeb, 0xcd, 0x7a, 0x87, 0x36, 0x6a, 0x76, 0xf5, 0xf1,
-	0x63, 0x5a, 0x7f, 0x5c, 0xed, 0xd4, 0xed, 0xda, 0xc9, 0x59, 0xab, 0x63, 0x16, 0x48, 0x05, 0x56,
-	0x67, 0xe6, 0x9a, 0x8d, 0x96, 0x69, 0xcc, 0x9f, 0xa9, 0xfe, 0x9e, 0x99, 0x22, 0x1b, 0xb0, 0x36,
-	0x3b, 0x53, 0xaf, 0xb6, 0xcc, 0x34, 0xd9, 0x82, 0x7b, 0x73, 0xa6, 0x0e, 0x1b, 0xd5, 0x96, 0x99,
-	0x99, 0x3b, 0xd9, 0xee, 0x1c, 0x1e, 0xd6, 0xbf, 0x32, 0xb3, 0x37, 0x2c, 0x77, 0x68, 0x16, 0xc9,
-	0x7d, 0xd8, 0x9a, 0x99, 0x39, 0xad, 0xd3, 0x5a, 0xbd, 0xd5, 0x69, 0x1c, 0xd7, 0xcd, 0x05, 0xb2,
-	0x0a, 0x66, 0xed, 0xac, 0xdd, 0x39, 0x69, 0x26, 0x08, 0xe6, 0x22, 0xb9, 0x07, 0x2b, 0x8a, 0xac,
-	0x5d, 0x6d, 0x9e, 0x1e, 0xd7, 0x4f, 0x4f, 0x1a, 0xad, 0x4e, 0xdb, 0xcc, 0x91, 0x15, 0x28, 0x1f,
-	0xd4, 0x5b, 0xb5, 0x27, 0xcd, 0x2a, 0x7d, 0x66, 0xb7, 0x6b, 0x27, 0xb4, 0x6e, 0xe6, 0x49, 0x19,
-	0x0a, 0x75, 0x4a, 0x4f, 0xa8, 0x12, 0x0c, 0x58, 0xbf, 0x36, 0x20, 0x4f, 0xc7, 0xde, 0xc1, 0xd8,
-	0xeb, 0x0d, 0x18, 0xd9, 0x87, 0xd2, 0x39, 0xf3, 0xba, 0x97, 0x43, 0x27, 0x78, 0x61, 0xbb, 0xde,
-	0x85, 0x8f, 0x96, 0x52, 0xd8, 0x5b, 0x91, 0x96, 0x72, 0x10, 0xcd, 0x89, 0xfb, 0x47, 0x97, 0xce,
-	0xf5, 0x21, 0xd9, 0x81, 0x5c, 0x30, 0xf6, 0x24, 0x95, 0xb4, 0xca, 0x25, 0x65, 0x95, 0x63, 0x0f,
-	0xf1, 0x17, 0x03, 0xf9, 0x83, 0x7c, 0x02, 0x70, 0xee, 0x84, 0xdd, 0x4b, 0x7b, 0xe0, 0xf2, 0xb0,
-	0x92, 0xde, 0x4e, 0xef, 0x14, 0x62, 0x8f, 0xe7, 0x0c, 0x47, 0x03, 0x76, 0x20, 0x66, 0x69, 0x1e,
-	0x91, 0x8e, 0x5d, 0x1e, 0x5a, 0xbf, 0x34, 0xc0, 0x6c, 0x70, 0x3e, 0x66, 0x9d, 0xc0, 0xe9, 0xbe,
-	0x60, 0x01, 0xb2, 0x79, 0x0e, 0xe6, 0xf9, 0xb8, 0xef, 0x78, 0xee, 0x2b, 0x16, 0xd8, 0x5d, 0xdf,
-	0xbb, 0x70, 0xfb, 0x6a, 0xbb, 0xff, 0x4f, 0x32, 0x9b, 0xa6, 0xd8, 0x3d, 0x88, 0xd0, 0x6b, 0x88,
-	0x4d, 0xcb, 0xe7, 0x93, 0x80, 0xcd, 0xcf, 0xa0, 0x3c, 0x85, 0x23, 0x3c, 0x6e, 0xd7, 0x1f, 0x8e,
-	0x7c, 0x8f, 0x79, 0xa1, 0xed, 0xf6, 0xd4, 0x35, 0x2c, 0xc4, 0xb0, 0x46, 0xcf, 0xfa, 0x67, 0x03,
-	0x0a, 0xa7, 0x81, 0xff, 0x0b, 0xd6, 0x0d, 0x71, 0x63, 0x1f, 0x40, 0x71, 0x24, 0x87, 0xb6, 0xe6,
-	0x23, 0x0a, 0x0a, 0x26, 0x7c, 0x08, 0xf9, 0x10, 0x96, 0x22, 0x14, 0x67, 0xe0, 0x3a, 0x5c, 0xdd,
-	0xac, 0x88, 0xae, 0x2a, 0x60, 0xe4, 0x3d, 0x00, 0xff, 0x5b, 0x8f, 0x05, 0x89, 0x9c, 0xf2, 0x34,
-	0x8f, 0x10, 0x21, 0x14, 0xf2, 0x14, 0xd6, 0x7a, 0xec, 0xc2, 0x19, 0x0f, 0x42, 0xdb, 0x15, 0x27,
-	0xb5, 0x43, 0x79, 0x54, 0xbc, 0x34, 0x85, 0xbd, 0xf5, 0xf9, 0x42, 0xa0, 0x2b, 0x8a, 0x48, 0x9f,
-	0xb0, 0x42, 0x58, 0xd7, 0x4e, 0xf0, 0x98, 0x85, 0x94, 0xf1, 0x91, 0xef, 0x71, 0x46, 0x7e, 0x00,
-	0x0b, 0x1c, 0xc3, 0x90, 0x92, 0x6d, 0x51, 0x0f, 0x4d, 0x54, 0xcd, 0x91, 0xcf, 0x92, 0x23, 0x6b,
-	0x06, 0xa0, 0x94, 0xaa, 0x71, 0x8e, 0xa5, 0x20, 0x06, 0x56, 0x17, 0x4c, 0x6d, 0xee, 0xf9, 0x98,
-	0x05, 0xd7, 0x64, 0x1d, 0x16, 0xba, 0xe3, 0x80, 0xfb, 0x81, 0x12, 0x9b, 0x1a, 0xa1, 0xab, 0x71,
-	0x87, 0x6e, 0x88, 0xac, 0xb3, 0x54, 0x0e, 0x66, 0x44, 0x9d, 0x9e, 0x11, 0xb5, 0xf5, 0x97, 0x06,
-	0x54, 0xa6, 0x57, 0x79, 0xc3, 0xd3, 0xfd, 0x0e, 0x2c, 0xeb, 0xa7, 0x93, 0xfa, 0x48, 0xe9, 0x76,
-	0xab, 0x1f, 0xb1, 0xac, 0x1d, 0x11, 0x15, 0x95, 0x1c, 0x29, 0xad, 0x1f, 0xc9, 0xfa, 0x93, 0x2c,
-	0x2c, 0x4d, 0x5c, 0x29, 0x61, 0x16, 0xc9, 0xfd, 0x4b, 0x22, 0x53, 0x31, 0x06, 0x0a, 0xa7, 0xfb,
-	0x40, 0xbf, 0xa4, 0x78, 0x6a, 0x69, 0x3c, 0x09, 0x29, 0x9a, 0xd8, 0xed, 0xa2, 0x99, 0x32, 0xb0,
-	0xcc, 0xb4, 0x81, 0x7d, 0x0e, 0xa6, 0xeb, 0x8d, 0xc6, 0xa1, 0x2d, 0x03, 0x00, 0x2a, 0x36, 0x8b,
-	0x62, 0x2a, 0x4f, 0xc5, 0x62, 0x5a, 0x42, 0xc4, 0x24, 0x1f, 0xf8, 0x1c, 0xcc, 0x21, 0x0b, 0x03,
-	0xb7, 0xab, 0x09, 0x6c, 0x01, 0x05, 0x36, 0x4b, 0x2a, 0x11, 0x63, 0x69, 0x9d, 0xc2, 0xbb, 0xdd,
-	0x31, 0x0f, 0xfd, 0xa1, 0xed, 0xf4, 0xfb, 0x01, 0xeb, 0x3b, 0x22, 0x17, 0xd0, 0xd8, 0x2c, 0xce,
-	0x67, 0xb3, 0x21, 0x89, 0xaa, 0x09, 0x4d, 0xcc, 0x71, 0x2a, 0xd3, 0xc8, 0xcd, 0x66, 0x1a, 0x5f,
-	0xc0, 0xe6, 0xdc, 0x88, 0x25, 0x57, 0xcc, 0x6f, 0xa7, 0x77, 0xb2, 0xf4, 0xde, 0x9c, 0xb0, 0x85,
-	0xec, 0x3f, 0x82, 0x9c, 0x33, 0xbe, 0x92, 0xf1, 0x0a, 0xf4, 0xcd, 0xc5, 0xd9, 0x02, 0x5d, 0x74,
-	0xc6, 0x57, 0x98, 0x36, 0xec, 0x80, 0x19, 0xb0, 0xd0, 0x71, 0x3d, 0xd6, 0xb3, 0x85, 0xb7, 0x0c,
-	0x9d, 0x7e, 0xa5, 0x80, 0xfb, 0x29, 0x45, 0x70, 0x3a, 0xf6, 0x3a, 0x4e, 0x9f, 0x7c, 0x02, 0xa5,
-	0xf3, 0xb1, 0x3b, 0xe8, 0xd9, 0x6e, 0xcf, 0x96, 0x31, 0xb6, 0x28, 0xf0, 0xf6, 0xa1, 0x76, 0x29,
-	0xc2, 0xbb, 0xd8, 0x18, 0x2d, 0x22, 0x46, 0xa3, 0x87, 0x09, 0x03, 0xf9, 0x02, 0x56, 0x62, 0x8a,
-	0x71, 0x30, 0xb0, 0x2f, 0xfc, 0x60, 0xe8, 0x84, 0x95, 0x25, 0x24, 0x2b, 0x5e, 0x86, 0xe1, 0x68,
-	0xff, 0xe1, 0xc3, 0xee, 0xe0, 0xe1, 0x83, 0x1e, 0x35, 0x15, 0xe1, 0x59, 0x30, 0x38, 0x42, 0x2c,
-	0xab, 0x07, 0x4b, 0x74, 0xec, 0x55, 0x3d, 0xcf, 0x0f, 0x51, 0x78, 0x6f, 0x21, 0xa3, 0x4b, 0xcf,
-	0xc8, 0xd9, 0xfa, 0xc7, 0x05, 0x58, 0x54, 0xe1, 0xe0, 0x6e, 0xb6, 0x7e, 0x0f, 0x44, 0xd4, 0xd0,
-	0x72, 0x8f, 0x85, 0x60, 0xec, 0x89, 0x89, 0x0f, 0xa0, 0x18, 0xba, 0x43, 0xc6, 0x43, 0x67, 0x38,
-	0xb2, 0x87, 0x1c, 0x17, 0x33, 0x68, 0x21, 0x86, 0x35, 0x39, 0xd9, 0x80, 0x5c, 0x24, 0x8f, 0x0a,
-	0xd9, 0x36, 0x76, 0xd2, 0x74, 0x51, 0x1d, 0x9b, 0x7c, 0x0c, 0x66, 0x6f, 0x1c, 0x48, 0xcb, 0x12,
-	0x24, 0x82, 0x83, 0xf0, 0x9a, 0xc6, 0xbe, 0xf1, 0x09, 0x2d, 0x45, 0x53, 0x1d, 0x77, 0xc8, 0x9a,
-	0x5c, 0xa4, 0x75, 0xa1, 0xd3, 0xe7, 0x95, 0x2c, 0xde, 0x0f, 0xfc, 0x4d, 0x1e, 0xc1, 0xbd, 0x4b,
-	0x97, 0x87, 0x7e, 0xe0, 0x76, 0x9d, 0x81, 0x08, 0x3e, 0x21, 0xbb, 0x0a, 0x6d, 0x44, 0x5b, 0x41,
-	0xb4, 0xb5, 0x64, 0xba, 0x26, 0x67, 0x3b, 0x82, 0xee, 0x77, 0x41, 0x65, 0x31, 0x36, 0x26, 0x69,
-	0xfa, 0xc5, 0x20, 0xd2, 0x68, 0xf4, 0xe4, 0x8f, 0x96, 0x25, 0x32, 0x0e, 0xd0, 0xd6, 0x7e, 0x0c,
-	0xf9, 0xe8, 0x56, 0xb0, 0xca, 0xa2, 0x7e, 0x17, 0x23, 0xc3, 0x67, 0x34, 0xc1, 0x20, 0x3f, 0x80,
-	0x92, 0x8c, 0xb4, 0x2f, 0xd8, 0xb5, 0x5c, 0x2b, 0x87, 0xbb, 0x2b, 0x22, 0xf4, 0x19, 0xbb, 0x9e,
-	0x77, 0x3f, 0xf2, 0xb3, 0xf7, 0xe3, 0x4b, 0x28, 0x3b, 0xb1, 0x69, 0x48, 0x46, 0xd2, 0xd2, 0x57,
-	0xe2, 0x10, 0x9f, 0x98, 0x0e, 0x2d, 0x25, 0xb8, 0xc8, 0xff, 0x3d, 0x80, 0x4b, 0xff, 0x25, 0x0b,
-	0x6c, 0x21, 0x86, 0x4a, 0x19, 0xd9, 0xe7, 0x11, 0xd2, 0x61, 0x57, 0x21, 0xf9, 0x14, 0x0a, 0x21,
-	0xe3, 0xa1, 0xed, 0x8f, 0xc3, 0xd1, 0x38, 0x44, 0x33, 0x2f, 0xec, 0x99, 0x92, 0x71, 0x87, 0xf1,
-	0xf0, 0x04, 0xe1, 0x14, 0xc2, 0xf8, 0x37, 0x79, 0x04, 0xa5, 0xcb, 0xeb, 0x11, 0x0b, 0x06, 0x6e,
-	0x74, 0x47, 0x97, 0xe6, 0x5f, 0xbc, 0xa5, 0x18, 0x6d, 0xe6, 0xaa, 0x9a, 0xb7, 0x5c, 0xd5, 0x6d,
-	0x28, 0xe2, 0xb6, 0x46, 0x0e, 0xe7, 0xc2, 0x84, 0x96, 0x71, 0xdf, 0xb8, 0x8b, 0x53, 0x87, 0xf3,
-	0x46, 0x8f, 0xec, 0x83, 0x29, 0x37, 0x3e, 0x4a, 0xc4, 0x52, 0x42, 0xae, 0xfa, 0xee, 0x47, 0x52,
-	0x26, 0x61, 0xfc, 0x5b, 0xec, 0xe4, 0x69, 0x26, 0x57, 0x30, 0x8b, 0x74, 0xab, 0xc7, 0x46, 0x01,
-	0xeb, 0x3a, 0x21, 0xeb, 0xd9, 0x8e, 0xe7, 0x0c, 0xae, 0x45, 0x2a, 0x13, 0x30, 0x3e, 0x1e, 0x84,
-	0x9c, 0x9a, 0xd3, 0x10, 0xeb, 0x6f, 0x53, 0x50, 0x90, 0x19, 0xd2, 0xa9, 0xef, 0x7a, 0x21, 0xb9,
-	0x0f, 0x05, 0xcd, 0x41, 0xab, 0xca, 0x02, 0x12, 0x57, 0x4c, 0xbe, 0x84, 0x65, 0xe5, 0x86, 0xe5,
-	0x5d, 0xd6, 0x02, 0x97, 0xda, 0x62, 0x52, 0x12, 0xd1, 0xb2, 0x44, 0xc5, 0x01, 0x4a, 0xab, 0x05,
-	0xf7, 0x38, 0xae, 0x66, 0x27, 0x0a, 0xe5, 0x7a, 0xd2, 0xb6, 0xae, 0x27, 0x6d, 0x9a, 0x01, 0xac,
-	0xf1, 0x29, 0x08, 0x57, 0xf1, 0x24, 0x91, 0x7e, 0x06, 0x19, 0xbc, 0xaf, 0x33, 0xc0, 0x33, 0xed,
-	0x56, 0xa5, 0xf8, 0xeb, 0x5e, 0x18, 0x5c, 0xc7, 0xca, 0xd8, 0xdc, 0x87, 0xa2, 0x3e, 0x21, 0xea,
-	0xa6, 0xc4, 0x65, 0x88, 0x9f, 0x93, 0x35, 0x5b, 0x51, 0xd5, 0x6c, 0xfb, 0xa9, 0x9f, 0x1a, 0x56,
-	0x1f, 0xcc, 0xe9, 0x1d, 0x92, 0x55, 0xc8, 0xa0, 0x31, 0x22, 0x83, 0x27, 0xef, 0x50, 0x1c, 0x91,
-	0x87, 0x90, 0x8f, 0xed, 0x45, 0xa5, 0x30, 0xd3, 0xf6, 0xf1, 0xe4, 0x1d, 0x9a, 0xe0, 0x1c, 0x14,
-	0x01, 0x12, 0xd1, 0x58, 0x2f, 0x23, 0xed, 0xd4, 0x83, 0xc0, 0x0f, 0x6e, 0xd7, 0xce, 0x07, 0x50,
-	0x94, 0x82, 0x0a, 0xf4, 0x30, 0x5e, 0x50, 0xb0, 0x28, 0x4f, 0x64, 0x82, 0x59, 0x5c, 0xf0, 0x4b,
-	0xa7, 0x5a, 0x44, 0xa0, 0x2a, 0xd5, 0xad, 0xff, 0x34, 0xa2, 0x85, 0x31, 0x71, 0xfe, 0x2d, 0x3d,
-	0xeb, 0x16, 0xe4, 0x63, 0x9f, 0xa1, 0x96, 0xcb, 0x45, 0xee, 0x42, 0x64, 0x42, 0xca, 0x24, 0x46,
-	0x42, 0x5b, 0x49, 0xe2, 0x30, 0x95, 0xc1, 0xa3, 0x2e, 0x69, 0x99, 0x27, 0x03, 0xb4, 0x80, 0x84,
-	0x5c, 0x9e, 0x0a, 0xc9, 0xb3, 0xb3, 0xe4, 0x28, 0xc0, 0x88, 0x1c, 0x07, 0x58, 0x06, 0xfc, 0x75,
-	0x0a, 0xca, 0x4d, 0x34, 0xd2, 0xd8, 0xdb, 0x09, 0xe7, 0xa2, 0x4c, 0x3c, 0x39, 0x69, 0x5e, 0x42,
-	0xc4, 0x86, 0x4d, 0x48, 0x0f, 0x5d, 0x2f, 0x2a, 0xb0, 0x87, 0xae, 0x87, 0x10, 0xe7, 0x4a, 0x05,
-	0x0c, 0xf1, 0x53, 0x38, 0xf8, 0x21, 0x73, 0x64, 0x0b, 0xc2, 0xa0, 0xf8, 0x5b, 0xe4, 0x6c, 0x43,
-	0xd6, 0x73, 0x1d, 0x0f, 0x33, 0x1e, 0x83, 0xaa, 0x11, 0xf9, 0x31, 0x10, 0x1e, 0x3a, 0x5e, 0xcf,
-	0x09, 0x7a, 0x76, 0x8f, 0xbd, 0x74, 0x51, 0xf3, 0x95, 0x05, 0xc4, 0x59, 0x8e, 0x66, 0x0e, 0xa3,
-	0x09, 0xb2, 0x0f, 0x1b, 0x92, 0xd0, 0x76, 0xce, 0xb9, 0x3f, 0x18, 0x87, 0x4c, 0xa3, 0xca, 0x23,
-	0xd5, 0x3d, 0x89, 0x50, 0x55, 0xf3, 0x09, 0xed, 0x0f, 0xa1, 0xac, 0x25, 0x25, 0x71, 0xee, 0x63,
-	0xd0, 0x52, 0x02, 0x46, 0xa9, 0xae, 0x42, 0xb6, 0xeb, 0x8f, 0xbd, 0x10, 0x33, 0x9b, 0x34, 0x95,
-	0x03, 0xeb, 0xcf, 0x53, 0x50, 0x14, 0x7e, 0x39, 0x96, 0xd4, 0x2e, 0xac, 0x8c, 0xb9, 0x73, 0x3e,
-	0x60, 0xb6, 0xd2, 0x81, 0x24, 0x32, 0x90, 0x68, 0x59, 0x4e, 0x49, 0xf1, 0xd7, 0xc4, 0x04, 0xf9,
-	0x34, 0x2e, 0xc9, 0x27, 0xf0, 0x85, 0x28, 0xd3, 0x22, 0x4e, 0xaa, 0x48, 0xa6, 0x93, 0x3c, 0x04,
-	0x22, 0x15, 0x3b, 0x41, 0x91, 0x8e, 0x28, 0x4c, 0x9c, 0xd4, 0x09, 0x3e, 0x82, 0x72, 0x62, 0xaa,
-	0xbc, 0xeb, 0x07, 0x0c, 0xb5, 0x90, 0xc5, 0x38, 0x1c, 0xcf, 0xb4, 0xc5, 0x04, 0x39, 0x84, 0xb5,
-	0xa9, 0xc4, 0x90, 0xe9, 0x06, 0x34, 0xeb, 0xd0, 0x56, 0x26, 0x53, 0x42, 0x14, 0x96, 0xf5, 0x6f,
-	0x06, 0xe4, 0x13, 0x99, 0x34, 0x60, 0x4d, 0x59, 0xcf, 0x14, 0x4f, 0x03, 0x79, 0xae, 0x49, 0x9e,
-	0x53, 0x36, 0x47, 0x57, 0x86, 0x93, 0x00, 0xd4, 0xc2, 0xff, 0x87, 0x25, 0x71, 0xa1, 0x92, 0xf0,
-	0x2c, 0x1d, 0x08, 0x49, 0x22, 0x64, 0x4c, 0x5f, 0x0c, 0x74, 0xbd, 0xbc, 0x3e, 0xf9, 0x4c, 0xbf,
-	0x36, 0xf9, 0xb4, 0xfe, 0xd5, 0x00, 0x32, 0x51, 0x43, 0xfc, 0x26, 0x55, 0xd4, 0x8c, 0xc3, 0x48,
-	0xdf, 0xa9, 0xec, 0xc8, 0xdc, 0xa5, 0xec, 0xc8, 0xce, 0x96, 0x1d, 0xab, 0x90, 0xc5, 0x22, 0x03,
-	0xaf, 0x4d, 0x9e, 0xca, 0x81, 0xf5, 0x2b, 0x03, 0x36, 0x67, 0x4f, 0xf2, 0x86, 0x95, 0x5a, 0x72,
-	0xee, 0xd4, 0xc4, 0xb9, 0x6b, 0xb0, 0x32, 0xd9, 0xd8, 0xd0, 0x3d, 0xd7, 0xdc, 0xee, 0xc6, 0xf2,
-	0x44, 0x77, 0x03, 0x65, 0xfd, 0x77, 0x69, 0xbc, 0x51, 0xdf, 0xa9, 0x94, 0x35, 0xb7, 0x9c, 0x99,
-	0x70, 0xcb, 0xd3, 0xe9, 0x48, 0x61, 0x26, 0x1d, 0xd9, 0x82, 0xbc, 0x33, 0x60, 0x41, 0x88, 0xc4,
-	0x4b, 0xd2, 0x71, 0x23, 0x40, 0x90, 0x3f, 0x82, 0xbc, 0xe0, 0xeb, 0x07, 0x3d, 0x16, 0xa0, 0x9f,
-	0x28, 0xed, 0x95, 0x62, 0xcb, 0x3c, 0x11, 0xd0, 0xfd, 0xa4, 0x5b, 0x4a, 0x73, 0x81, 0x02, 0x8a,
-	0x82, 0x65, 0xe8, 0xca, 0x24, 0x39, 0xce, 0xb5, 0xa5, 0x47, 0x2c, 0x0d, 0x5d, 0xcc, 0x90, 0xa3,
-	0x74, 0x5b, 0x60, 0x3a, 0x57, 0x93, 0x98, 0x0b, 0x0a, 0xd3, 0xb9, 0xd2, 0x31, 0xb7, 0xa1, 0x28,
-	0x78, 0xc6, 0xc9, 0x79, 0x1e, 0x3d, 0x10, 0x0c, 0x5d, 0xef, 0x40, 0xe5, 0xe7, 0x02, 0xc3, 0xb9,
-	0x4a, 0x30, 0x40, 0x61, 0x38, 0x57, 0x11, 0x46, 0x94, 0x94, 0x2f, 0x6a, 0x49, 0xf9, 0x3a, 0x2c,
-	0x5c, 0xb8, 0x6c, 0xd0, 0xe3, 0x95, 0x22, 0x42, 0xd5, 0xc8, 0xfa, 0x63, 0x03, 0x56, 0x75, 0xbd,
-	0xbd, 0x25, 0x9b, 0xfa, 0x54, 0x5e, 0xf8, 0x69, 0x6b, 0x9a, 0xea, 0x7a, 0x15, 0x54, 0xd7, 0x2b,
-	0xee, 0x63, 0x69, 0x91, 0xfa, 0xfb, 0xb7, 0xa2, 0x89, 0xe0, 0x9e, 0x9d, 0x0c, 0xee, 0xd8, 0x29,
-	0x99, 0xde, 0xdd, 0x5b, 0x92, 0x55, 0x12, 0xf8, 0xb5, 0xce, 0x5f, 0xe6, 0xa6, 0xce, 0x9f, 0x0a,
-	0xfc, 0x07, 0x71, 0xff, 0xef, 0x29, 0x98, 0xb5, 0x80, 0xc9, 0xe4, 0xf2, 0xcd, 0x36, 0xa4, 0x12,
-	0xc5, 0x54, 0x9c, 0x28, 0x5a, 0x14, 0x56, 0x9b, 0x7e, 0xcf, 0xbd, 0x70, 0xbb, 0xbf, 0x09, 0xbf,
-	0x38, 0xd6, 0xa6, 0xf4, 0x58, 0xfb, 0x0c, 0x96, 0x30, 0x9e, 0xbd, 0x15, 0x66, 0x75, 0xd8, 0x6c,
-	0xb3, 0xae, 0x2f, 0x32, 0x89, 0xeb, 0x76, 0xe8, 0x07, 0x4e, 0x9f, 0x7d, 0x1d, 0xb8, 0x21, 0x6b,
-	0x88, 0xcc, 0x91, 0xfc, 0x10, 0x16, 0xce, 0xb1, 0x59, 0xab, 0x38, 0x97, 0x63, 0x73, 0x93, 0x3d,
-	0x5c, 0xaa, 0xa6, 0xad, 0x5f, 0xc0, 0xd6, 0x5c, 0x36, 0xaa, 0x84, 0xba, 0xdb, 0x0e, 0x1f, 0x08,
-	0x1b, 0xf4, 0x5e, 0x70, 0x55, 0x34, 0xcc, 0x54, 0x4b, 0x72, 0x56, 0xe4, 0x1a, 0xe5, 0x28, 0xa0,
-	0xf9, 0x81, 0xdc, 0xe8, 0xf7, 0xd3, 0x4b, 0xde, 0x07, 0x53, 0x19, 0xd6, 0x45, 0x9c, 0x25, 0xa5,
-	0xf5, 0x7c, 0x40, 0xda, 0xd5, 0x91, 0x3b, 0x60, 0xb4, 0xc4, 0xe3, 0xdf, 0x18, 0xb1, 0x6d, 0xd8,
-	0x8a, 0x73, 0x39, 0x27, 0xde, 0xbd, 0x2a, 0xe7, 0xb8, 0x6a, 0xa3, 0xde, 0x8f, 0xe5, 0x82, 0x88,
-	0xc9, 0x29, 0x65, 0x31, 0xc7, 0xe9, 0x06, 0xbf, 0x69, 0xca, 0xaa, 0x82, 0xa9, 0x01, 0xa5, 0xdc,
-	0x27, 0x2a, 0x78, 0xe3, 0xb6, 0x0a, 0xde, 0xfa, 0xaf, 0x14, 0x98, 0x87, 0xfe, 0xb7, 0x9e, 0x2a,
-	0x0a, 0xa4, 0x68, 0x75, 0xf1, 0x18, 0x6f, 0x2c, 0x9e, 0xd4, 0x1d, 0xc5, 0xf3, 0x13, 0x58, 0x9f,
-	0x28, 0x1e, 0xd1, 0x3a, 0x6d, 0x91, 0x3b, 0x2f, 0xa0, 0xb9, 0xae, 0x68, 0xf5, 0x22, 0x5a, 0x7f,
-	0xd3, 0xb9, 0x12, 0x44, 0x13, 0x19, 0x7e, 0x42, 0x94, 0x91, 0x44, 0x5a, 0x4e, 0x1f, 0x13, 0xc5,
-	0x6d, 0x0a, 0xee, 0xbe, 0x62, 0x88, 0x9c, 0x45, 0x64, 0xd9, 0xa6, 0x68, 0xbb, 0xaf, 0x98, 0xc0,
-	0x3a, 0x87, 0x77, 0x93, 0xd4, 0x3b, 0x11, 0x49, 0xac, 0xaf, 0x02, 0x4a, 0x62, 0x7b, 0x52, 0x5f,
-	0x9a, 0xec, 0x22, 0x85, 0x6d, 0xf2, 0x1b, 0xe7, 0x2c, 0x0a, 0xcb, 0x3a, 0x54, 0xaa, 0x6c, 0xae,
-	0xf3, 0x32, 0xee, 0xec, 0xbc, 0xfe, 0xc8, 0x80, 0xcd, 0xaa, 0x2a, 0xe5, 0x9f, 0xa8, 0xae, 0x10,
-	0xfa, 0xd6, 0xef, 0xf1, 0x9e, 0x58, 0xff, 0x9e, 0x86, 0xad, 0xb9, 0x9b, 0x78, 0x23, 0x77, 0x50,
-	0x85, 0x95, 0x38, 0xe4, 0xfd, 0xa1, 0xa0, 0xd6, 0x2d, 0x8a, 0x4c, 0x2c, 0x2d, 0xa3, 0x87, 0x19,
-	0x68, 0x23, 0xb4, 0xaa, 0x07, 0x50, 0xe8, 0xb3, 0x50, 0x4a, 0x92, 0x71, 0xf5, 0x91, 0x5a, 0x7e,
-	0xe0, 0x83, 0x3e, 0x0b, 0x0f, 0x24, 0x9c, 0x74, 0x81, 0x4c, 0xad, 0x34, 0x74, 0x46, 0x2a, 0x62,
-	0x3c, 0x52, 0xf7, 0xe5, 0xe6, 0xe3, 0x4c, 0x6c, 0xa2, 0xe9, 0x8c, 0x64, 0x37, 0xa1, 0x1c, 0x4c,
-	0x42, 0x37, 0xdb, 0x50, 0xd2, 0x10, 0x5d, 0x76, 0xe3, 0x01, 0x8d, 0xbb, 0x1f, 0x70, 0x33, 0x9c,
-	0x4c, 0x36, 0xa2, 0xd5, 0xe7, 0xb4, 0x2c, 0x8e, 0xf4, 0x96, 0x45, 0x61, 0xef, 0x93, 0x37, 0x3a,
-	0x96, 0xcb, 0xb8, 0xde, 0xe4, 0xf8, 0x65, 0x1a, 0x96, 0x22, 0x4a, 0x69, 0x57, 0x5f, 0x4a, 0x09,
-	0x86, 0xbe, 0x7d, 0xce, 0xa2, 0xe6, 0x52, 0xef, 0xa6, 0xa0, 0x21, 0x44, 0xd3, 0xf1, 0x0f, 0x98,
-	0x62, 0xd1, 0x23, 0x3f, 0x83, 0x15, 0xad, 0xc1, 0x29, 0x18, 0x69, 0x9a, 0x9e, 0x21, 0x5f, 0x4e,
-	0x70, 0xe9, 0x58, 0x36, 0xfd, 0xbe, 0x06, 0x32, 0xc5, 0x40, 0x28, 0x50, 0xba, 0xe6, 0x1f, 0x4d,
-	0x9e, 0x14, 0xf7, 0xbb, 0xfb, 0x44, 0x67, 0x11, 0xeb, 0xcc, 0xbc, 0x9c, 0x02, 0x6f, 0x36, 0x01,
-	0xe2, 0x85, 0xf9, 0x4d, 0xfb, 0x34, 0xee, 0xba, 0xcf, 0xcd, 0x2e, 0xac, 0xcd, 0x5d, 0x79, 0x8e,
-	0xbe, 0x3e, 0x9b, 0xd4, 0xd7, 0xfb, 0xf3, 0x4e, 0x91, 0x6c, 0x4d, 0xd7, 0xce, 0x7f, 0xa4, 0xa1,
-	0x14, 0xe1, 0xbd, 0xd1, 0x85, 0x7b, 0x1f, 0x20, 0x60, 0xfd, 0x80, 0x71, 0xee, 0xfa, 0xb2, 0x8b,
-	0x91, 0xa3, 0x1a, 0x44, 0x4f, 0xf4, 0x16, 0xa7, 0xfb, 0xe3, 0xa8, 0x73, 0xee, 0x72, 0x9c, 0x55,
-	0x1f, 0x3d, 0x22, 0x98, 0x40, 0x79, 0x0a, 0xab, 0x31, 0x4a, 0x18, 0xb8, 0x4e, 0x5f, 0x7d, 0xe2,
-	0x01, 0xdc, 0x4f, 0x45, 0x3b, 0x1d, 0x77, 0x79, 0x07, 0x11, 0xd0, 0xa7, 0x10, 0x67, 0x06, 0x26,
-	0x96, 0x93, 0xbd, 0x2e, 0xf5, 0x1d, 0x56, 0x56, 0x76, 0xb2, 0xff, 0xa5, 0x3e, 0xa4, 0x3e, 0x82,
-	0x7b, 0x9c, 0x05, 0xae, 0x33, 0x70, 0x5f, 0xb1, 0x9e, 0x3d, 0x81, 0x5d, 0xc0, 0x96, 0xdd, 0x5a,
-	0x32, 0xdd, 0xd0, 0xe8, 0xd6, 0x61, 0x41, 0x75, 0x86, 0xd5, 0xd7, 0x33, 0x39, 0x22, 0x1f, 0xc3,
-	0xb2, 0xc6, 0x4f, 0x6b, 0x1e, 0x17, 0xa9, 0x99, 0x4c, 0x28, 0x69, 0x7f, 0x08, 0x4b, 0x71, 0x37,
-	0x15, 0x5f, 0x40, 0xc8, 0xb4, 0xb8, 0x18, 0x01, 0xf1, 0x01, 0x81, 0x8e, 0xa4, 0xd5, 0xae, 0x31,
-	0x92, 0x48, 0x7b, 0x9e, 0x66, 0x72, 0x79, 0x13, 0xe8, 0x6a, 0x17, 0xbf, 0xc2, 0xc8, 0x26, 0x98,
-	0xd2, 0x00, 0xb7, 0xfe, 0x27, 0x0d, 0x64, 0x56, 0x60, 0x84, 0x42, 0x29, 0x16, 0xb4, 0xd0, 0x6b,
-	0xf4, 0xfe, 0xe2, 0xe3, 0x9b, 0x44, 0x3c, 0x05, 0xc2, 0x17, 0x19, 0x4b, 0x11, 0x0b, 0x61, 0x21,
-	0x8c, 0x3c, 0x85, 0x02, 0xf3, 0x5e, 0xba, 0x81, 0xef, 0x0d, 0x99, 0x4a, 0x20, 0x4b, 0x7b, 0x3b,
-	0x37, 0x32, 0xac, 0x27, 0xb8, 0xc8, 0x4d, 0x27, 0x26, 0x15, 0x58, 0xec, 0xfa, 0x43, 0xe4, 0x23,
-	0x45, 0x1c, 0x0d, 0x85, 0x5a, 0x93, 0x4f, 0xec, 0x6e, 0x2f, 0x7a, 0xa4, 0x13, 0xc3, 0x1a, 0x3d,
-	0xdd, 0x02, 0xb3, 0xaf, 0xb5, 0xc0, 0x85, 0x59, 0x0b, 0x7c, 0x0f, 0x20, 0xae, 0x58, 0xa3, 0x52,
-	0x2e, 0x1f, 0x95, 0xac, 0xdc, 0xfa, 0xf9, 0xb4, 0x34, 0x51, 0x4b, 0x39, 0xc8, 0xb4, 0x4e, 0x5a,
-	0x75, 0xf3, 0x1d, 0x52, 0x02, 0xa0, 0xf5, 0xc7, 0xb4, 0xde, 0x6e, 0x37, 0x4e, 0x5a, 0xa6, 0x41,
-	0x00, 0x16, 0x1a, 0x8f, 0x5b, 0x27, 0xb4, 0x6e, 0xa6, 0x08, 0x81, 0xd2, 0x51, 0xf5, 0xb8, 0x5d,
-	0xb7, 0x4f, 0x4f, 0xda, 0x8d, 0x4e, 0xe3, 0xab, 0xba, 0x99, 0x26, 0x05, 0x58, 0x3c, 0x6b, 0x3d,
-	0x6b, 0x9d, 0x7c, 0xdd, 0x32, 0x33, 0xd6, 0x73, 0x28, 0x4f, 0x09, 0x85, 0x94, 0xa1, 0x70, 0xd6,
-	0x6a, 0x9f, 0xd6, 0x6b, 0x8d, 0xa3, 0x46, 0xfd, 0xd0, 0x7c, 0x87, 0x2c, 0x41, 0xfe, 0x94, 0xd6,
-	0xdb, 0x67, 0x07, 0xcd, 0x46, 0xc7, 0x34, 0xc4, 0x7a, 0xa7, 0x27, 0xed, 0x8e, 0x1a, 0xa7, 0x70,
-	0x4c, 0x4f, 0x0e, 0xcf, 0x6a, 0x1d, 0xb1, 0x7e, 0xda, 0xfa, 0x87, 0x34, 0xbc, 0x7b, 0xe8, 0xf0,
-	0xcb, 0x73, 0x5f, 0xcb, 0x06, 0x59, 0xed, 0xd2, 0x09, 0x42, 0xe9, 0x92, 0xef, 0xd4, 0x98, 0xfd,
-	0x02, 0x4c, 0x99, 0x6f, 0x71, 0x36, 0x60, 0x5d, 0x99, 0xda, 0x4c, 0xa4, 0x6c, 0xc9, 0x7b, 0x1d,
-	0x5a, 0x46, 0xcc, 0x76, 0x8c, 0x18, 0x97, 0xc5, 0xe9, 0x89, 0x6f, 0x55, 0x6f, 0xaf, 0xf4, 0xcf,
-	0xdc, 0xb9, 0xf4, 0xcf, 0x7e, 0x67, 0xa5, 0xff, 0x06, 0xe4, 0x04, 0x46, 0x30, 0xf6, 0x64, 0x83,
-	0x21, 0x4b, 0x17, 0x87, 0xce, 0x15, 0x1d, 0x7b, 0x9c, 0x7c, 0x0e, 0x1b, 0x97, 0x6e, 0xff, 0x72,
-	0xe0, 0xf6, 0x2f, 0x43, 0x9b, 0x63, 0x90, 0xb4, 0x7d, 0xcf, 0xc6, 0x6f, 0x4d, 0xe8, 0x20, 0x73,
-	0x74, 0x3d, 0x46, 0x68, 0xe3, 0xfc, 0x89, 0xf7, 0x44, 0xcc, 0x5a, 0x7f, 0x66, 0xc0, 0x7a, 0xac,
-	0x3c, 0x3a, 0xf6, 0x34, 0xb5, 0x69, 0x26, 0x6e, 0x4c, 0x98, 0xf8, 0x7d, 0x28, 0x24, 0xbd, 0x67,
-	0xa9, 0xa5, 0x3c, 0x85, 0xb8, 0xf9, 0x7c, 0xcb, 0x7e, 0xd2, 0xaf, 0xdd, 0xcf, 0xbf, 0xa4, 0xe1,
-	0xc3, 0x78, 0x3f, 0x35, 0x7f, 0x38, 0x72, 0x02, 0x36, 0xcf, 0xa6, 0x9e, 0x43, 0x41, 0x31, 0xd6,
-	0x02, 0xdf, 0x27, 0x91, 0xa5, 0xdc, 0x4a, 0xbf, 0x2b, 0x57, 0xa5, 0x20, 0x99, 0x60, 0xe8, 0x9e,
-	0xa7, 0xf8, 0xd4, 0x9d, 0x15, 0x9f, 0x9e, 0xab, 0x78, 0x5d, 0x69, 0x99, 0x37, 0x50, 0x5a, 0xf6,
-	0x75, 0x42, 0xda, 0xfc, 0x95, 0x01, 0x0b, 0x12, 0x82, 0x1f, 0x53, 0x94, 0x1c, 0xb4, 0xe7, 0x72,
-	0x4a, 0x36, 0xf2, 0x03, 0xf9, 0xcc, 0xf5, 0x4b, 0xcd, 0xb9, 0x7e, 0x9f, 0x43, 0x79, 0xea, 0xfa,
-	0xe1, 0x89, 0xe6, 0xdd, 0xbe, 0xd2, 0xe4, 0xed, 0x8b, 0x2f, 0x5f, 0x26, 0xb9, 0x7c, 0xd6, 0x5f,
-	0x18, 0xf0, 0xde, 0xb4, 0x1a, 0x26, 0xad, 0x6b, 0x43, 0xe6, 0xf0, 0x68, 0x41, 0x06, 0x52, 0x2e,
-	0x4a, 0xf3, 0xe2, 0xdf, 0xa9, 0x7d, 0xfd, 0x01, 0xdc, 0x8f, 0xf7, 0xf5, 0x95, 0xcb, 0xc7, 0x18,
-	0x2e, 0x23, 0x77, 0x7b, 0x8b, 0xdd, 0x4f, 0xbb, 0xf6, 0xd4, 0x8c, 0x6b, 0xb7, 0xbe, 0x01, 0x48,
-	0xbe, 0x7e, 0xce, 0x7d, 0x2d, 0x59, 0xd1, 0xb3, 0xa9, 0xfc, 0x41, 0xaa, 0x12, 0x3d, 0xb4, 0x14,
-	0x61, 0x41, 0xaa, 0x00, 0xbf, 0x14, 0xa6, 0x31, 0xa4, 0xcb, 0xc7, 0x08, 0xf8, 0xe8, 0xef, 0xbf,
-	0x33, 0x90, 0x17, 0xbc, 0xdf, 0xc0, 0xa7, 0x6e, 0x40, 0x2e, 0x64, 0xc3, 0x91, 0xdd, 0x73, 0xa3,
-	0xc6, 0xd4, 0xa2, 0x18, 0x1f, 0xba, 0xf8, 0x95, 0x4e, 0x98, 0xaf, 0x3f, 0x16, 0x02, 0xec, 0x2a,
-	0xeb, 0x05, 0x05, 0x6a, 0xb3, 0xee, 0xdc, 0xaf, 0xbc, 0x99, 0xbb, 0x7d, 0xe5, 0x8d, 0x2d, 0x62,
-	0x41, 0x73, 0xc7, 0xd3, 0x8d, 0xdc, 0xc5, 0x99, 0x46, 0xae, 0xfe, 0x70, 0x21, 0x37, 0xf9, 0x70,
-	0xe1, 0x7b, 0xa8, 0x81, 0x6f, 0x6b, 0x8b, 0x14, 0x7f, 0xdb, 0xb6, 0x08, 0xf9, 0x7d, 0x58, 0x73,
-	0xbd, 0x90, 0x05, 0x9e, 0x33, 0xb0, 0x35, 0xd1, 0x72, 0xf5, 0xa6, 0x60, 0x27, 0x11, 0xab, 0x74,
-	0x51, 0x0d, 0x85, 0x9c, 0x08, 0x9a, 0xcb, 0xe2, 0x60, 0xc5, 0x9d, 0x9d, 0xd9, 0x3c, 0x82, 0xca,
-	0x4d, 0x04, 0xb7, 0x7d, 0x36, 0xce, 0x6b, 0x39, 0xfb, 0xd3, 0x4c, 0x2e, 0x6b, 0x2e, 0xd0, 0x12,
-	0xbe, 0xd3, 0x95, 0x8f, 0x44, 0x38, 0xeb, 0x5a, 0xef, 0xc2, 0xe6, 0xcd, 0x62, 0xb5, 0xfe, 0xd7,
-	0x80, 0x8d, 0x1b, 0x45, 0x42, 0xfe, 0xd4, 0x80, 0xfb, 0xd8, 0x15, 0xe1, 0xb6, 0xeb, 0xd9, 0x13,
-	0xef, 0x40, 0xce, 0xd9, 0xa5, 0xf3, 0xd2, 0x55, 0x2d, 0xe0, 0xd2, 0xde, 0xe7, 0xb7, 0x48, 0x77,
-	0x17, 0xfb, 0x27, 0xbc, 0xe1, 0x35, 0x92, 0xf7, 0x21, 0x72, 0x6a, 0x5f, 0x4f, 0x61, 0xe8, 0x16,
-	0x9b, 0xc5, 0x3b, 0x50, 0x4b, 0x59, 0xcf, 0x61, 0xe3, 0x46, 0x36, 0xb3, 0xb9, 0xd0, 0x32, 0x2c,
-	0xc9, 0xe4, 0xca, 0xc6, 0x07, 0xa4, 0x6d, 0xd3, 0x20, 0x26, 0x14, 0xf1, 0x19, 0x69, 0x04, 0x49,
-	0x59, 0x7f, 0x95, 0x51, 0xd7, 0x5e, 0x66, 0xdd, 0x5f, 0xaa, 0x97, 0x1d, 0x5a, 0xa1, 0x53, 0xda,
-	0xdb, 0x9a, 0x7e, 0xd9, 0x81, 0x3f, 0x55, 0xdd, 0x83, 0xd7, 0x40, 0x3d, 0x89, 0x3f, 0x52, 0xf5,
-	0x89, 0xc8, 0x3d, 0x65, 0x7a, 0xaf, 0xd7, 0xa0, 0xab, 0x93, 0xd5, 0x97, 0x7a, 0x24, 0x42, 0x9c,
-	0x89, 0xb1, 0xea, 0x38, 0x94, 0xf8, 0x78, 0x38, 0x74, 0x82, 0x6b, 0x7b, 0xa2, 0x90, 0x58, 0x52,
-	0xd0, 0xb8, 0x20, 0x2b, 0x09, 0x6f, 0xd7, 0x15, 0x9e, 0xd9, 0xc6, 0x17, 0x00, 0xaa, 0x46, 0x08,
-	0x94, 0xbb, 0x3e, 0x76, 0xbd, 0x17, 0x37, 0xa7, 0xbb, 0x3f, 0x87, 0x75, 0x7c, 0x62, 0x8f, 0x1f,
-	0x58, 0x2f, 0x1c, 0x77, 0x30, 0x0e, 0x98, 0x2c, 0x35, 0x16, 0xf0, 0xd8, 0x0f, 0x66, 0x8e, 0x4d,
-	0x23, 0xf4, 0x23, 0x89, 0x8d, 0x89, 0xf9, 0x6a, 0x30, 0x07, 0x1a, 0x79, 0x53, 0x25, 0x98, 0x1c,
-	0x64, 0x4e, 0xab, 0xed, 0xb6, 0x7c, 0xe2, 0x4e, 0xab, 0x9d, 0xba, 0x8d, 0x6f, 0xf2, 0x31, 0x21,
-	0x3d, 0xaa, 0x76, 0xaa, 0xc7, 0x72, 0x9c, 0x16, 0x3a, 0xab, 0xb6, 0xaa, 0xc7, 0xdf, 0xb4, 0x1b,
-	0x6d, 0x09, 0xca, 0x08, 0xbd, 0x36, 0x5a, 0xf6, 0x29, 0x3d, 0xc1, 0xbc, 0xd9, 0xcc, 0x5a, 0x1c,
-	0x56, 0xe7, 0x6d, 0x84, 0x6c, 0xc0, 0x9a, 0x4a, 0x96, 0xed, 0x13, 0x6a, 0x9f, 0xb5, 0xda, 0xf5,
-	0x8e, 0xdd, 0xf9, 0xe6, 0x54, 0xe4, 0xdd, 0x04, 0x4a, 0xcd, 0x6a, 0xbb, 0x53, 0xa7, 0x36, 0x15,
-	0x49, 0x23, 0x15, 0xb9, 0xf1, 0x3d, 0x58, 0x79, 0x7a, 0x72, 0x60, 0x37, 0xab, 0xad, 0xea, 0x63,
-	0x6d, 0x22, 0x45, 0x56, 0xa0, 0x2c, 0x1f, 0x26, 0x27, 0xc0, 0xb4, 0xf5, 0x0a, 0x8a, 0xb2, 0x65,
-	0x46, 0x59, 0xd7, 0x0f, 0x7a, 0xe4, 0xb3, 0xe8, 0x25, 0x84, 0x7c, 0x56, 0xa0, 0x4a, 0xe2, 0x39,
-	0x2f, 0x0a, 0x0a, 0xda, 0x8b, 0x02, 0x8d, 0x0a, 0xcd, 0x7c, 0xf2, 0xd1, 0xa9, 0xfe, 0x90, 0xa0,
-	0xa0, 0x35, 0x1d, 0xad, 0x63, 0x80, 0xa4, 0xe9, 0x39, 0xf3, 0x06, 0xc3, 0x98, 0x7d, 0x83, 0xb1,
-	0x05, 0x79, 0x6c, 0x9e, 0x8e, 0x9c, 0xf0, 0x32, 0x7a, 0x01, 0x2f, 0x00, 0xa7, 0x4e, 0x78, 0xf9,
-	0xd1, 0x4f, 0x21, 0x17, 0x65, 0xd1, 0x73, 0xeb, 0x87, 0xe4, 0x1f, 0x08, 0x06, 0x29, 0x42, 0xee,
-	0xe0, 0xac, 0x71, 0x7c, 0x68, 0x37, 0x0e, 0xcd, 0xd4, 0xff, 0x05, 0x00, 0x00, 0xff, 0xff, 0x71,
-	0x36, 0x0e, 0x12, 0x1a, 0x32, 0x00, 0x00,
-	0x9b, 0xe9, 0x6a, 0x8e, 0xa5, 0x39, 0xe6, 0x12, 0x04, 0xc8, 0xde, 0x82, 0xe4, 0xb0, 0x87, 0x3d,
-	0x04, 0xb9, 0xe4, 0x90, 0x43, 0x82, 0x1c, 0x12, 0x04, 0x48, 0x0e, 0x01, 0x72, 0xc9, 0xbf, 0x90,
-	0x5b, 0x90, 0x53, 0xfe, 0x84, 0x04, 0x08, 0xea, 0x55, 0x75, 0x77, 0xf1, 0x43, 0x23, 0xcd, 0xee,
-	0xd8, 0x37, 0xd6, 0xab, 0xf7, 0x5e, 0x55, 0xbd, 0xf7, 0xea, 0x7d, 0x75, 0x11, 0xd6, 0xf8, 0x88,
-	0x75, 0x1f, 0x8e, 0x02, 0x3f, 0xf4, 0x1f, 0x0e, 0x9d, 0x17, 0xfe, 0x2e, 0xfe, 0x24, 0x19, 0xf1,
-	0xdb, 0xfa, 0x07, 0x03, 0x16, 0xda, 0xa1, 0x13, 0x8e, 0x39, 0x79, 0x00, 0x99, 0xae, 0xdf, 0x63,
-	0x15, 0x63, 0xdb, 0xd8, 0x29, 0xed, 0x2d, 0xef, 0x22, 0xae, 0x9c, 0xdb, 0xad, 0xf9, 0x3d, 0x46,
-	0x71, 0x9a, 0x7c, 0x00, 0xc5, 0x0b, 0xc7, 0x1d, 0xd8, 0x43, 0xc6, 0xb9, 0xd3, 0x67, 0x95, 0xd4,
-	0xb6, 0xb1, 0x93, 0xa7, 0x05, 0x01, 0x6b, 0x4a, 0x10, 0xd9, 0x82, 0x6c, 0xc0, 0xc2, 0xe0, 0xba,
-	0x92, 0xde, 0x36, 0x76, 0x72, 0xfb, 0xd9, 0x0b, 0x67, 0xc0, 0x19, 0x95, 0x30, 0xf2, 0x23, 0x30,
-	0xbf, 0x75, 0x02, 0xcf, 0xf5, 0xfa, 0x11, 0x0b, 0x5e, 0xc9, 0x6c, 0xa7, 0x77, 0xf2, 0xb4, 0xac,
-	0xe0, 0x8a, 0x0d, 0xb7, 0xde, 0x83, 0x8c, 0x58, 0x98, 0x14, 0x60, 0xb1, 0x7d, 0x56, 0xab, 0xd5,
-	0xdb, 0x6d, 0xf3, 0x1d, 0x92, 0x83, 0xcc, 0x51, 0xb5, 0x71, 0x6c, 0x1a, 0xd6, 0xdf, 0x18, 0x90,
-	0xff, 0xca, 0x19, 0x8c, 0x59, 0xc3, 0xbb, 0xf0, 0xc9, 0x16, 0xe4, 0x5f, 0x8a, 0x81, 0xfd, 0x82,
-	0x5d, 0xe3, 0x19, 0xf2, 0x34, 0x87, 0x80, 0x67, 0xec, 0x9a, 0xac, 0x42, 0x76, 0xe0, 0x9c, 0xb3,
-	0x81, 0xda, 0xad, 0x1c, 0x90, 0x6d, 0x28, 0xf4, 0x18, 0xef, 0x06, 0xee, 0x28, 0x74, 0x7d, 0xaf,
-	0x92, 0x91, 0x27, 0xd1, 0x40, 0x64, 0x07, 0x32, 0xe1, 0xf5, 0x88, 0xe1, 0x41, 0x4a, 0x7b, 0xab,
-	0x52, 0x26, 0xf1, 0x9a, 0xbb, 0x9d, 0xeb, 0x11, 0xa3, 0x88, 0x61, 0x59, 0x90, 0x11, 0x23, 0xb1,
-	0xd7, 0xd6, 0x59, 0xb3, 0x4e, 0x1b, 0x35, 0xd3, 0x20, 0x4b, 0x90, 0xef, 0x34, 0x9a, 0xf5, 0x76,
-	0xa7, 0xda, 0x3c, 0x35, 0x53, 0xd6, 0xcf, 0x00, 0x9e, 0xb1, 0x6b, 0xd6, 0x43, 0x06, 0xb7, 0x6e,
-	0x18, 0x7f, 0xe3, 0x86, 0x0d, 0x2a, 0x07, 0xd6, 0x4f, 0x20, 0xdf, 0x72, 0x86, 0xac, 0x77, 0xe8,
-	0x84, 0x0e, 0x21, 0x90, 0xf1, 0x9c, 0x21, 0x53, 0xa4, 0xf8, 0x5b, 0xc0, 0x7a, 0x4e, 0xe8, 0xa8,
-	0x63, 0xe2, 0x6f, 0xeb, 0x21, 0x64, 0xa9, 0xe3, 0xf5, 0x99, 0xe0, 0xc9, 0x43, 0x27, 0x08, 0x91,
-	0xc2, 0xa0, 0x72, 0x40, 0x4c, 0x48, 0x33, 0xaf, 0xa7, 0xd6, 0x11, 0x3f, 0xad, 0xc7, 0x50, 0x3c,
-	0x16, 0xf2, 0x61, 0xbd, 0x98, 0x4e, 0x0a, 0xcf, 0xd0, 0x85, 0xf7, 0x01, 0x64, 0x03, 0x31, 0x8d,
-	0x94, 0x85, 0xbd, 0x82, 0x94, 0x0d, 0x52, 0x50, 0x39, 0x63, 0xfd, 0x32, 0x03, 0x20, 0xb6, 0x7a,
-	0xe4, 0x0e, 0x42, 0x16, 0x90, 0x47, 0x90, 0x17, 0x1b, 0xb2, 0x51, 0xa2, 0xd2, 0xca, 0x36, 0x24,
-	0x55, 0x82, 0x84, 0x3f, 0x51, 0xac, 0xb9, 0x9e, 0xfa, 0x35, 0x29, 0xa8, 0xd4, 0x94, 0xa0, 0xf6,
-	0x60, 0x6d, 0xc4, 0x82, 0x2e, 0xf3, 0x42, 0x77, 0xc0, 0xec, 0xa1, 0x3b, 0x18, 0xb8, 0x76, 0xe0,
-	0x78, 0x2f, 0x50, 0x65, 0x59, 0xba, 0x92, 0x4c, 0x36, 0xc5, 0x1c, 0x75, 0xbc, 0x17, 0xe4, 0x33,
-	0x58, 0x71, 0xfb, 0x9e, 0x1f, 0x08, 0x7c, 0xce, 0x85, 0x25, 0xa2, 0xd0, 0x32, 0x68, 0xad, 0x99,
-	0x30, 0x18, 0x33, 0xba, 0x2c, 0x11, 0x9a, 0x72, 0x5e, 0x6c, 0xca, 0xfa, 0xe7, 0x14, 0xe4, 0xa2,
-	0xdd, 0x91, 0x4d, 0x58, 0x6f, 0xd6, 0x3b, 0xb4, 0x51, 0xb3, 0xab, 0x8f, 0x1f, 0xd3, 0xfa, 0xe3,
-	0x6a, 0xa7, 0x6e, 0xd7, 0x4e, 0xce, 0x5a, 0x1d, 0xb3, 0x40, 0x2a, 0xb0, 0x3a, 0x33, 0xd7, 0x6c,
-	0xb4, 0x4c, 0x63, 0xfe, 0x4c, 0xf5, 0xf7, 0xcc, 0x14, 0xd9, 0x80, 0xb5, 0xd9, 0x99, 0x7a, 0xb5,
-	0x65, 0xa6, 0xc9, 0x16, 0xdc, 0x9b, 0x33, 0x75, 0xd8, 0xa8, 0xb6, 0xcc, 0xcc, 0xdc, 0xc9, 0x76,
-	0xe7, 0xf0, 0xb0, 0xfe, 0x95, 0x99, 0xbd, 0x61, 0xb9, 0x43, 0xb3, 0x48, 0xee, 0xc3, 0xd6, 0xcc,
-	0xcc, 0x69, 0x9d, 0xd6, 0xea, 0xad, 0x4e, 0xe3, 0xb8, 0x6e, 0x2e, 0x90, 0x55, 0x30, 0x6b, 0x67,
-	0xed, 0xce, 0x49, 0x33, 0x41, 0x30, 0x17, 0xc9, 0x3d, 0x58, 0x51, 0x64, 0xed, 0x6a, 0xf3, 0xf4,
-	0xb8, 0x7e, 0x7a, 0xd2, 0x68, 0x75, 0xda, 0x66, 0x8e, 0xac, 0x40, 0xf9, 0xa0, 0xde, 0xaa, 0x3d,
-	0x69, 0x56, 0xe9, 0x33, 0xbb, 0x5d, 0x3b, 0xa1, 0x75, 0x33, 0x4f, 0xca, 0x50, 0xa8, 0x53, 0x7a,
-	0x42, 0x95, 0x60, 0xc0, 0xfa, 0x4b, 0x03, 0xf2, 0x74, 0xec, 0x1d, 0x8c, 0xbd, 0xde, 0x80, 0x91,
-	0x7d, 0x28, 0x9d, 0x33, 0xaf, 0x7b, 0x39, 0x74, 0x82, 0x17, 0xb6, 0xeb, 0x5d, 0xf8, 0x68, 0x13,
-	0x85, 0xbd, 0x15, 0x69, 0x13, 0x07, 0xd1, 0x9c, 0xb8, 0x69, 0x74, 0xe9, 0x5c, 0x1f, 0x92, 0x1d,
-	0xc8, 0x05, 0x63, 0x4f, 0x52, 0x49, 0xfb, 0x5b, 0x52, 0xf6, 0x37, 0xf6, 0x10, 0x7f, 0x31, 0x90,
-	0x3f, 0xc8, 0x27, 0x00, 0xe7, 0x4e, 0xd8, 0xbd, 0xb4, 0x07, 0x2e, 0x0f, 0x2b, 0xe9, 0xed, 0xf4,
-	0x4e, 0x21, 0xf6, 0x6d, 0xce, 0x70, 0x34, 0x60, 0x07, 0x62, 0x96, 0xe6, 0x11, 0xe9, 0xd8, 0xe5,
-	0xa1, 0xf5, 0x2b, 0x03, 0xcc, 0x06, 0xe7, 0x63, 0xd6, 0x09, 0x9c, 0xee, 0x0b, 0x16, 0x20, 0x9b,
-	0xe7, 0x60, 0x9e, 0x8f, 0xfb, 0x8e, 0xe7, 0xbe, 0x62, 0x81, 0xdd, 0xf5, 0xbd, 0x0b, 0xb7, 0xaf,
-	0xb6, 0xfb, 0xff, 0x24, 0xb3, 0x69, 0x8a, 0xdd, 0x83, 0x08, 0xbd, 0x86, 0xd8, 0xb4, 0x7c, 0x3e,
-	0x09, 0xd8, 0xfc, 0x0c, 0xca, 0x53, 0x38, 0xc2, 0xb7, 0x76, 0xfd, 0xe1, 0xc8, 0xf7, 0x98, 0x17,
-	0xda, 0x6e, 0x4f, 0x5d, 0xb8, 0x42, 0x0c, 0x6b, 0xf4, 0xac, 0x7f, 0x31, 0xa0, 0x70, 0x1a, 0xf8,
-	0xbf, 0x60, 0xdd, 0x10, 0x37, 0xf6, 0x01, 0x14, 0x47, 0x72, 0x68, 0x6b, 0xde, 0xa0, 0xa0, 0x60,
-	0xc2, 0x5b, 0x90, 0x0f, 0x61, 0x29, 0x42, 0x71, 0x06, 0xae, 0xc3, 0xd5, 0x1d, 0x8a, 0xe8, 0xaa,
-	0x02, 0x46, 0xde, 0x03, 0xf0, 0xbf, 0xf5, 0x58, 0x90, 0xc8, 0x29, 0x4f, 0xf3, 0x08, 0x11, 0x42,
-	0x21, 0x4f, 0x61, 0xad, 0xc7, 0x2e, 0x9c, 0xf1, 0x20, 0xb4, 0x5d, 0x71, 0x52, 0x3b, 0x94, 0x47,
-	0xc5, 0x4b, 0x53, 0xd8, 0x5b, 0x9f, 0x2f, 0x04, 0xba, 0xa2, 0x88, 0xf4, 0x09, 0x2b, 0x84, 0x75,
-	0xed, 0x04, 0x8f, 0x59, 0x48, 0x19, 0x1f, 0xf9, 0x1e, 0x67, 0xe4, 0x07, 0xb0, 0xc0, 0x31, 0xe0,
-	0x28, 0xd9, 0x16, 0xf5, 0x20, 0x44, 0xd5, 0x1c, 0xf9, 0x2c, 0x39, 0xb2, 0x66, 0x00, 0x4a, 0xa9,
-	0x1a, 0xe7, 0x58, 0x0a, 0x62, 0x60, 0x75, 0xc1, 0xd4, 0xe6, 0x9e, 0x8f, 0x59, 0x70, 0x4d, 0xd6,
-	0x61, 0xa1, 0x3b, 0x0e, 0xb8, 0x1f, 0x28, 0xb1, 0xa9, 0x11, 0x7a, 0x3c, 0x77, 0xe8, 0x86, 0xc8,
-	0x3a, 0x4b, 0xe5, 0x60, 0x46, 0xd4, 0xe9, 0x19, 0x51, 0x5b, 0x7f, 0x61, 0x40, 0x65, 0x7a, 0x95,
-	0x37, 0x3c, 0xdd, 0xef, 0xc0, 0xb2, 0x7e, 0x3a, 0xa9, 0x8f, 0x94, 0x6e, 0xb7, 0xfa, 0x11, 0xcb,
-	0xda, 0x11, 0x51, 0x51, 0xc9, 0x91, 0xd2, 0xfa, 0x91, 0xac, 0x3f, 0xc9, 0xc2, 0xd2, 0xc4, 0x95,
-	0x12, 0x66, 0x91, 0xdc, 0xbf, 0x24, 0x06, 0x15, 0x63, 0xa0, 0x70, 0xaf, 0x0f, 0xf4, 0x4b, 0x8a,
-	0xa7, 0x96, 0xc6, 0x93, 0x90, 0xa2, 0x89, 0xdd, 0x2e, 0x9a, 0x29, 0x03, 0xcb, 0x4c, 0x1b, 0xd8,
-	0xe7, 0x60, 0xba, 0xde, 0x68, 0x1c, 0xda, 0xd2, 0xd5, 0xa3, 0x62, 0xb3, 0x28, 0xa6, 0xf2, 0x54,
-	0xd4, 0xa5, 0x25, 0x44, 0x4c, 0x22, 0xff, 0xe7, 0x60, 0x0e, 0x59, 0x18, 0xb8, 0x5d, 0x4d, 0x60,
-	0x0b, 0x28, 0xb0, 0x59, 0x52, 0x89, 0x18, 0x4b, 0xeb, 0x14, 0xde, 0xed, 0x8e, 0x79, 0xe8, 0x0f,
-	0x6d, 0xa7, 0xdf, 0x0f, 0x58, 0xdf, 0x11, 0x51, 0x5f, 0x63, 0xb3, 0x38, 0x9f, 0xcd, 0x86, 0x24,
-	0xaa, 0x26, 0x34, 0x31, 0xc7, 0xa9, 0x9c, 0x22, 0x37, 0x9b, 0x53, 0x7c, 0x01, 0x9b, 0x73, 0x23,
-	0x96, 0x5c, 0x31, 0xbf, 0x9d, 0xde, 0xc9, 0xd2, 0x7b, 0x73, 0xc2, 0x16, 0xb2, 0xff, 0x08, 0x72,
-	0xce, 0xf8, 0x4a, 0xc6, 0x2b, 0xd0, 0x37, 0x17, 0xe7, 0x05, 0x74, 0xd1, 0x19, 0x5f, 0x61, 0x82,
-	0xb0, 0x03, 0x66, 0xc0, 0x42, 0xc7, 0xf5, 0x58, 0xcf, 0x16, 0xde, 0x32, 0x74, 0xfa, 0x95, 0x02,
-	0xee, 0xa7, 0x14, 0xc1, 0xe9, 0xd8, 0xeb, 0x38, 0x7d, 0xf2, 0x09, 0x94, 0xce, 0xc7, 0xee, 0xa0,
-	0x67, 0xbb, 0x3d, 0x5b, 0x86, 0xfa, 0xa2, 0xc0, 0xdb, 0x87, 0xda, 0xa5, 0x08, 0xe4, 0x62, 0x63,
-	0xb4, 0x88, 0x18, 0x8d, 0x1e, 0xa6, 0x06, 0xe4, 0x0b, 0x58, 0x89, 0x29, 0xc6, 0xc1, 0xc0, 0xbe,
-	0xf0, 0x83, 0xa1, 0x13, 0x56, 0x96, 0x90, 0xac, 0x78, 0x19, 0x86, 0xa3, 0xfd, 0x87, 0x0f, 0xbb,
-	0x83, 0x87, 0x0f, 0x7a, 0xd4, 0x54, 0x84, 0x67, 0xc1, 0xe0, 0x08, 0xb1, 0xac, 0x1e, 0x2c, 0xd1,
-	0xb1, 0x57, 0xf5, 0x3c, 0x3f, 0x44, 0xe1, 0xbd, 0x85, 0xdc, 0x2d, 0x3d, 0x23, 0x67, 0xeb, 0x9f,
-	0x16, 0x60, 0x51, 0x85, 0x83, 0xbb, 0xd9, 0xfa, 0x3d, 0x10, 0x51, 0x43, 0xcb, 0x32, 0x16, 0x82,
-	0xb1, 0x27, 0x26, 0x3e, 0x80, 0x62, 0xe8, 0x0e, 0x19, 0x0f, 0x9d, 0xe1, 0xc8, 0x1e, 0x72, 0x5c,
-	0xcc, 0xa0, 0x85, 0x18, 0xd6, 0xe4, 0x64, 0x03, 0x72, 0x91, 0x3c, 0x2a, 0x64, 0xdb, 0xd8, 0x49,
-	0xd3, 0x45, 0x75, 0x6c, 0xf2, 0x31, 0x98, 0xbd, 0x71, 0x20, 0x2d, 0x4b, 0x90, 0x08, 0x0e, 0xc2,
-	0x6b, 0x1a, 0xfb, 0xc6, 0x27, 0xb4, 0x14, 0x4d, 0x75, 0xdc, 0x21, 0x6b, 0x72, 0x91, 0xc0, 0x85,
-	0x4e, 0x9f, 0x57, 0xb2, 0x78, 0x3f, 0xf0, 0x37, 0x79, 0x04, 0xf7, 0x2e, 0x5d, 0x1e, 0xfa, 0x81,
-	0xdb, 0x75, 0x06, 0x22, 0xf8, 0x84, 0xec, 0x2a, 0xb4, 0x11, 0x6d, 0x05, 0xd1, 0xd6, 0x92, 0xe9,
-	0x9a, 0x9c, 0xed, 0x08, 0xba, 0xdf, 0x05, 0x95, 0xc5, 0xd8, 0x98, 0x8e, 0xe9, 0x17, 0x83, 0x48,
-	0xa3, 0xd1, 0xd3, 0x3c, 0x5a, 0x96, 0xc8, 0x38, 0x40, 0x5b, 0xfb, 0x31, 0xe4, 0xa3, 0x5b, 0xc1,
-	0x2a, 0x8b, 0xfa, 0x5d, 0x8c, 0x0c, 0x9f, 0xd1, 0x04, 0x83, 0xfc, 0x00, 0x4a, 0x32, 0xd2, 0xbe,
-	0x60, 0xd7, 0x72, 0xad, 0x1c, 0xee, 0xae, 0x88, 0xd0, 0x67, 0xec, 0x7a, 0xde, 0xfd, 0xc8, 0xcf,
-	0xde, 0x8f, 0x2f, 0xa1, 0xec, 0xc4, 0xa6, 0x21, 0x19, 0x49, 0x4b, 0x5f, 0x89, 0x43, 0x7c, 0x62,
-	0x3a, 0xb4, 0x94, 0xe0, 0x22, 0xff, 0xf7, 0x00, 0x2e, 0xfd, 0x97, 0x2c, 0xb0, 0x85, 0x18, 0x2a,
-	0x65, 0x64, 0x9f, 0x47, 0x48, 0x87, 0x5d, 0x85, 0xe4, 0x53, 0x28, 0x84, 0x8c, 0x87, 0xb6, 0x3f,
-	0x0e, 0x47, 0xe3, 0x10, 0xcd, 0xbc, 0xb0, 0x67, 0x4a, 0xc6, 0x1d, 0xc6, 0xc3, 0x13, 0x84, 0x53,
-	0x08, 0xe3, 0xdf, 0xe4, 0x11, 0x94, 0x2e, 0xaf, 0x47, 0x2c, 0x18, 0xb8, 0xd1, 0x1d, 0x5d, 0x9a,
-	0x7f, 0xf1, 0x96, 0x62, 0xb4, 0x99, 0xab, 0x6a, 0xde, 0x72, 0x55, 0xb7, 0xa1, 0x88, 0xdb, 0x1a,
-	0x39, 0x9c, 0x0b, 0x13, 0x5a, 0xc6, 0x7d, 0xe3, 0x2e, 0x4e, 0x1d, 0xce, 0x1b, 0x3d, 0xb2, 0x0f,
-	0xa6, 0xdc, 0xf8, 0x28, 0x11, 0x4b, 0x09, 0xb9, 0xea, 0xbb, 0x1f, 0x49, 0x99, 0x84, 0xf1, 0x6f,
-	0xb1, 0x93, 0xa7, 0x99, 0x5c, 0xc1, 0x2c, 0xd2, 0xad, 0x1e, 0x1b, 0x05, 0xac, 0xeb, 0x84, 0xac,
-	0x67, 0x3b, 0x9e, 0x33, 0xb8, 0x16, 0xa9, 0x4c, 0xc0, 0xf8, 0x78, 0x10, 0x72, 0x6a, 0x4e, 0x43,
-	0xac, 0xbf, 0x4b, 0x41, 0x41, 0x66, 0x48, 0xa7, 0xbe, 0xeb, 0x85, 0xe4, 0x3e, 0x14, 0x34, 0x07,
-	0xad, 0x6a, 0x08, 0x48, 0x5c, 0x31, 0xf9, 0x12, 0x96, 0x95, 0x1b, 0x96, 0x77, 0x59, 0x0b, 0x5c,
-	0x6a, 0x8b, 0x49, 0xf1, 0x43, 0xcb, 0x12, 0x15, 0x07, 0x28, 0xad, 0x16, 0xdc, 0xe3, 0xb8, 0x9a,
-	0x9d, 0x28, 0x94, 0xeb, 0x49, 0xdb, 0xba, 0x9e, 0xb4, 0x69, 0x06, 0xb0, 0xc6, 0xa7, 0x20, 0x5c,
-	0xc5, 0x93, 0x44, 0xfa, 0x19, 0x64, 0xf0, 0xbe, 0xce, 0x00, 0xcf, 0xb4, 0x5b, 0x95, 0xe2, 0xaf,
-	0x7b, 0x61, 0x70, 0x1d, 0x2b, 0x63, 0x73, 0x1f, 0x8a, 0xfa, 0x84, 0xa8, 0x90, 0x12, 0x97, 0x21,
-	0x7e, 0x4e, 0x56, 0x67, 0x45, 0x55, 0x9d, 0xed, 0xa7, 0x7e, 0x6a, 0x58, 0x7d, 0x30, 0xa7, 0x77,
-	0x48, 0x56, 0x21, 0x83, 0xc6, 0x88, 0x0c, 0x9e, 0xbc, 0x43, 0x71, 0x44, 0x1e, 0x42, 0x3e, 0xb6,
-	0x17, 0x95, 0xc2, 0x4c, 0xdb, 0xc7, 0x93, 0x77, 0x68, 0x82, 0x73, 0x50, 0x04, 0x48, 0x44, 0x63,
-	0xbd, 0x8c, 0xb4, 0x53, 0x0f, 0x02, 0x3f, 0xb8, 0x5d, 0x3b, 0x1f, 0x40, 0x51, 0x0a, 0x2a, 0xd0,
-	0xc3, 0x78, 0x41, 0xc1, 0xa2, 0x3c, 0x91, 0x09, 0x66, 0x71, 0x69, 0x2f, 0x9d, 0x6a, 0x11, 0x81,
-	0xaa, 0x28, 0xb7, 0xfe, 0xcb, 0x88, 0x16, 0xc6, 0xc4, 0xf9, 0xb7, 0xf4, 0xac, 0x5b, 0x90, 0x8f,
-	0x7d, 0x86, 0x5a, 0x2e, 0x17, 0xb9, 0x0b, 0x91, 0x09, 0x29, 0x93, 0x18, 0x09, 0x6d, 0x25, 0x89,
-	0xc3, 0x54, 0x06, 0x8f, 0xba, 0xa4, 0x65, 0x9e, 0x0c, 0xd0, 0x02, 0x12, 0x72, 0x79, 0x2a, 0x24,
-	0xcf, 0xce, 0x92, 0xa3, 0x00, 0x23, 0x72, 0x1c, 0x60, 0x19, 0xf0, 0xd7, 0x29, 0x28, 0x37, 0xd1,
-	0x48, 0x63, 0x6f, 0x27, 0x9c, 0x8b, 0x32, 0xf1, 0xe4, 0xa4, 0x79, 0x09, 0x11, 0x1b, 0x36, 0x21,
-	0x3d, 0x74, 0xbd, 0xa8, 0x94, 0x1e, 0xba, 0x1e, 0x42, 0x9c, 0x2b, 0x15, 0x30, 0xc4, 0x4f, 0xe1,
-	0xe0, 0x87, 0xcc, 0x91, 0xcd, 0x06, 0x83, 0xe2, 0x6f, 0x91, 0xb3, 0x0d, 0x59, 0xcf, 0x75, 0x3c,
-	0xcc, 0x78, 0x0c, 0xaa, 0x46, 0xe4, 0xc7, 0x40, 0x78, 0xe8, 0x78, 0x3d, 0x27, 0xe8, 0xd9, 0x3d,
-	0xf6, 0xd2, 0x45, 0xcd, 0x57, 0x16, 0x10, 0x67, 0x39, 0x9a, 0x39, 0x8c, 0x26, 0xc8, 0x3e, 0x6c,
-	0x48, 0x42, 0xdb, 0x39, 0xe7, 0xfe, 0x60, 0x1c, 0x32, 0x8d, 0x2a, 0x8f, 0x54, 0xf7, 0x24, 0x42,
-	0x55, 0xcd, 0x27, 0xb4, 0x3f, 0x84, 0xb2, 0x96, 0x94, 0xc4, 0xb9, 0x8f, 0x41, 0x4b, 0x09, 0x18,
-	0xa5, 0xba, 0x0a, 0xd9, 0xae, 0x3f, 0xf6, 0x42, 0xcc, 0x6c, 0xd2, 0x54, 0x0e, 0xac, 0x3f, 0x4b,
-	0x41, 0x51, 0xf8, 0xe5, 0x58, 0x52, 0xbb, 0xb0, 0x32, 0xe6, 0xce, 0xf9, 0x80, 0xd9, 0x4a, 0x07,
-	0x92, 0xc8, 0x40, 0xa2, 0x65, 0x39, 0x25, 0xc5, 0x5f, 0x13, 0x13, 0xe4, 0xd3, 0xb8, 0x24, 0x9f,
-	0xc0, 0x17, 0xa2, 0x4c, 0x8b, 0x38, 0xa9, 0x22, 0x99, 0x4e, 0xf2, 0x10, 0x88, 0x54, 0xec, 0x04,
-	0x45, 0x3a, 0xa2, 0x30, 0x71, 0x52, 0x27, 0xf8, 0x08, 0xca, 0x89, 0xa9, 0xf2, 0xae, 0x1f, 0x30,
-	0xd4, 0x42, 0x16, 0xe3, 0x70, 0x3c, 0xd3, 0x16, 0x13, 0xe4, 0x10, 0xd6, 0xa6, 0x12, 0x43, 0xa6,
-	0x1b, 0xd0, 0xac, 0x43, 0x5b, 0x99, 0x4c, 0x09, 0x51, 0x58, 0xd6, 0xbf, 0x1b, 0x90, 0x4f, 0x64,
-	0xd2, 0x80, 0x35, 0x65, 0x3d, 0x53, 0x3c, 0x0d, 0xe4, 0xb9, 0x26, 0x79, 0x4e, 0xd9, 0x1c, 0x5d,
-	0x19, 0x4e, 0x02, 0x50, 0x0b, 0xff, 0x1f, 0x96, 0xc4, 0x85, 0x4a, 0xc2, 0xb3, 0x74, 0x20, 0x24,
-	0x89, 0x90, 0x31, 0x7d, 0x31, 0xd0, 0xf5, 0xf2, 0xfa, 0xe4, 0x33, 0xfd, 0xda, 0xe4, 0xd3, 0xfa,
-	0x37, 0x03, 0xc8, 0x44, 0x0d, 0xf1, 0x9b, 0x54, 0x51, 0x33, 0x0e, 0x23, 0x7d, 0xa7, 0xb2, 0x23,
-	0x73, 0x97, 0xb2, 0x23, 0x3b, 0x5b, 0x76, 0xac, 0x42, 0x16, 0x8b, 0x0c, 0xbc, 0x36, 0x79, 0x2a,
-	0x07, 0xd6, 0xaf, 0x0d, 0xd8, 0x9c, 0x3d, 0xc9, 0x1b, 0x56, 0x6a, 0xc9, 0xb9, 0x53, 0x13, 0xe7,
-	0xae, 0xc1, 0xca, 0x64, 0x63, 0x43, 0xf7, 0x5c, 0x73, 0xbb, 0x1b, 0xcb, 0x13, 0xdd, 0x0d, 0x94,
-	0xf5, 0xdf, 0xa7, 0xf1, 0x46, 0x7d, 0xa7, 0x52, 0xd6, 0xdc, 0x72, 0x66, 0xc2, 0x2d, 0x4f, 0xa7,
-	0x23, 0x85, 0x99, 0x74, 0x64, 0x0b, 0xf2, 0xce, 0x80, 0x05, 0x21, 0x12, 0x2f, 0x49, 0xc7, 0x8d,
-	0x00, 0x41, 0xfe, 0x08, 0xf2, 0x82, 0xaf, 0x1f, 0xf4, 0x58, 0x80, 0x7e, 0xa2, 0xb4, 0x57, 0x8a,
-	0x2d, 0xf3, 0x44, 0x40, 0xf7, 0x93, 0xbe, 0x28, 0xcd, 0x05, 0x0a, 0x28, 0x0a, 0x96, 0xa1, 0x2b,
-	0x93, 0xe4, 0x38, 0xd7, 0x96, 0x1e, 0xb1, 0x34, 0x74, 0x31, 0x43, 0x8e, 0xd2, 0x6d, 0x81, 0xe9,
-	0x5c, 0x4d, 0x62, 0x2e, 0x28, 0x4c, 0xe7, 0x4a, 0xc7, 0xdc, 0x86, 0xa2, 0xe0, 0x19, 0x27, 0xe7,
-	0x79, 0xf4, 0x40, 0x30, 0x74, 0xbd, 0x03, 0x95, 0x9f, 0x0b, 0x0c, 0xe7, 0x2a, 0xc1, 0x00, 0x85,
-	0xe1, 0x5c, 0x45, 0x18, 0x51, 0x52, 0xbe, 0xa8, 0x25, 0xe5, 0xeb, 0xb0, 0x70, 0xe1, 0xb2, 0x41,
-	0x8f, 0x57, 0x8a, 0x08, 0x55, 0x23, 0xeb, 0x8f, 0x0d, 0x58, 0xd5, 0xf5, 0xf6, 0x96, 0x6c, 0xea,
-	0x53, 0x79, 0xe1, 0xa7, 0xad, 0x69, 0xaa, 0xeb, 0x55, 0x50, 0x5d, 0xaf, 0xb8, 0x8f, 0xa5, 0x45,
-	0xea, 0xef, 0xdf, 0x8a, 0x26, 0x82, 0x7b, 0x76, 0x32, 0xb8, 0x63, 0xa7, 0x64, 0x7a, 0x77, 0x6f,
-	0x49, 0x56, 0x49, 0xe0, 0xd7, 0x3a, 0x7f, 0x99, 0x9b, 0x3a, 0x7f, 0x2a, 0xf0, 0x1f, 0xc4, 0xfd,
-	0xbf, 0xa7, 0x60, 0xd6, 0x02, 0x26, 0x93, 0xcb, 0x37, 0xdb, 0x90, 0x4a, 0x14, 0x53, 0x71, 0xa2,
-	0x68, 0x51, 0x58, 0x6d, 0xfa, 0x3d, 0xf7, 0xc2, 0xed, 0xfe, 0x26, 0xfc, 0xe2, 0x58, 0x9b, 0xd2,
-	0x63, 0xed, 0x33, 0x58, 0xc2, 0x78, 0xf6, 0x56, 0x98, 0xd5, 0x61, 0xb3, 0xcd, 0xba, 0xbe, 0xc8,
-	0x24, 0xae, 0xdb, 0xa1, 0x1f, 0x38, 0x7d, 0xf6, 0x75, 0xe0, 0x86, 0xac, 0x21, 0x32, 0x47, 0xf2,
-	0x43, 0x58, 0x38, 0xc7, 0x66, 0xad, 0xe2, 0x5c, 0x8e, 0xcd, 0x4d, 0xf6, 0x70, 0xa9, 0x9a, 0xb6,
-	0x7e, 0x01, 0x5b, 0x73, 0xd9, 0xa8, 0x12, 0xea, 0x6e, 0x3b, 0x7c, 0x20, 0x6c, 0xd0, 0x7b, 0xc1,
-	0x55, 0xd1, 0x30, 0x53, 0x2d, 0xc9, 0x59, 0x91, 0x6b, 0x94, 0xa3, 0x80, 0xe6, 0x07, 0x72, 0xa3,
-	0xdf, 0x4f, 0x2f, 0x79, 0x1f, 0x4c, 0x65, 0x58, 0x17, 0x71, 0x96, 0x94, 0xd6, 0xf3, 0x01, 0x69,
-	0x57, 0x47, 0xee, 0x80, 0xd1, 0x12, 0x8f, 0x7f, 0x63, 0xc4, 0xb6, 0x61, 0x2b, 0xce, 0xe5, 0x9c,
-	0x78, 0xf7, 0xaa, 0x9c, 0xe3, 0xaa, 0x8d, 0x7a, 0x3f, 0x96, 0x0b, 0x22, 0x26, 0xa7, 0x94, 0xc5,
-	0x1c, 0xa7, 0x1b, 0xfc, 0xa6, 0x29, 0xab, 0x0a, 0xa6, 0x06, 0x94, 0x72, 0x9f, 0xa8, 0xe0, 0x8d,
-	0xdb, 0x2a, 0x78, 0xeb, 0xbf, 0x53, 0x60, 0x1e, 0xfa, 0xdf, 0x7a, 0xaa, 0x28, 0x90, 0xa2, 0xd5,
-	0xc5, 0x63, 0xbc, 0xb1, 0x78, 0x52, 0x77, 0x14, 0xcf, 0x4f, 0x60, 0x7d, 0xa2, 0x78, 0x44, 0xeb,
-	0xb4, 0x45, 0xee, 0xbc, 0x80, 0xe6, 0xba, 0xa2, 0xd5, 0x8b, 0x68, 0xfd, 0x4d, 0xe7, 0x4a, 0x10,
-	0x4d, 0x64, 0xf8, 0x09, 0x51, 0x46, 0x12, 0x69, 0x39, 0x7d, 0x4c, 0x14, 0xb7, 0x29, 0xb8, 0xfb,
-	0x8a, 0x21, 0x72, 0x16, 0x91, 0x65, 0x9b, 0xa2, 0xed, 0xbe, 0x62, 0x02, 0xeb, 0x1c, 0xde, 0x4d,
-	0x52, 0xef, 0x44, 0x24, 0xb1, 0xbe, 0x0a, 0x28, 0x89, 0xed, 0x49, 0x7d, 0x69, 0xb2, 0x8b, 0x14,
-	0xb6, 0xc9, 0x6f, 0x9c, 0xb3, 0x28, 0x2c, 0xeb, 0x50, 0xa9, 0xb2, 0xb9, 0xce, 0xcb, 0xb8, 0xb3,
-	0xf3, 0xfa, 0x23, 0x03, 0x36, 0xab, 0xaa, 0x94, 0x7f, 0xa2, 0xba, 0x42, 0xe8, 0x5b, 0xbf, 0xc7,
-	0x7b, 0x62, 0xfd, 0x47, 0x1a, 0xb6, 0xe6, 0x6e, 0xe2, 0x8d, 0xdc, 0x41, 0x15, 0x56, 0xe2, 0x90,
-	0xf7, 0x87, 0x82, 0x5a, 0xb7, 0x28, 0x32, 0xb1, 0xb4, 0x8c, 0x1e, 0x66, 0xa0, 0x8d, 0xd0, 0xaa,
-	0x1e, 0x40, 0xa1, 0xcf, 0x42, 0x29, 0x49, 0xc6, 0xd5, 0xe7, 0x68, 0xf9, 0x81, 0x0f, 0xfa, 0x2c,
-	0x3c, 0x90, 0x70, 0xd2, 0x05, 0x32, 0xb5, 0xd2, 0xd0, 0x19, 0xa9, 0x88, 0xf1, 0x48, 0xdd, 0x97,
-	0x9b, 0x8f, 0x33, 0xb1, 0x89, 0xa6, 0x33, 0x92, 0xdd, 0x84, 0x72, 0x30, 0x09, 0xdd, 0x6c, 0x43,
-	0x49, 0x43, 0x74, 0xd9, 0x8d, 0x07, 0x34, 0xee, 0x7e, 0xc0, 0xcd, 0x70, 0x32, 0xd9, 0x88, 0x56,
-	0x9f, 0xd3, 0xb2, 0x38, 0xd2, 0x5b, 0x16, 0x85, 0xbd, 0x4f, 0xde, 0xe8, 0x58, 0x2e, 0xe3, 0x7a,
-	0x93, 0xe3, 0x57, 0x69, 0x58, 0x8a, 0x28, 0xa5, 0x5d, 0x7d, 0x29, 0x25, 0x18, 0xfa, 0xf6, 0x39,
-	0x8b, 0x9a, 0x4b, 0xbd, 0x9b, 0x82, 0x86, 0x10, 0x4d, 0xc7, 0x3f, 0x60, 0x8a, 0x45, 0x8f, 0xfc,
-	0x0c, 0x56, 0xb4, 0x06, 0xa7, 0x60, 0xa4, 0x69, 0x7a, 0x86, 0x7c, 0x39, 0xc1, 0xa5, 0x63, 0xd9,
-	0xf4, 0xfb, 0x1a, 0xc8, 0x14, 0x03, 0xa1, 0x40, 0xe9, 0x9a, 0x7f, 0x34, 0x79, 0x52, 0xdc, 0xef,
-	0xee, 0x13, 0x9d, 0x45, 0xac, 0x33, 0xf3, 0x72, 0x0a, 0xbc, 0xd9, 0x04, 0x88, 0x17, 0xe6, 0x37,
-	0xed, 0xd3, 0xb8, 0xeb, 0x3e, 0x37, 0xbb, 0xb0, 0x36, 0x77, 0xe5, 0x39, 0xfa, 0xfa, 0x6c, 0x52,
-	0x5f, 0xef, 0xcf, 0x3b, 0x45, 0xb2, 0x35, 0x5d, 0x3b, 0xff, 0x99, 0x86, 0x52, 0x84, 0xf7, 0x46,
-	0x17, 0xee, 0x7d, 0x80, 0x80, 0xf5, 0x03, 0xc6, 0xb9, 0xeb, 0xcb, 0x2e, 0x46, 0x8e, 0x6a, 0x10,
-	0x3d, 0xd1, 0x5b, 0x9c, 0xee, 0x8f, 0xa3, 0xce, 0xb9, 0xcb, 0x71, 0x56, 0x7d, 0xf4, 0x88, 0x60,
-	0x02, 0xe5, 0x29, 0xac, 0xc6, 0x28, 0x61, 0xe0, 0x3a, 0x7d, 0xf5, 0x89, 0x07, 0x70, 0x3f, 0x15,
-	0xed, 0x74, 0xdc, 0xe5, 0x1d, 0x44, 0x40, 0x9f, 0x42, 0x9c, 0x19, 0x98, 0x58, 0x4e, 0xf6, 0xba,
-	0xd4, 0x77, 0x58, 0x59, 0xd9, 0xc9, 0xfe, 0x97, 0xfa, 0x90, 0xfa, 0x08, 0xee, 0x71, 0x16, 0xb8,
-	0xce, 0xc0, 0x7d, 0xc5, 0x7a, 0xf6, 0x04, 0x76, 0x01, 0x5b, 0x76, 0x6b, 0xc9, 0x74, 0x43, 0xa3,
-	0x5b, 0x87, 0x05, 0xd5, 0x19, 0x56, 0x5f, 0xcf, 0xe4, 0x88, 0x7c, 0x0c, 0xcb, 0x1a, 0x3f, 0xad,
-	0x79, 0x5c, 0xa4, 0x66, 0x32, 0xa1, 0xa4, 0xfd, 0x21, 0x2c, 0xc5, 0xdd, 0x54, 0x7c, 0xeb, 0x20,
-	0xd3, 0xe2, 0x62, 0x04, 0xc4, 0x07, 0x04, 0x3a, 0x92, 0x56, 0xbb, 0xc6, 0x48, 0x22, 0xed, 0x79,
-	0x9a, 0xc9, 0xe5, 0x4d, 0xa0, 0xab, 0x5d, 0xfc, 0x0a, 0x23, 0x9b, 0x60, 0x4a, 0x03, 0xdc, 0xfa,
-	0x9f, 0x34, 0x90, 0x59, 0x81, 0x11, 0x0a, 0xa5, 0x58, 0xd0, 0x42, 0xaf, 0xd1, 0x4b, 0x8b, 0x8f,
-	0x6f, 0x12, 0xf1, 0x14, 0x08, 0xdf, 0x5e, 0x2c, 0x45, 0x2c, 0x84, 0x85, 0x30, 0xf2, 0x14, 0x0a,
-	0xcc, 0x7b, 0xe9, 0x06, 0xbe, 0x37, 0x64, 0x2a, 0x81, 0x2c, 0xed, 0xed, 0xdc, 0xc8, 0xb0, 0x9e,
-	0xe0, 0x22, 0x37, 0x9d, 0x98, 0x54, 0x60, 0xb1, 0xeb, 0x0f, 0x91, 0x8f, 0x14, 0x71, 0x34, 0x14,
-	0x6a, 0x4d, 0x3e, 0xb1, 0xbb, 0xbd, 0xe8, 0x39, 0x4e, 0x0c, 0x6b, 0xf4, 0x74, 0x0b, 0xcc, 0xbe,
-	0xd6, 0x02, 0x17, 0x66, 0x2d, 0xf0, 0x3d, 0x80, 0xb8, 0x62, 0x8d, 0x4a, 0xb9, 0x7c, 0x54, 0xb2,
-	0x72, 0xeb, 0xe7, 0xd3, 0xd2, 0x44, 0x2d, 0xe5, 0x20, 0xd3, 0x3a, 0x69, 0xd5, 0xcd, 0x77, 0x48,
-	0x09, 0x80, 0xd6, 0x1f, 0xd3, 0x7a, 0xbb, 0xdd, 0x38, 0x69, 0x99, 0x06, 0x01, 0x58, 0x68, 0x3c,
-	0x6e, 0x9d, 0xd0, 0xba, 0x99, 0x22, 0x04, 0x4a, 0x47, 0xd5, 0xe3, 0x76, 0xdd, 0x3e, 0x3d, 0x69,
-	0x37, 0x3a, 0x8d, 0xaf, 0xea, 0x66, 0x9a, 0x14, 0x60, 0xf1, 0xac, 0xf5, 0xac, 0x75, 0xf2, 0x75,
-	0xcb, 0xcc, 0x58, 0xcf, 0xa1, 0x3c, 0x25, 0x14, 0x52, 0x86, 0xc2, 0x59, 0xab, 0x7d, 0x5a, 0xaf,
-	0x35, 0x8e, 0x1a, 0xf5, 0x43, 0xf3, 0x1d, 0xb2, 0x04, 0xf9, 0x53, 0x5a, 0x6f, 0x9f, 0x1d, 0x34,
-	0x1b, 0x1d, 0xd3, 0x10, 0xeb, 0x9d, 0x9e, 0xb4, 0x3b, 0x6a, 0x9c, 0xc2, 0x31, 0x3d, 0x39, 0x3c,
-	0xab, 0x75, 0xc4, 0xfa, 0x69, 0xeb, 0x1f, 0xd3, 0xf0, 0xee, 0xa1, 0xc3, 0x2f, 0xcf, 0x7d, 0x2d,
-	0x1b, 0x64, 0xb5, 0x4b, 0x27, 0x08, 0xa5, 0x4b, 0xbe, 0x53, 0x63, 0xf6, 0x0b, 0x30, 0x65, 0xbe,
-	0xc5, 0xd9, 0x80, 0x75, 0x65, 0x6a, 0x33, 0x91, 0xb2, 0x25, 0x2f, 0x73, 0x68, 0x19, 0x31, 0xdb,
-	0x31, 0x62, 0x5c, 0x16, 0xa7, 0x27, 0xbe, 0x55, 0xbd, 0xbd, 0xd2, 0x3f, 0x73, 0xe7, 0xd2, 0x3f,
-	0xfb, 0x9d, 0x95, 0xfe, 0x1b, 0x90, 0x13, 0x18, 0xc1, 0xd8, 0x93, 0x0d, 0x86, 0x2c, 0x5d, 0x1c,
-	0x3a, 0x57, 0x74, 0xec, 0x71, 0xf2, 0x39, 0x6c, 0x5c, 0xba, 0xfd, 0xcb, 0x81, 0xdb, 0xbf, 0x0c,
-	0x6d, 0x8e, 0x41, 0xd2, 0xf6, 0x3d, 0x1b, 0xbf, 0x35, 0xa1, 0x83, 0xcc, 0xd1, 0xf5, 0x18, 0xa1,
-	0x8d, 0xf3, 0x27, 0xde, 0x13, 0x31, 0x6b, 0xfd, 0xd2, 0x80, 0xf5, 0x58, 0x79, 0x74, 0xec, 0x69,
-	0x6a, 0xd3, 0x4c, 0xdc, 0x98, 0x30, 0xf1, 0xfb, 0x50, 0x48, 0x7a, 0xcf, 0x52, 0x4b, 0x79, 0x0a,
-	0x71, 0xf3, 0xf9, 0x96, 0xfd, 0xa4, 0x5f, 0xbb, 0x9f, 0x7f, 0x4d, 0xc3, 0x87, 0xf1, 0x7e, 0x6a,
-	0xfe, 0x70, 0xe4, 0x04, 0x6c, 0x9e, 0x4d, 0x3d, 0x87, 0x82, 0x62, 0xac, 0x05, 0xbe, 0x4f, 0x22,
-	0x4b, 0xb9, 0x95, 0x7e, 0x57, 0xae, 0x4a, 0x41, 0x32, 0xc1, 0xd0, 0x3d, 0x4f, 0xf1, 0xa9, 0x3b,
-	0x2b, 0x3e, 0x3d, 0x57, 0xf1, 0xba, 0xd2, 0x32, 0x6f, 0xa0, 0xb4, 0xec, 0xeb, 0x84, 0xb4, 0xf9,
-	0x6b, 0x03, 0x16, 0x24, 0x04, 0x3f, 0xa6, 0x28, 0x39, 0x68, 0x0f, 0xe3, 0x94, 0x6c, 0xe4, 0x07,
-	0xf2, 0x99, 0xeb, 0x97, 0x9a, 0x73, 0xfd, 0x3e, 0x87, 0xf2, 0xd4, 0xf5, 0xc3, 0x13, 0xcd, 0xbb,
-	0x7d, 0xa5, 0xc9, 0xdb, 0x17, 0x5f, 0xbe, 0x4c, 0x72, 0xf9, 0xac, 0x3f, 0x37, 0xe0, 0xbd, 0x69,
-	0x35, 0x4c, 0x5a, 0xd7, 0x86, 0xcc, 0xe1, 0xd1, 0x82, 0x0c, 0xa4, 0x5c, 0x94, 0xe6, 0xc5, 0xbf,
-	0x53, 0xfb, 0xfa, 0x03, 0xb8, 0x1f, 0xef, 0xeb, 0x2b, 0x97, 0x8f, 0x31, 0x5c, 0x46, 0xee, 0xf6,
-	0x16, 0xbb, 0x9f, 0x76, 0xed, 0xa9, 0x19, 0xd7, 0x6e, 0x7d, 0x03, 0x90, 0x7c, 0xfd, 0x9c, 0xfb,
-	0x2e, 0xb2, 0xa2, 0x67, 0x53, 0xf9, 0x83, 0x54, 0x25, 0x7a, 0x52, 0x29, 0xc2, 0x82, 0x54, 0x01,
-	0x7e, 0x29, 0x4c, 0x63, 0x48, 0x97, 0x8f, 0x11, 0xf0, 0xd1, 0xdf, 0xdf, 0x66, 0x21, 0x2f, 0x78,
-	0xbf, 0x81, 0x4f, 0xdd, 0x80, 0x5c, 0xc8, 0x86, 0x23, 0xbb, 0xe7, 0x46, 0x8d, 0xa9, 0x45, 0x31,
-	0x3e, 0x74, 0xf1, 0x2b, 0x9d, 0x30, 0x5f, 0x7f, 0x2c, 0x04, 0xd8, 0x55, 0xd6, 0x0b, 0x0a, 0xd4,
-	0x66, 0xdd, 0xb9, 0x5f, 0x79, 0x33, 0x77, 0xfb, 0xca, 0x1b, 0x5b, 0xc4, 0xc2, 0x5b, 0x78, 0x3a,
-	0x30, 0xdd, 0x00, 0x5e, 0x9c, 0x69, 0x00, 0xeb, 0x0f, 0x1e, 0x72, 0x93, 0x0f, 0x1e, 0xbe, 0x87,
-	0xda, 0xf9, 0xb6, 0x76, 0x4a, 0xf1, 0xb7, 0x6d, 0xa7, 0x90, 0xdf, 0x87, 0x35, 0xd7, 0x0b, 0x59,
-	0xe0, 0x39, 0x03, 0x5b, 0x53, 0x09, 0x57, 0x6f, 0x11, 0x76, 0x12, 0x75, 0x48, 0xd7, 0xd6, 0x50,
-	0xc8, 0x89, 0x82, 0xb8, 0x2c, 0x2a, 0x56, 0xdc, 0xd9, 0x99, 0xcd, 0x23, 0xa8, 0xdc, 0x44, 0x70,
-	0xdb, 0xe7, 0xe6, 0xbc, 0x96, 0xeb, 0x3f, 0xcd, 0xe4, 0xb2, 0xe6, 0x02, 0x2d, 0xe1, 0x4b, 0x5e,
-	0xf9, 0xb8, 0x84, 0xb3, 0xae, 0xf5, 0x2e, 0x6c, 0xde, 0x2c, 0x56, 0xeb, 0x7f, 0x0d, 0xd8, 0xb8,
-	0x51, 0x24, 0xe4, 0x4f, 0x0d, 0xb8, 0x8f, 0xdd, 0x14, 0x6e, 0xbb, 0x9e, 0x3d, 0xf1, 0x7e, 0xe4,
-	0x9c, 0x5d, 0x3a, 0x2f, 0x5d, 0xd5, 0x3a, 0x2e, 0xed, 0x7d, 0x7e, 0x8b, 0x74, 0x77, 0xb1, 0xef,
-	0xc2, 0x1b, 0x5e, 0x23, 0x79, 0x57, 0x22, 0xa7, 0xf6, 0xf5, 0xd4, 0x87, 0x6e, 0xb1, 0x59, 0xbc,
-	0x03, 0xb5, 0x94, 0xf5, 0x1c, 0x36, 0x6e, 0x64, 0x33, 0x9b, 0x43, 0x2d, 0xc3, 0x92, 0x4c, 0xca,
-	0x6c, 0x7c, 0x78, 0xda, 0x36, 0x0d, 0x62, 0x42, 0x11, 0x9f, 0x9f, 0x46, 0x90, 0x94, 0xf5, 0x57,
-	0x19, 0xe5, 0x2e, 0x64, 0xb6, 0xfe, 0xa5, 0x7a, 0x11, 0xa2, 0x15, 0x48, 0xa5, 0xbd, 0xad, 0xe9,
-	0x17, 0x21, 0xf8, 0x53, 0xd5, 0x4b, 0x78, 0x0d, 0xd4, 0xa3, 0xf9, 0x23, 0x55, 0xd7, 0x88, 0x9c,
-	0x55, 0x96, 0x05, 0x7a, 0xed, 0xba, 0x3a, 0x59, 0xb5, 0xa9, 0xc7, 0x25, 0xc4, 0x99, 0x18, 0xab,
-	0x4e, 0x45, 0x89, 0x8f, 0x87, 0x43, 0x27, 0xb8, 0xb6, 0x27, 0x0a, 0x90, 0x25, 0x05, 0x8d, 0x0b,
-	0xb9, 0x92, 0xf0, 0x92, 0x5d, 0xe1, 0xd1, 0x6d, 0x7c, 0x39, 0xa0, 0x6a, 0x8b, 0x40, 0xb9, 0xf9,
-	0x63, 0xd7, 0x7b, 0x71, 0x73, 0x9a, 0xfc, 0x73, 0x58, 0xc7, 0x47, 0xf8, 0xf8, 0x61, 0xf6, 0xc2,
-	0x71, 0x07, 0xe3, 0x80, 0xc9, 0x12, 0x65, 0x01, 0x8f, 0xfd, 0x60, 0xe6, 0xd8, 0x34, 0x42, 0x3f,
-	0x92, 0xd8, 0x98, 0xd0, 0xaf, 0x06, 0x73, 0xa0, 0x91, 0x17, 0x56, 0x82, 0xc9, 0x41, 0xe6, 0xb4,
-	0xda, 0x6e, 0xcb, 0x47, 0xf0, 0xb4, 0xda, 0xa9, 0xdb, 0xf8, 0x6a, 0x1f, 0x13, 0xd9, 0xa3, 0x6a,
-	0xa7, 0x7a, 0x2c, 0xc7, 0x69, 0xa1, 0xb3, 0x6a, 0xab, 0x7a, 0xfc, 0x4d, 0xbb, 0xd1, 0x96, 0xa0,
-	0x8c, 0xd0, 0x6b, 0xa3, 0x65, 0x9f, 0xd2, 0x13, 0xcc, 0xb7, 0xcd, 0xac, 0xc5, 0x61, 0x75, 0xde,
-	0x46, 0xc8, 0x06, 0xac, 0xa9, 0x24, 0xdb, 0x3e, 0xa1, 0xf6, 0x59, 0xab, 0x5d, 0xef, 0xd8, 0x9d,
-	0x6f, 0x4e, 0x45, 0xbe, 0x4e, 0xa0, 0xd4, 0xac, 0xb6, 0x3b, 0x75, 0x6a, 0x53, 0x91, 0x6c, 0x52,
-	0x91, 0x53, 0xdf, 0x83, 0x95, 0xa7, 0x27, 0x07, 0x76, 0xb3, 0xda, 0xaa, 0x3e, 0xd6, 0x26, 0x52,
-	0x64, 0x05, 0xca, 0xf2, 0x41, 0x73, 0x02, 0x4c, 0x5b, 0xaf, 0xa0, 0x28, 0x5b, 0x6d, 0x94, 0x75,
-	0xfd, 0xa0, 0x47, 0x3e, 0x8b, 0x5e, 0x50, 0xc8, 0xe7, 0x08, 0xaa, 0x94, 0x9e, 0xf3, 0x12, 0xa1,
-	0xa0, 0xbd, 0x44, 0xd0, 0xa8, 0xd0, 0xcc, 0x27, 0x1f, 0xab, 0xea, 0x0f, 0x10, 0x0a, 0x5a, 0xb3,
-	0xd2, 0x3a, 0x06, 0x48, 0x9a, 0xa5, 0x33, 0x6f, 0x37, 0x8c, 0xd9, 0xb7, 0x1b, 0x5b, 0x90, 0xc7,
-	0xa6, 0xeb, 0xc8, 0x09, 0x2f, 0xa3, 0x37, 0xf2, 0x02, 0x70, 0xea, 0x84, 0x97, 0x1f, 0xfd, 0x14,
-	0x72, 0x51, 0xf6, 0x3d, 0xb7, 0xee, 0x48, 0xfe, 0xa3, 0x60, 0x90, 0x22, 0xe4, 0x0e, 0xce, 0x1a,
-	0xc7, 0x87, 0x76, 0xe3, 0xd0, 0x4c, 0xfd, 0x5f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x36, 0x7a, 0x6b,
-	0xf7, 0x3c, 0x32, 0x00, 0x00,
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbd, 0x3b, 0x4d, 0x6f, 0x23, 0x47,
+	0x76, 0x6e, 0x7e, 0x48, 0xe4, 0x23, 0x45, 0xb6, 0x9a, 0xfa, 0x1e, 0xdb, 0x33, 0xdb, 0x9b, 0x49,
+	0x66, 0x6d, 0x44, 0x1a, 0xcb, 0x86, 0xb3, 0x96, 0x9d, 0x2c, 0x28, 0x8a, 0xd2, 0x70, 0x46, 0xa4,
+	0xe4, 0x22, 0x35, 0x8e, 0xb1, 0x49, 0x1a, 0x2d, 0xb2, 0x25, 0xf5, 0x0e, 0xbf, 0xd2, 0xdd, 0x1c,
+	0xcf, 0xf8, 0x12, 0x20, 0x97, 0x20, 0x40, 0x72, 0x0b, 0x92, 0xc3, 0x1e, 0xf6, 0xb0, 0xc8, 0x25,
+	0x87, 0x00, 0x41, 0x90, 0x43, 0x16, 0x01, 0x92, 0xc3, 0x02, 0x7b, 0xc9, 0x35, 0xc7, 0xbd, 0x2d,
+	0x72, 0xca, 0x2f, 0x08, 0x72, 0xc8, 0xab, 0x57, 0xd5, 0xdd, 0xd5, 0x24, 0x35, 0xd2, 0xec, 0x8e,
+	0x7d, 0x10, 0xc0, 0x7a, 0x5f, 0x55, 0xf5, 0xde, 0xab, 0x57, 0xef, 0xbd, 0x2e, 0xc1, 0xaa, 0x3f,
+	0x76, 0xba, 0x3b, 0x63, 0x6f, 0x14, 0x8c, 0x76, 0x06, 0xf6, 0xb3, 0xd1, 0x36, 0xfd, 0x34, 0x32,
+	0xfc, 0xb7, 0xf9, 0xaf, 0x1a, 0x2c, 0xb4, 0x03, 0x3b, 0x98, 0xf8, 0xc6, 0x7d, 0xc8, 0x74, 0x47,
+	0x3d, 0x67, 0x43, 0xbb, 0xa7, 0x3d, 0x28, 0xed, 0x2e, 0x6f, 0x13, 0xad, 0xc0, 0x6d, 0xd7, 0x10,
+	0xc1, 0x08, 0x6d, 0x7c, 0x07, 0x8a, 0x17, 0xb6, 0xdb, 0xb7, 0x06, 0x8e, 0xef, 0xdb, 0x97, 0xce,
+	0x46, 0x0a, 0xc9, 0xf3, 0xac, 0xc0, 0x61, 0x4d, 0x01, 0x32, 0xee, 0x40, 0xd6, 0x73, 0x02, 0xef,
+	0xe5, 0x46, 0x1a, 0x71, 0xb9, 0xbd, 0xec, 0x85, 0xdd, 0xf7, 0x1d, 0x26, 0x60, 0xc6, 0xf7, 0x40,
+	0xff, 0xca, 0xf6, 0x86, 0xee, 0xf0, 0x32, 0x14, 0xe1, 0x6f, 0x64, 0xee, 0xa5, 0x51, 0x46, 0x59,
+	0xc2, 0xa5, 0x18, 0xdf, 0x7c, 0x07, 0x32, 0x7c, 0x62, 0xa3, 0x00, 0x8b, 0xed, 0xb3, 0x5a, 0xad,
+	0xde, 0x6e, 0xeb, 0x6f, 0x19, 0x39, 0xc8, 0x1c, 0x56, 0x1b, 0xc7, 0xba, 0x66, 0xfe, 0xa3, 0x06,
+	0xf9, 0xa7, 0x76, 0x7f, 0xe2, 0x34, 0x86, 0x17, 0x23, 0x9c, 0x34, 0xff, 0x9c, 0x0f, 0xac, 0x67,
+	0xce, 0x4b, 0xda, 0x43, 0x9e, 0xe5, 0x08, 0xf0, 0xc4, 0x79, 0x69, 0xac, 0x40, 0xb6, 0x6f, 0x9f,
+	0x3b, 0x7d, 0xb9, 0x5a, 0x31, 0x30, 0xee, 0x41, 0xa1, 0xe7, 0xf8, 0x5d, 0xcf, 0x1d, 0x07, 0xee,
+	0x68, 0x88, 0xab, 0xa0, 0x9d, 0x28, 0x20, 0xe3, 0x01, 0x64, 0x82, 0x97, 0x63, 0x87, 0x36, 0x52,
+	0xda, 0x5d, 0x11, 0x3a, 0x89, 0xe6, 0xdc, 0xee, 0x20, 0x8e, 0x11, 0x85, 0x69, 0x42, 0x86, 0x8f,
+	0xf8, 0x5a, 0x5b, 0x67, 0xcd, 0x3a, 0x6b, 0xd4, 0x74, 0xcd, 0x58, 0x82, 0x7c, 0xa7, 0xd1, 0xac,
+	0xb7, 0x3b, 0xd5, 0xe6, 0xa9, 0x9e, 0x32, 0x7f, 0x00, 0x80, 0x8b, 0x71, 0x7a, 0x24, 0xe0, 0xc6,
+	0x05, 0xd3, 0x6f, 0x5a, 0xb0, 0xc6, 0xc4, 0xc0, 0xfc, 0x10, 0xf2, 0x2d, 0x7b, 0xe0, 0xf4, 0x0e,
+	0xec, 0xc0, 0x36, 0x0c, 0xc8, 0x0c, 0x71, 0x20, 0x59, 0xe9, 0x37, 0x87, 0xf5, 0x10, 0x27, 0xb7,
+	0x49, 0xbf, 0xcd, 0x1d, 0xc8, 0x32, 0x7b, 0x88, 0x66, 0x41, 0x99, 0x7e, 0x60, 0x7b, 0x01, 0x71,
+	0xa0, 0x4c, 0x1a, 0x18, 0x3a, 0xa4, 0x9d, 0x61, 0x4f, 0xce, 0xc3, 0x7f, 0x9a, 0x47, 0x50, 0x3c,
+	0xe6, 0xfa, 0x71, 0x7a, 0x11, 0x9f, 0x50, 0x9e, 0xa6, 0x2a, 0xef, 0x3b, 0x68, 0x64, 0x8e, 0x26,
+	0xce, 0xc2, 0x6e, 0x41, 0xe8, 0x86, 0x38, 0x98, 0xc0, 0x98, 0x3f, 0xcd, 0x00, 0xf0, 0xa5, 0x1e,
+	0xba, 0xfd, 0xc0, 0xf1, 0x8c, 0x8f, 0x21, 0xcf, 0x17, 0x64, 0x91, 0x46, 0x85, 0x97, 0x6d, 0x0a,
+	0xae, 0x98, 0x88, 0x7e, 0x92, 0x5a, 0x73, 0x3d, 0xf9, 0x2b, 0xa9, 0xa8, 0xd4, 0x75, 0x96, 0xcd,
+	0xaa, 0x8b, 0xdb, 0x85, 0xd5, 0xb1, 0xe3, 0x75, 0x9d, 0x61, 0xe0, 0xf6, 0x1d, 0x6b, 0xe0, 0xf6,
+	0xfb, 0xae, 0x85, 0x6b, 0x7a, 0x46, 0x86, 0xcc, 0xb2, 0x4a, 0x8c, 0x6c, 0x72, 0x1c, 0xae, 0xfa,
+	0x99, 0xf1, 0x11, 0x54, 0xdc, 0xcb, 0xe1, 0xc8, 0xe3, 0xf4, 0xbe, 0xcf, 0xfd, 0x93, 0x54, 0x99,
+	0x21, 0x1f, 0xce, 0x04, 0xde, 0xc4, 0x61, 0xcb, 0x82, 0xa0, 0x29, 0xf0, 0x7c, 0xa9, 0xe6, 0xbf,
+	0xa7, 0x20, 0x17, 0xae, 0xd9, 0xd8, 0x82, 0xb5, 0x66, 0xbd, 0x83, 0xb6, 0xb7, 0xaa, 0x47, 0x47,
+	0xac, 0x7e, 0x54, 0xed, 0xd4, 0xad, 0xda, 0xc9, 0x59, 0xab, 0xa3, 0x17, 0x8c, 0x0d, 0x58, 0x99,
+	0xc1, 0x35, 0x1b, 0x2d, 0xf4, 0x92, 0xb9, 0x98, 0xea, 0x1f, 0xea, 0x29, 0x63, 0x13, 0x56, 0x67,
+	0x31, 0xf5, 0x6a, 0x4b, 0x4f, 0xa3, 0x52, 0xd6, 0xe7, 0xa0, 0x0e, 0x1a, 0x88, 0xcc, 0xcc, 0x45,
+	0xb6, 0x3b, 0x07, 0x07, 0xf5, 0xa7, 0x7a, 0xf6, 0x9a, 0xe9, 0x0e, 0xf4, 0xa2, 0x71, 0x17, 0xee,
+	0xcc, 0x60, 0x4e, 0xeb, 0xac, 0x56, 0x6f, 0x75, 0x1a, 0xc7, 0x75, 0x7d, 0x01, 0x95, 0xad, 0xd7,
+	0xce, 0xda, 0x9d, 0x93, 0x66, 0x4c, 0xa0, 0x2f, 0x1a, 0xeb, 0x50, 0x91, 0x6c, 0x6d, 0xf4, 0xf3,
+	0xe3, 0xfa, 0xe9, 0x49, 0xa3, 0xd5, 0x69, 0xeb, 0x39, 0xa3, 0x02, 0xe5, 0xfd, 0x7a, 0xab, 0xf6,
+	0xa8, 0x59, 0x65, 0x4f, 0xac, 0x76, 0xed, 0x84, 0xd5, 0xf5, 0xbc, 0x51, 0x86, 0x42, 0x9d, 0xb1,
+	0x13, 0x26, 0x15, 0x03, 0xe6, 0x4f, 0xf1, 0x18, 0xb3, 0xc9, 0x70, 0x7f, 0x32, 0xec, 0xf5, 0x1d,
+	0x63, 0x0f, 0x4a, 0xe7, 0xce, 0xb0, 0x7b, 0x35, 0xb0, 0xbd, 0x67, 0x96, 0x8b, 0x87, 0x8c, 0x3c,
+	0xa5, 0xb0, 0x5b, 0x11, 0x9e, 0xb2, 0x1f, 0xe2, 0xf8, 0xf9, 0x63, 0x4b, 0xe7, 0xea, 0x10, 0x4f,
+	0x6b, 0xce, 0x9b, 0x0c, 0x05, 0x97, 0xf0, 0xca, 0x25, 0xe9, 0x95, 0x93, 0x21, 0xd1, 0x2f, 0x7a,
+	0xe2, 0x87, 0xf1, 0x10, 0xe0, 0xdc, 0x0e, 0xba, 0x57, 0x56, 0xdf, 0xf5, 0x03, 0x74, 0x8a, 0x34,
+	0xd2, 0x86, 0x11, 0xcf, 0x1e, 0x8c, 0xfb, 0xce, 0x3e, 0xc7, 0xb2, 0x3c, 0x11, 0x1d, 0x23, 0x8d,
+	0xf9, 0x63, 0x0d, 0xf4, 0x86, 0xef, 0x4f, 0x9c, 0x8e, 0x67, 0x77, 0x9f, 0x39, 0x1e, 0x89, 0xf9,
+	0x1c, 0xf4, 0xf3, 0xc9, 0xa5, 0x3d, 0x74, 0xbf, 0x76, 0x3c, 0xab, 0x3b, 0x1a, 0x5e, 0xb8, 0x97,
+	0x72, 0xb9, 0xbf, 0x2d, 0x84, 0x4d, 0x73, 0x6c, 0xef, 0x87, 0xe4, 0x35, 0xa2, 0x66, 0xe5, 0xf3,
+	0x24, 0x60, 0xeb, 0x23, 0xd4, 0x59, 0x12, 0xc4, 0x23, 0x6e, 0x77, 0x34, 0x18, 0x8f, 0x86, 0xe8,
+	0xb1, 0x96, 0xdb, 0x93, 0xc7, 0xb0, 0x10, 0xc1, 0x1a, 0x3d, 0xf3, 0x3f, 0x34, 0x28, 0x9c, 0x7a,
+	0xa3, 0x1f, 0x39, 0xdd, 0x80, 0x16, 0x86, 0x2c, 0x63, 0x31, 0xb4, 0x94, 0x18, 0x51, 0x90, 0x30,
+	0x1e, 0x43, 0x8c, 0xef, 0xc2, 0x52, 0x48, 0x62, 0xf7, 0x5d, 0xdb, 0x97, 0x27, 0x2b, 0xe4, 0xab,
+	0x72, 0x98, 0xf1, 0x0e, 0xc0, 0xe8, 0xab, 0x21, 0x6e, 0x2e, 0xd2, 0x53, 0x9e, 0xe5, 0x09, 0xc2,
+	0x95, 0x62, 0x3c, 0x86, 0xd5, 0x9e, 0x73, 0x61, 0x4f, 0xfa, 0xb8, 0x2e, 0xbe, 0x53, 0x2b, 0x10,
+	0x5b, 0xa5, 0x43, 0x53, 0xd8, 0x5d, 0x9b, 0xaf, 0x04, 0x56, 0x91, 0x4c, 0x2a, 0xc2, 0x0c, 0x60,
+	0x4d, 0xd9, 0xc1, 0x91, 0x13, 0x30, 0xc7, 0xc7, 0xfd, 0xf9, 0x8e, 0xf1, 0x5b, 0xb0, 0xe0, 0xd3,
+	0x35, 0x24, 0x75, 0x5b, 0x54, 0xaf, 0x26, 0x26, 0x71, 0x78, 0x7c, 0xa3, 0x2d, 0x2b, 0x0e, 0x20,
+	0x8d, 0xaa, 0x48, 0x8e, 0xb4, 0xc0, 0x07, 0x66, 0x17, 0x74, 0x05, 0xf7, 0xf9, 0xc4, 0xc1, 0x1b,
+	0x6a, 0x0d, 0x16, 0xba, 0x13, 0xcf, 0x1f, 0x79, 0x52, 0x6d, 0x72, 0x44, 0xa1, 0xc6, 0x1d, 0xb8,
+	0x01, 0x89, 0xce, 0x32, 0x31, 0x98, 0x51, 0x75, 0x7a, 0x46, 0xd5, 0xe6, 0xdf, 0x69, 0xb0, 0x31,
+	0x3d, 0xcb, 0x6b, 0xee, 0xee, 0xf7, 0x61, 0x59, 0xdd, 0x9d, 0xb0, 0x47, 0x4a, 0xf5, 0x5b, 0x75,
+	0x8b, 0x65, 0x65, 0x8b, 0x64, 0xa8, 0x78, 0x4b, 0x69, 0x75, 0x4b, 0xe6, 0x5f, 0x66, 0x61, 0x29,
+	0x71, 0xa4, 0xb8, 0x5b, 0xc4, 0xe7, 0x2f, 0xbe, 0x99, 0x8a, 0x11, 0x90, 0x07, 0xdd, 0xfb, 0xea,
+	0x21, 0xa5, 0x5d, 0x0b, 0xe7, 0x89, 0x59, 0xc9, 0xc5, 0x6e, 0x56, 0xcd, 0x94, 0x83, 0x65, 0xa6,
+	0x1d, 0xec, 0x13, 0xd0, 0xdd, 0xe1, 0x78, 0x12, 0x58, 0xe2, 0x02, 0x20, 0xc3, 0x66, 0x49, 0x4d,
+	0xe5, 0xa9, 0xbb, 0x98, 0x95, 0x88, 0x30, 0xce, 0x07, 0x90, 0x75, 0x80, 0x09, 0x87, 0xdb, 0x55,
+	0x14, 0xb6, 0x40, 0x0a, 0x9b, 0x65, 0x15, 0x84, 0x91, 0xb6, 0x4e, 0xe1, 0xed, 0xee, 0xc4, 0x0f,
+	0x46, 0x03, 0xcb, 0xbe, 0xbc, 0xf4, 0x9c, 0x4b, 0x9b, 0xe7, 0x02, 0x8a, 0x98, 0xc5, 0xf9, 0x62,
+	0x36, 0x05, 0x53, 0x35, 0xe6, 0x89, 0x24, 0x4e, 0x65, 0x1a, 0xb9, 0xd9, 0x4c, 0xe3, 0x53, 0xd8,
+	0x9a, 0x7b, 0x63, 0x89, 0x19, 0xf3, 0x38, 0x63, 0x96, 0xad, 0xcf, 0xb9, 0xb6, 0x48, 0xfc, 0x7b,
+	0x90, 0xb3, 0x27, 0x2f, 0xc4, 0x7d, 0x05, 0xea, 0xe2, 0xa2, 0x6c, 0x81, 0x2d, 0x22, 0x01, 0xa5,
+	0x0d, 0x0f, 0x40, 0xc7, 0x44, 0xcc, 0x76, 0x87, 0x4e, 0xcf, 0xe2, 0xd1, 0x32, 0xb0, 0x2f, 0x37,
+	0x0a, 0xb4, 0x9e, 0x52, 0x08, 0xc7, 0x70, 0xd9, 0xb1, 0x2f, 0x31, 0x48, 0x96, 0xce, 0x27, 0x6e,
+	0xbf, 0x87, 0x31, 0xc7, 0x12, 0x77, 0x6c, 0x91, 0xd3, 0xed, 0x41, 0xed, 0x8a, 0x5f, 0xef, 0x7c,
+	0x61, 0xe8, 0x17, 0x9c, 0xa2, 0xd1, 0xa3, 0x84, 0x01, 0x37, 0x51, 0x89, 0x38, 0x26, 0x5e, 0xdf,
+	0xba, 0x18, 0x79, 0x03, 0x3b, 0xd8, 0x58, 0x22, 0xb6, 0xe2, 0x55, 0x10, 0x8c, 0xf7, 0x76, 0x76,
+	0xba, 0xfd, 0x9d, 0xfb, 0x3d, 0xa6, 0x4b, 0xc6, 0x33, 0xaf, 0x7f, 0x48, 0x54, 0x66, 0x0f, 0x96,
+	0x70, 0xe2, 0xea, 0x70, 0x38, 0x0a, 0x48, 0x79, 0x6f, 0x20, 0xa3, 0x4b, 0xcf, 0xe8, 0xd9, 0xfc,
+	0xb7, 0x05, 0x58, 0x94, 0xd7, 0xc1, 0xed, 0x7c, 0x7d, 0x1d, 0xf8, 0xad, 0xa1, 0xe4, 0x1e, 0x0b,
+	0x38, 0xe4, 0x08, 0xf4, 0xee, 0xc0, 0xc5, 0x14, 0x36, 0xc0, 0x0b, 0xc3, 0x1a, 0xf8, 0x34, 0x99,
+	0xc6, 0x0a, 0x11, 0xac, 0xe9, 0xe3, 0xfd, 0x9d, 0x0b, 0xf5, 0xb1, 0x61, 0x20, 0x3a, 0xcd, 0x16,
+	0xe5, 0xb6, 0x8d, 0xf7, 0x41, 0xef, 0x4d, 0x3c, 0xe1, 0x59, 0x9c, 0x85, 0x4b, 0xe0, 0x51, 0x53,
+	0xdb, 0xd3, 0x1e, 0xb2, 0x52, 0x88, 0xea, 0x20, 0x06, 0xe5, 0x60, 0x5a, 0x87, 0x66, 0xf2, 0xd1,
+	0xf5, 0xf9, 0xf9, 0xa0, 0xdf, 0x98, 0x4d, 0xad, 0x5f, 0xa1, 0x05, 0x46, 0xe8, 0xb8, 0x76, 0x9f,
+	0x5f, 0x3e, 0x81, 0xf3, 0x22, 0xb0, 0x88, 0xac, 0x42, 0x64, 0xab, 0x31, 0xba, 0x26, 0xb0, 0x1d,
+	0xce, 0xf7, 0x07, 0x20, 0xb3, 0x18, 0x8b, 0x92, 0x34, 0xf5, 0x60, 0x18, 0xc2, 0x69, 0xd4, 0xe4,
+	0x8f, 0x95, 0x05, 0x31, 0x0d, 0xc8, 0xd7, 0x7e, 0x17, 0xf2, 0xe1, 0xa9, 0x70, 0xf0, 0x24, 0x28,
+	0x67, 0x31, 0x74, 0x7c, 0x87, 0xc5, 0x14, 0x18, 0xde, 0x4a, 0xe2, 0xa6, 0x45, 0x05, 0x8a, 0xb9,
+	0x72, 0xb4, 0xba, 0x22, 0x41, 0x51, 0x8f, 0xf3, 0xce, 0x47, 0x7e, 0xf6, 0x7c, 0x7c, 0x06, 0x65,
+	0x3b, 0x72, 0x0d, 0x21, 0x48, 0x78, 0x7a, 0x25, 0xba, 0xe2, 0x63, 0xd7, 0x61, 0xa5, 0x98, 0x96,
+	0xe4, 0x63, 0x98, 0xb9, 0x1a, 0x3d, 0xc7, 0x30, 0xc3, 0xd5, 0xb0, 0x51, 0x26, 0xf1, 0x79, 0x82,
+	0x74, 0x10, 0x60, 0x7c, 0x00, 0x85, 0x00, 0x8d, 0x66, 0x8d, 0x26, 0x01, 0xc6, 0x10, 0x72, 0xf3,
+	0xc2, 0xae, 0x2e, 0x04, 0x77, 0x10, 0x71, 0x42, 0x70, 0x06, 0x41, 0xf4, 0x1b, 0xd5, 0x5f, 0xba,
+	0xc2, 0x94, 0xcf, 0xeb, 0xbb, 0xe1, 0x19, 0x5d, 0x9a, 0x7f, 0xf0, 0x96, 0x22, 0xb2, 0x99, 0xa3,
+	0xaa, 0xdf, 0x70, 0x54, 0xef, 0xa1, 0x87, 0xf1, 0x65, 0x8d, 0x6d, 0xdf, 0xe7, 0x2e, 0xb4, 0x4c,
+	0xeb, 0xa6, 0x55, 0x9c, 0x22, 0x08, 0xbd, 0x68, 0x0f, 0x74, 0xb1, 0xf0, 0x71, 0xac, 0x96, 0x12,
+	0x49, 0x55, 0x57, 0x3f, 0x16, 0x3a, 0x09, 0xa2, 0xdf, 0x7c, 0x25, 0x8f, 0x33, 0xb9, 0x82, 0x5e,
+	0x64, 0x77, 0x7a, 0xce, 0xd8, 0x73, 0xba, 0x68, 0xaa, 0x9e, 0x65, 0x0f, 0xed, 0xfe, 0x4b, 0x9e,
+	0xca, 0x78, 0x8e, 0x8f, 0xd7, 0xb3, 0xcf, 0xf4, 0x69, 0x88, 0xf9, 0xcf, 0x29, 0x28, 0x88, 0x0c,
+	0xe9, 0x74, 0xe4, 0x0e, 0x03, 0x4c, 0x19, 0x0b, 0x4a, 0x80, 0x96, 0x95, 0x05, 0xc4, 0xa1, 0x18,
+	0xed, 0xb6, 0x2c, 0xc3, 0xb0, 0x38, 0xcb, 0xca, 0xc5, 0x25, 0x97, 0x18, 0x97, 0x44, 0xac, 0x2c,
+	0x48, 0x69, 0x40, 0xda, 0x6a, 0xc1, 0xba, 0x4f, 0xb3, 0x59, 0xb1, 0x41, 0x7d, 0x35, 0x69, 0x5b,
+	0x53, 0x93, 0x36, 0xc5, 0x01, 0x56, 0xfd, 0x29, 0x88, 0x2f, 0xef, 0x93, 0x58, 0xfb, 0x19, 0x12,
+	0xf0, 0xae, 0x2a, 0x80, 0xf6, 0xb4, 0x5d, 0x15, 0xea, 0xaf, 0x0f, 0xb1, 0x5c, 0x8d, 0x8c, 0xb1,
+	0xb5, 0x07, 0x45, 0x15, 0xc1, 0xeb, 0xa6, 0x38, 0x64, 0xf0, 0x9f, 0xc9, 0x9a, 0xad, 0x28, 0x6b,
+	0xb6, 0xbd, 0xd4, 0xf7, 0x35, 0xf3, 0x12, 0xf4, 0xe9, 0x15, 0x22, 0x75, 0x86, 0x9c, 0x91, 0x04,
+	0x3c, 0x7a, 0x8b, 0xd1, 0xc8, 0xd8, 0x81, 0x7c, 0xe4, 0x2f, 0x32, 0x85, 0x99, 0xf6, 0x0f, 0xa4,
+	0x8d, 0x69, 0xf6, 0x8b, 0x00, 0xb1, 0x6a, 0xcc, 0xe7, 0xa1, 0x75, 0xea, 0x9e, 0x87, 0x19, 0xcb,
+	0x8d, 0xd6, 0xc1, 0x18, 0x26, 0x14, 0xe5, 0xa9, 0xd7, 0x78, 0x41, 0xc2, 0xc2, 0x3c, 0xd1, 0xe1,
+	0xc2, 0xa2, 0x82, 0x5f, 0x04, 0xd5, 0x22, 0x01, 0x65, 0xa9, 0x6e, 0xfe, 0xb7, 0x16, 0x4e, 0x4c,
+	0x89, 0xf3, 0x6f, 0x18, 0x59, 0x31, 0xf0, 0x47, 0x31, 0x43, 0x4e, 0x97, 0x0b, 0xc3, 0x05, 0xcf,
+	0x84, 0xa4, 0x4b, 0x8c, 0xb9, 0xb5, 0xe2, 0xc4, 0x61, 0x2a, 0x83, 0x27, 0x5b, 0xb2, 0xb2, 0x1f,
+	0x0f, 0xc8, 0x03, 0x62, 0x76, 0xb1, 0x2b, 0x62, 0xcf, 0xce, 0xb2, 0x93, 0x02, 0x43, 0x76, 0x1a,
+	0x50, 0x19, 0xf0, 0x0f, 0x29, 0x28, 0x37, 0xc9, 0x49, 0xa3, 0x68, 0xc7, 0x83, 0x8b, 0x74, 0xf1,
+	0x78, 0xa7, 0x79, 0x01, 0xe1, 0x0b, 0x46, 0x47, 0x19, 0xb8, 0xc3, 0xb0, 0xc0, 0xc6, 0x9f, 0x04,
+	0xb1, 0x5f, 0xc8, 0x0b, 0x83, 0xff, 0xe4, 0x01, 0x7e, 0xe0, 0xd8, 0xa2, 0x05, 0xa1, 0x31, 0xfa,
+	0xcd, 0x73, 0x36, 0xb4, 0xb8, 0x8b, 0xd0, 0x2c, 0x41, 0xe5, 0x08, 0x03, 0xb0, 0x81, 0xf7, 0xcb,
+	0xb0, 0x67, 0x7b, 0x3d, 0xab, 0xe7, 0x3c, 0x77, 0xc9, 0xf2, 0x18, 0xc1, 0x39, 0xcd, 0x72, 0x88,
+	0x39, 0x08, 0x11, 0x18, 0x22, 0x36, 0x05, 0xa3, 0x65, 0x9f, 0xfb, 0xa3, 0xfe, 0x24, 0x70, 0x14,
+	0xae, 0x3c, 0x71, 0xad, 0x0b, 0x82, 0xaa, 0xc4, 0xc7, 0xbc, 0xbf, 0x03, 0x65, 0x25, 0x29, 0x89,
+	0x72, 0x1f, 0x8d, 0x95, 0x62, 0x30, 0x69, 0x15, 0x5d, 0xbf, 0x3b, 0x9a, 0x0c, 0x03, 0xca, 0x6c,
+	0xd2, 0x4c, 0x0c, 0xcc, 0xbf, 0x49, 0x41, 0x91, 0xc7, 0xe5, 0x48, 0x53, 0xdb, 0x50, 0x99, 0xf8,
+	0xf6, 0x39, 0xca, 0x92, 0x36, 0x10, 0x4c, 0x1a, 0x31, 0x2d, 0x0b, 0x94, 0x50, 0x7f, 0x8d, 0x23,
+	0x30, 0x2e, 0x87, 0x25, 0x79, 0x82, 0x9e, 0xab, 0x32, 0xcd, 0xef, 0x49, 0x79, 0x93, 0xa9, 0x2c,
+	0x3b, 0x60, 0x08, 0xc3, 0x26, 0x38, 0xd2, 0x21, 0x87, 0x4e, 0x48, 0x95, 0xe1, 0x3d, 0x28, 0xc7,
+	0xae, 0xea, 0x77, 0x51, 0x1c, 0x59, 0x21, 0x4b, 0xf7, 0x70, 0x84, 0x69, 0x73, 0x84, 0x71, 0x00,
+	0xab, 0x53, 0x89, 0xa1, 0xa3, 0x3a, 0xd0, 0x6c, 0x40, 0xab, 0x24, 0x53, 0x42, 0x52, 0x96, 0xf9,
+	0x9f, 0x58, 0xf0, 0xc6, 0x3a, 0x69, 0xc0, 0xaa, 0xf4, 0x9e, 0x29, 0x99, 0x1a, 0xc9, 0x5c, 0x15,
+	0x32, 0xa7, 0x7c, 0x8e, 0x55, 0x06, 0x49, 0x00, 0x59, 0xe1, 0xf7, 0x60, 0x89, 0x1f, 0xa8, 0xf8,
+	0x7a, 0x16, 0x01, 0xc4, 0x88, 0x6f, 0xc8, 0x88, 0xbf, 0xe8, 0xa9, 0x76, 0x79, 0x75, 0xf2, 0x99,
+	0x7e, 0x65, 0xf2, 0x69, 0xfe, 0x42, 0x03, 0x23, 0x51, 0x43, 0xfc, 0x3a, 0x55, 0xd4, 0x4c, 0xc0,
+	0x48, 0xdf, 0xaa, 0xec, 0xc8, 0xdc, 0xa6, 0xec, 0xc8, 0xce, 0x96, 0x1d, 0xb8, 0x08, 0x2a, 0x32,
+	0xe8, 0xd8, 0x60, 0xf6, 0x48, 0x03, 0xf3, 0x27, 0x1a, 0x6c, 0xcd, 0xee, 0xe4, 0x35, 0x2b, 0xb5,
+	0x78, 0xdf, 0xa9, 0xc4, 0xbe, 0x6b, 0x98, 0x1b, 0x27, 0x1a, 0x1b, 0x6a, 0xe4, 0x9a, 0xdb, 0xdd,
+	0x58, 0x4e, 0x74, 0x37, 0x48, 0xd7, 0xff, 0x92, 0xa6, 0x13, 0xf5, 0x8d, 0x6a, 0x59, 0x09, 0xcb,
+	0x99, 0x44, 0x58, 0x9e, 0x4e, 0x47, 0x0a, 0x33, 0xe9, 0x08, 0x06, 0x6e, 0x1b, 0xef, 0x8d, 0x80,
+	0x98, 0x97, 0x44, 0xe0, 0x26, 0x00, 0x67, 0xff, 0x18, 0xf2, 0x5c, 0xee, 0xc8, 0xeb, 0xa1, 0xde,
+	0x73, 0xd4, 0xfe, 0x2b, 0x45, 0x9e, 0x79, 0xc2, 0xa1, 0x7b, 0x71, 0xb7, 0x94, 0xf1, 0x4e, 0x0e,
+	0x01, 0x79, 0xc1, 0x82, 0x41, 0xd3, 0x4a, 0xe4, 0xda, 0x22, 0x22, 0x96, 0x10, 0xde, 0x51, 0xd2,
+	0x6d, 0x4e, 0x69, 0xbf, 0x48, 0x52, 0x2e, 0x48, 0x4a, 0xfb, 0x85, 0x4a, 0x89, 0x5b, 0xe1, 0x32,
+	0xa3, 0xe4, 0x3c, 0x4f, 0x11, 0x08, 0x10, 0xb6, 0x2f, 0xf3, 0x73, 0x4e, 0x81, 0xb2, 0x22, 0x0a,
+	0x90, 0x14, 0xf6, 0x8b, 0x90, 0x22, 0x4c, 0xca, 0x17, 0x95, 0xa4, 0x1c, 0xcd, 0x71, 0xe1, 0x3a,
+	0xfd, 0x9e, 0x8f, 0x39, 0x24, 0x87, 0xca, 0x91, 0xf9, 0x17, 0x1a, 0xac, 0xa8, 0x76, 0x7b, 0x43,
+	0x3e, 0xf5, 0x81, 0x38, 0xf0, 0xd3, 0xde, 0x34, 0xd5, 0xf5, 0x2a, 0xc8, 0xae, 0x57, 0xd4, 0xc7,
+	0x52, 0x6e, 0xea, 0x6f, 0xdf, 0x8b, 0x12, 0x97, 0x7b, 0x36, 0x79, 0xb9, 0x53, 0xa7, 0x64, 0x7a,
+	0x75, 0x6f, 0x48, 0x57, 0xf1, 0xc5, 0xaf, 0x74, 0xfe, 0x32, 0xd7, 0x75, 0xfe, 0xe4, 0xc5, 0xbf,
+	0x1f, 0xf5, 0xff, 0x1e, 0x83, 0x5e, 0xf3, 0x1c, 0x91, 0x5c, 0xbe, 0xde, 0x82, 0x64, 0xa2, 0x98,
+	0x8a, 0x12, 0x45, 0x93, 0xc1, 0x4a, 0x73, 0xd4, 0x73, 0x2f, 0xb0, 0x34, 0xfb, 0x35, 0xe4, 0x45,
+	0x77, 0x6d, 0x4a, 0xbd, 0x6b, 0x9f, 0xc0, 0x12, 0xdd, 0x67, 0x6f, 0x44, 0x58, 0x1d, 0xb6, 0xda,
+	0x0e, 0x96, 0x94, 0x98, 0x49, 0xbc, 0x6c, 0x63, 0x0d, 0x89, 0x29, 0xde, 0x17, 0x9e, 0x1b, 0x38,
+	0x0d, 0x9e, 0x39, 0x62, 0x56, 0xb0, 0x70, 0x4e, 0xcd, 0x5a, 0x29, 0xb9, 0x1c, 0xb9, 0x9b, 0xe8,
+	0xe1, 0x32, 0x89, 0x36, 0x7f, 0x04, 0x77, 0xe6, 0x8a, 0x91, 0x25, 0xd4, 0xed, 0x56, 0x78, 0x9f,
+	0xfb, 0xe0, 0xf0, 0x99, 0x2f, 0x8b, 0x86, 0x99, 0x6a, 0x49, 0x60, 0x79, 0xae, 0x51, 0x0e, 0x2f,
+	0xb4, 0x91, 0x27, 0x16, 0xfa, 0xed, 0xf4, 0x92, 0xb1, 0x06, 0x93, 0x8e, 0x75, 0x11, 0x65, 0x49,
+	0x69, 0x35, 0x1f, 0x10, 0x7e, 0x75, 0x88, 0x48, 0x56, 0xf2, 0xa3, 0xdf, 0x74, 0x63, 0x5b, 0x70,
+	0x27, 0xca, 0xe5, 0xec, 0x68, 0xf5, 0xb2, 0x9c, 0xf3, 0x65, 0x1b, 0xf5, 0x6e, 0xa4, 0x17, 0x22,
+	0x8c, 0x77, 0x29, 0x8a, 0x39, 0x9f, 0x6d, 0xfa, 0xd7, 0xa1, 0xcc, 0x2a, 0xe8, 0x0a, 0x50, 0xe8,
+	0x3d, 0x51, 0xc1, 0x6b, 0x37, 0x55, 0xf0, 0xe6, 0xff, 0xa4, 0x40, 0x3f, 0xc0, 0x0b, 0x52, 0x16,
+	0x05, 0x42, 0xb5, 0xaa, 0x7a, 0xb4, 0xd7, 0x56, 0x4f, 0xea, 0x96, 0xea, 0xf9, 0x10, 0xd6, 0x12,
+	0xc5, 0x23, 0x79, 0xa7, 0xc5, 0x73, 0xe7, 0x05, 0x72, 0xd7, 0x8a, 0x52, 0x2f, 0x92, 0xf7, 0x37,
+	0x31, 0x97, 0x46, 0xa6, 0x44, 0x86, 0x1f, 0x33, 0x65, 0x04, 0x93, 0x92, 0xd3, 0x47, 0x4c, 0x51,
+	0x9b, 0xc2, 0x77, 0xbf, 0x76, 0x88, 0x38, 0x4b, 0xc4, 0xa2, 0x4d, 0xd1, 0x46, 0x20, 0xa7, 0x3a,
+	0x87, 0xb7, 0xe3, 0xd4, 0x3b, 0x56, 0x49, 0x64, 0xaf, 0x02, 0x69, 0xe2, 0x5e, 0xd2, 0x5e, 0x8a,
+	0xee, 0x42, 0x83, 0x6d, 0xf9, 0xd7, 0xe2, 0xcc, 0x3f, 0x83, 0x65, 0x15, 0x2a, 0x4c, 0x36, 0x37,
+	0x78, 0x69, 0xb7, 0x0d, 0x5e, 0xc6, 0xfb, 0xb0, 0x2c, 0xf8, 0x26, 0x98, 0xbe, 0xb9, 0x5f, 0x8b,
+	0xdc, 0x5f, 0x14, 0x24, 0x3a, 0x21, 0xce, 0x62, 0xb8, 0xf9, 0xe7, 0x98, 0x05, 0x55, 0x65, 0xdd,
+	0xff, 0x48, 0xb6, 0x90, 0x28, 0x10, 0x7f, 0x8b, 0x87, 0xca, 0xfc, 0x65, 0x1a, 0xee, 0xcc, 0x5d,
+	0xc4, 0x6b, 0xc5, 0x8e, 0x2a, 0x54, 0xa2, 0xfb, 0xf1, 0x4f, 0x39, 0xb7, 0xea, 0x7e, 0x46, 0x62,
+	0x6a, 0x71, 0xd5, 0xe8, 0x9e, 0x32, 0x22, 0xd5, 0xdd, 0x87, 0xc2, 0xa5, 0x13, 0x08, 0xb5, 0x3b,
+	0xbe, 0xfc, 0xa2, 0x2d, 0xbe, 0x06, 0x02, 0x22, 0xf6, 0x05, 0xdc, 0xe8, 0x82, 0x31, 0x35, 0xd3,
+	0xc0, 0x1e, 0xcb, 0xeb, 0xe5, 0x63, 0x79, 0xb8, 0xae, 0xdf, 0x4e, 0x62, 0x11, 0x4d, 0x7b, 0x2c,
+	0x5a, 0x0f, 0x65, 0x2f, 0x09, 0xdd, 0x6a, 0x43, 0x49, 0x21, 0x74, 0x9d, 0x6b, 0x37, 0xa8, 0xdd,
+	0x7e, 0x83, 0x5b, 0x41, 0x32, 0x33, 0x09, 0x67, 0x9f, 0xd3, 0xdf, 0x38, 0x54, 0xfb, 0x1b, 0x85,
+	0xdd, 0x87, 0xaf, 0xb5, 0x2d, 0x5c, 0xad, 0xda, 0x11, 0xf9, 0x71, 0x1a, 0x96, 0x42, 0x4e, 0xe1,
+	0x57, 0x9f, 0x09, 0x0d, 0x06, 0x23, 0xeb, 0xdc, 0x09, 0x3b, 0x51, 0xbd, 0xeb, 0x6e, 0x18, 0xae,
+	0x9a, 0xce, 0x68, 0xdf, 0x91, 0x22, 0x7a, 0xc6, 0x0f, 0xa0, 0xa2, 0x74, 0x43, 0xb9, 0x20, 0xc5,
+	0xd2, 0x33, 0xec, 0xcb, 0x31, 0x2d, 0x02, 0xc9, 0xce, 0x5f, 0x80, 0x31, 0x25, 0x80, 0x1b, 0x50,
+	0xc4, 0xf1, 0xef, 0x25, 0x77, 0x4a, 0xeb, 0xdd, 0x7e, 0xa4, 0x8a, 0x88, 0x6c, 0xa6, 0x5f, 0x4d,
+	0x81, 0xb7, 0x9a, 0x00, 0xd1, 0xc4, 0xfe, 0x75, 0xeb, 0xd4, 0x6e, 0xbb, 0xce, 0xad, 0x2e, 0xac,
+	0xce, 0x9d, 0x79, 0x8e, 0xbd, 0x3e, 0x4a, 0xda, 0xeb, 0xdd, 0x79, 0xbb, 0x88, 0x97, 0xa6, 0x5a,
+	0xe7, 0x57, 0x69, 0x28, 0x85, 0x74, 0xaf, 0x75, 0xe0, 0xde, 0x05, 0xc0, 0x5b, 0xc3, 0x73, 0x7c,
+	0x3f, 0x8c, 0x30, 0x39, 0xa6, 0x40, 0xd4, 0xac, 0x70, 0x71, 0xba, 0x99, 0x4e, 0x36, 0xf7, 0x5d,
+	0x9f, 0xb0, 0xf2, 0x0b, 0x49, 0x08, 0xe3, 0x24, 0x8f, 0x61, 0x25, 0x22, 0xc1, 0xa8, 0x8f, 0xc9,
+	0x84, 0x08, 0x24, 0x40, 0xeb, 0xd9, 0x50, 0x76, 0x87, 0x14, 0x1d, 0x22, 0xa0, 0x98, 0x62, 0xd8,
+	0x33, 0x30, 0x3e, 0x9d, 0x68, 0x8c, 0xc9, 0x8f, 0xb6, 0xa2, 0x0c, 0x14, 0xcd, 0x32, 0xf9, 0xd5,
+	0xf5, 0x63, 0x58, 0xf7, 0xd1, 0x6d, 0x6d, 0x8c, 0x8b, 0x0e, 0x56, 0x00, 0x2a, 0x75, 0x81, 0xfa,
+	0x7b, 0xab, 0x31, 0xba, 0xa1, 0xf0, 0x61, 0xfe, 0x29, 0xdb, 0xc8, 0xf2, 0x53, 0x9b, 0x18, 0xf1,
+	0x18, 0xac, 0xc8, 0x53, 0x3a, 0xcd, 0x45, 0xa6, 0xc7, 0x08, 0xa9, 0x6d, 0x4c, 0xb1, 0xa3, 0xd6,
+	0x2b, 0x3d, 0x97, 0x10, 0x39, 0x74, 0x31, 0x04, 0xd2, 0x6b, 0x03, 0x95, 0x48, 0x29, 0x74, 0x23,
+	0x22, 0x9e, 0x23, 0x3d, 0xce, 0xe4, 0xf2, 0x3a, 0xb0, 0x95, 0x2e, 0x7d, 0xb2, 0x11, 0x1d, 0x33,
+	0x69, 0x01, 0xdf, 0xfc, 0xbf, 0x34, 0x18, 0xb3, 0x0a, 0x33, 0x18, 0x94, 0x22, 0x45, 0x73, 0xbb,
+	0x86, 0x8f, 0x35, 0xde, 0xbf, 0x4e, 0xc5, 0x53, 0x20, 0x7a, 0xbe, 0xb1, 0x14, 0x8a, 0xe0, 0x1e,
+	0xe2, 0xa0, 0xf1, 0x0a, 0xce, 0xf0, 0xb9, 0xeb, 0x8d, 0x86, 0x03, 0x47, 0x66, 0x9b, 0xa5, 0xdd,
+	0x07, 0xd7, 0x0a, 0xac, 0xc7, 0xb4, 0x24, 0x4d, 0x65, 0x36, 0x36, 0x60, 0xb1, 0x3b, 0x1a, 0x90,
+	0x1c, 0xa1, 0xe2, 0x70, 0xc8, 0xcd, 0x1a, 0x7f, 0x8f, 0xc7, 0xa2, 0x4d, 0xbe, 0xe8, 0x89, 0x60,
+	0x58, 0xb5, 0x29, 0x1e, 0x98, 0x7d, 0xa5, 0x07, 0x2e, 0xcc, 0x7a, 0xe0, 0x3b, 0x00, 0x51, 0x79,
+	0x1b, 0xd6, 0x7d, 0xf9, 0xb0, 0xbe, 0xf5, 0xcd, 0x1f, 0x4e, 0x6b, 0x93, 0xac, 0x94, 0x83, 0x4c,
+	0xeb, 0xa4, 0x55, 0xd7, 0xdf, 0x32, 0x4a, 0x18, 0x09, 0xea, 0x47, 0xac, 0xde, 0x6e, 0x37, 0x4e,
+	0xf8, 0xbb, 0x0f, 0x80, 0x85, 0xc6, 0x51, 0x8b, 0xbf, 0x8a, 0x48, 0x61, 0x31, 0x59, 0x3a, 0xac,
+	0x1e, 0xb7, 0xeb, 0xd6, 0xe9, 0x49, 0xbb, 0xd1, 0x69, 0x3c, 0xad, 0xeb, 0x69, 0xfe, 0x94, 0xe8,
+	0xac, 0xf5, 0xa4, 0x75, 0xf2, 0x45, 0x4b, 0xcf, 0x98, 0x9f, 0x43, 0x79, 0x4a, 0x29, 0xfc, 0x25,
+	0xc5, 0x59, 0xab, 0x7d, 0x5a, 0xaf, 0x35, 0x0e, 0x1b, 0xf5, 0x03, 0x9c, 0x60, 0x09, 0xf2, 0xa7,
+	0x28, 0xfe, 0x6c, 0xbf, 0xd9, 0xe8, 0xa0, 0x7c, 0x9c, 0x0f, 0xa5, 0x75, 0xe4, 0x38, 0x45, 0x63,
+	0x76, 0x72, 0x70, 0x56, 0xeb, 0xf0, 0xf9, 0xd3, 0xe6, 0xcf, 0xd2, 0xf0, 0xf6, 0x81, 0xed, 0x5f,
+	0x9d, 0x8f, 0x94, 0xd4, 0xd1, 0xa9, 0x5d, 0xd9, 0x5e, 0x20, 0x42, 0xf2, 0xad, 0xba, 0xb8, 0x9f,
+	0x82, 0x2e, 0x92, 0x33, 0xdf, 0xe9, 0x3b, 0x5d, 0x91, 0x07, 0x25, 0xf2, 0xbb, 0xf8, 0x71, 0x0f,
+	0x2b, 0x13, 0x65, 0x3b, 0x22, 0x8c, 0x6a, 0xe8, 0x74, 0xe2, 0xc3, 0xd6, 0x9b, 0xeb, 0x13, 0x64,
+	0x6e, 0xdd, 0x27, 0xc8, 0x7e, 0x63, 0x7d, 0x82, 0x4d, 0xc8, 0x71, 0x0a, 0x5c, 0xa7, 0xe8, 0x46,
+	0x64, 0xd9, 0x22, 0x8e, 0x71, 0x2f, 0xbe, 0xf1, 0x09, 0x6c, 0x5e, 0xb9, 0x97, 0x57, 0x7d, 0xfc,
+	0x0b, 0x2c, 0x9f, 0x2e, 0x49, 0x6b, 0x34, 0xb4, 0xe8, 0xc3, 0x14, 0x05, 0xc8, 0x1c, 0x5b, 0x8b,
+	0x08, 0xda, 0x84, 0x3f, 0x19, 0x3e, 0xe2, 0x58, 0xf3, 0xaf, 0x35, 0x58, 0x8b, 0x8c, 0x87, 0xc2,
+	0x14, 0xb3, 0x29, 0x2e, 0xae, 0x25, 0x5c, 0xfc, 0x2e, 0x14, 0xe2, 0x46, 0xb5, 0xb0, 0x52, 0x9e,
+	0x41, 0xd4, 0xa9, 0xbe, 0x61, 0x3d, 0xe9, 0x57, 0xae, 0xe7, 0xe7, 0x69, 0xf8, 0x6e, 0xb4, 0x9e,
+	0xda, 0x68, 0x30, 0xb6, 0x3d, 0x67, 0x9e, 0x4f, 0x7d, 0x0e, 0x05, 0x29, 0x58, 0xb9, 0xf8, 0x1e,
+	0x86, 0x9e, 0x72, 0x23, 0xff, 0xb6, 0x98, 0x95, 0x81, 0x10, 0x42, 0x57, 0xf7, 0x3c, 0xc3, 0xa7,
+	0x6e, 0x6d, 0xf8, 0xf4, 0x5c, 0xc3, 0xab, 0x46, 0xcb, 0xbc, 0x86, 0xd1, 0xb2, 0xaf, 0x52, 0xd2,
+	0xd6, 0x4f, 0xf8, 0x6b, 0x4b, 0x91, 0xb9, 0xf1, 0x2f, 0x2f, 0x52, 0x0f, 0xca, 0xdb, 0x3a, 0xa9,
+	0x1b, 0xf1, 0x35, 0x7d, 0xe6, 0xf8, 0xa5, 0xe6, 0x1c, 0xbf, 0x4f, 0xa0, 0x3c, 0x75, 0xfc, 0x68,
+	0x47, 0xf3, 0x4e, 0x5f, 0x29, 0x79, 0xfa, 0xa2, 0xc3, 0x97, 0x89, 0x0f, 0x9f, 0xf9, 0xb7, 0x1a,
+	0xbc, 0x33, 0x6d, 0x86, 0xa4, 0x77, 0x6d, 0x8a, 0x1c, 0x9e, 0x3c, 0x48, 0x23, 0xce, 0x45, 0xe1,
+	0x5e, 0xfe, 0x37, 0xea, 0x5f, 0x7f, 0x0c, 0x77, 0xa3, 0x75, 0x3d, 0x75, 0xfd, 0x09, 0x5d, 0x97,
+	0x61, 0xb8, 0xbd, 0xc1, 0xef, 0xa7, 0x43, 0x7b, 0x6a, 0x26, 0xb4, 0x9b, 0x5f, 0x02, 0xc4, 0x9f,
+	0x4a, 0xe7, 0x3e, 0xad, 0xdc, 0x50, 0xb3, 0xa9, 0xfc, 0x7e, 0x6a, 0x23, 0x7c, 0x95, 0xc9, 0xaf,
+	0x05, 0x61, 0x02, 0xfa, 0xac, 0x98, 0xa6, 0x2b, 0x5d, 0xbc, 0x5c, 0xa0, 0x17, 0x82, 0xff, 0x9b,
+	0x81, 0x3c, 0x97, 0xfd, 0x1a, 0x31, 0x15, 0x75, 0x1c, 0x38, 0xe8, 0x9e, 0x3d, 0x37, 0xec, 0x62,
+	0x2d, 0xf2, 0xf1, 0x81, 0x4b, 0x9f, 0xf4, 0xb8, 0xfb, 0x62, 0xfe, 0x80, 0x0a, 0xec, 0x4a, 0xef,
+	0x05, 0x09, 0x6a, 0x3b, 0xdd, 0xb9, 0x9f, 0x84, 0x33, 0xb7, 0xfb, 0x24, 0x1c, 0x79, 0xc4, 0x82,
+	0x12, 0x8e, 0xa7, 0xbb, 0xbe, 0x8b, 0x33, 0x5d, 0x5f, 0xf5, 0x95, 0x43, 0x2e, 0xf9, 0xca, 0xe1,
+	0x5b, 0x28, 0x98, 0x6f, 0xea, 0xa1, 0x14, 0x7f, 0xd3, 0x1e, 0x8a, 0xf1, 0x47, 0xb0, 0x8a, 0x69,
+	0x93, 0xe3, 0xa1, 0xbb, 0x58, 0x8a, 0x6a, 0x7d, 0xf9, 0x00, 0xe1, 0x41, 0xac, 0x56, 0x11, 0xa2,
+	0x1a, 0x92, 0x38, 0x56, 0xb4, 0x2f, 0x8a, 0x83, 0x8a, 0x3b, 0x8b, 0xd9, 0x3a, 0x84, 0x8d, 0xeb,
+	0x18, 0x6e, 0xfa, 0xc6, 0x9c, 0x57, 0x72, 0x76, 0x4c, 0xf4, 0xb2, 0xfa, 0x02, 0x2b, 0xd1, 0xa3,
+	0x5e, 0xf1, 0xa2, 0x04, 0xfd, 0xc3, 0xfc, 0xa7, 0x34, 0x6c, 0x5d, 0xaf, 0x57, 0xc3, 0x47, 0x6f,
+	0xa4, 0xc6, 0xc0, 0xd8, 0xee, 0x3e, 0x73, 0x87, 0x97, 0x32, 0xd3, 0xfb, 0xf0, 0x26, 0x83, 0x6c,
+	0x53, 0xdd, 0x7b, 0x2a, 0x98, 0x04, 0x6c, 0x6f, 0x73, 0xbf, 0xda, 0xa9, 0x3d, 0xb2, 0x4e, 0xab,
+	0xb5, 0x27, 0x8d, 0xd6, 0x91, 0xa5, 0xa4, 0x26, 0xb2, 0x8b, 0x22, 0xc9, 0x0d, 0x1b, 0x72, 0x24,
+	0x8d, 0xcf, 0x27, 0x12, 0xc1, 0x9d, 0x1b, 0xe7, 0x6b, 0x4b, 0x06, 0x39, 0xd7, 0x0a, 0xbd, 0x34,
+	0x9d, 0x9e, 0x26, 0x12, 0x6b, 0xfe, 0x09, 0x18, 0xb3, 0x2b, 0xc4, 0x83, 0x7a, 0xfd, 0x1a, 0x31,
+	0x7d, 0x5a, 0x85, 0xe5, 0x46, 0xeb, 0xf4, 0xac, 0x63, 0x3d, 0xad, 0x1e, 0x9f, 0xd5, 0xad, 0x13,
+	0x76, 0x50, 0x67, 0x98, 0x46, 0xf1, 0xd4, 0xac, 0xfe, 0x05, 0xa6, 0x1b, 0x16, 0x31, 0xd7, 0xdb,
+	0x7a, 0x0a, 0x53, 0xbd, 0x52, 0x72, 0x45, 0xfc, 0x55, 0xed, 0xbc, 0x35, 0xa1, 0x58, 0x4a, 0xe3,
+	0x1a, 0x87, 0x27, 0xac, 0x89, 0xc2, 0x4c, 0x78, 0xf7, 0xb8, 0xca, 0x8e, 0xb8, 0xb4, 0x0e, 0x6b,
+	0x54, 0x5b, 0x47, 0xc7, 0x75, 0xab, 0xf3, 0x88, 0xd5, 0xeb, 0xd6, 0xfe, 0x59, 0xed, 0x49, 0xbd,
+	0xc3, 0x85, 0xff, 0x2c, 0x03, 0x9b, 0xd7, 0x3a, 0xaa, 0xf1, 0x57, 0x1a, 0xdc, 0xa5, 0xc6, 0x16,
+	0x9e, 0x46, 0xac, 0xfc, 0xd5, 0xa7, 0x3c, 0xe7, 0xce, 0x95, 0xfd, 0xdc, 0x95, 0x5d, 0xfc, 0xd2,
+	0xee, 0x27, 0x37, 0xf8, 0xfc, 0x36, 0xb5, 0xc0, 0x30, 0x78, 0x36, 0xe2, 0x27, 0x3e, 0x52, 0xbf,
+	0x6a, 0x62, 0xc9, 0xee, 0x38, 0xb3, 0x74, 0xfb, 0x72, 0x2a, 0x03, 0xeb, 0x51, 0x2a, 0x52, 0x2f,
+	0x3d, 0x7b, 0x60, 0xc9, 0xe8, 0xaf, 0x94, 0xde, 0x3b, 0x37, 0xad, 0xe1, 0x51, 0xc8, 0x2c, 0xbe,
+	0x70, 0xb2, 0xca, 0x55, 0x12, 0x40, 0x45, 0xef, 0x7f, 0x69, 0x50, 0x9e, 0x22, 0x7c, 0xf5, 0xeb,
+	0xb0, 0x4f, 0x61, 0xa3, 0x3f, 0xfa, 0x8a, 0x9f, 0xd5, 0x9e, 0xeb, 0x77, 0xf1, 0x70, 0xb9, 0xfc,
+	0xa3, 0xb3, 0xf2, 0xa2, 0x7e, 0x4f, 0xfb, 0x80, 0xad, 0x09, 0x92, 0x83, 0x98, 0x42, 0x3c, 0x8a,
+	0xa0, 0x97, 0x55, 0x97, 0x57, 0x9c, 0x9b, 0xde, 0xb3, 0xda, 0x31, 0xaf, 0x08, 0xb7, 0xab, 0x12,
+	0xdd, 0x09, 0xb1, 0x82, 0xef, 0x21, 0x18, 0x3e, 0xda, 0x83, 0xfa, 0xfa, 0x43, 0x3e, 0xf3, 0xa5,
+	0x1b, 0xf8, 0xe1, 0xc7, 0xe4, 0x0f, 0xd9, 0xb2, 0x82, 0x3c, 0x20, 0x1c, 0x26, 0xf5, 0x9b, 0xd7,
+	0xda, 0x60, 0x36, 0xbd, 0x5f, 0x86, 0x25, 0x51, 0x2f, 0x58, 0xf4, 0x80, 0xba, 0x8d, 0xee, 0xa4,
+	0x43, 0x91, 0x9e, 0x51, 0x87, 0x90, 0x94, 0xf9, 0xf7, 0x19, 0x79, 0x93, 0x89, 0x42, 0xf2, 0x33,
+	0xf9, 0xb2, 0x49, 0xa9, 0xdd, 0x4b, 0xbb, 0x77, 0xa6, 0x5f, 0x36, 0xd1, 0x4f, 0x59, 0xca, 0x53,
+	0x64, 0x97, 0xff, 0x12, 0x72, 0x28, 0x4b, 0x6e, 0x5e, 0x4e, 0x89, 0x8a, 0x55, 0xb5, 0xed, 0x4a,
+	0xb2, 0xa1, 0x20, 0x1f, 0x49, 0x19, 0x76, 0x62, 0x2c, 0x9b, 0x68, 0x25, 0x7f, 0x32, 0xc0, 0xdb,
+	0xed, 0xa5, 0x95, 0xa8, 0x8d, 0x97, 0x24, 0x34, 0xea, 0x31, 0x94, 0xf8, 0x05, 0xde, 0xe5, 0xc9,
+	0x86, 0x45, 0x2f, 0x60, 0x64, 0xd9, 0xeb, 0xc9, 0x0c, 0xe4, 0x18, 0x61, 0xd7, 0x57, 0x70, 0x3f,
+	0x84, 0x35, 0xfa, 0x17, 0x13, 0xb2, 0x17, 0xff, 0x7f, 0x94, 0x09, 0x9e, 0x0c, 0xaa, 0x9e, 0x17,
+	0x68, 0xdb, 0xf7, 0x67, 0xb6, 0xcd, 0x42, 0xf2, 0x43, 0x41, 0x4d, 0xb5, 0xe6, 0x8a, 0x37, 0x07,
+	0x1a, 0x26, 0x08, 0x52, 0x31, 0x58, 0xd4, 0x9d, 0x56, 0xdb, 0x6d, 0xf1, 0x2f, 0x1e, 0x8c, 0xbf,
+	0x93, 0xa7, 0xff, 0x49, 0xa1, 0x1a, 0xeb, 0xb0, 0xda, 0xa9, 0x1e, 0x8b, 0x71, 0x9a, 0xdb, 0xac,
+	0xda, 0xaa, 0x1e, 0x7f, 0xd9, 0x6e, 0xb4, 0x05, 0x28, 0xc3, 0xed, 0xda, 0x68, 0x59, 0x58, 0x89,
+	0x51, 0x29, 0xa8, 0x67, 0x4d, 0x1f, 0x56, 0xe6, 0x2d, 0x84, 0xbf, 0xfe, 0x97, 0xf5, 0x1f, 0xc6,
+	0x22, 0x1e, 0x54, 0xea, 0x18, 0x34, 0xbe, 0x3c, 0xe5, 0xa5, 0x24, 0xc6, 0xa4, 0x66, 0xb5, 0xdd,
+	0xa9, 0x33, 0x8b, 0xf1, 0x3a, 0x88, 0xf1, 0x72, 0x6f, 0x1d, 0x2a, 0x8f, 0x4f, 0xf6, 0xad, 0x26,
+	0xce, 0x77, 0xa4, 0x20, 0x52, 0xfc, 0x19, 0xbe, 0x78, 0x98, 0x1f, 0x03, 0xd3, 0xe6, 0xd7, 0x50,
+	0x14, 0x2d, 0x63, 0xe6, 0x74, 0xb1, 0xd4, 0xe2, 0xcf, 0xa7, 0xd5, 0x67, 0x35, 0xb2, 0xcb, 0x33,
+	0xe7, 0x45, 0x4d, 0x41, 0x79, 0x51, 0xa3, 0x70, 0x51, 0x8c, 0x48, 0x3e, 0xba, 0x56, 0x1f, 0xd2,
+	0x14, 0x94, 0xa6, 0xbb, 0x79, 0x0c, 0x10, 0x37, 0xfd, 0x67, 0xde, 0x20, 0x69, 0xb3, 0x6f, 0x90,
+	0xf0, 0xac, 0xd3, 0xc7, 0x83, 0xb1, 0x1d, 0x5c, 0x85, 0xff, 0x01, 0xc2, 0x01, 0xa7, 0x38, 0x7e,
+	0xef, 0xfb, 0x90, 0x0b, 0x0b, 0xc3, 0xb9, 0x25, 0x71, 0xfc, 0x1f, 0x38, 0x9a, 0x51, 0x84, 0xdc,
+	0xfe, 0x59, 0xe3, 0xf8, 0xc0, 0x6a, 0x1c, 0xe8, 0xa9, 0xff, 0x07, 0x2e, 0x65, 0x95, 0x0f, 0x1a,
+	0x35, 0x00, 0x00,
 }